@@ -160,6 +160,8 @@ set(QET_SRC_FILES
   ${QET_DIR}/sources/exportproperties.h
   ${QET_DIR}/sources/exportpropertieswidget.cpp
   ${QET_DIR}/sources/exportpropertieswidget.h
+  ${QET_DIR}/sources/folioprefetcher.cpp
+  ${QET_DIR}/sources/folioprefetcher.h
   ${QET_DIR}/sources/genericpanel.cpp
   ${QET_DIR}/sources/genericpanel.h
   ${QET_DIR}/sources/machine_info.cpp
@@ -167,6 +169,16 @@ set(QET_SRC_FILES
   ${QET_DIR}/sources/main.cpp
   ${QET_DIR}/sources/newelementwizard.cpp
   ${QET_DIR}/sources/newelementwizard.h
+  ${QET_DIR}/sources/projectchangebus.cpp
+  ${QET_DIR}/sources/projectchangebus.h
+  ${QET_DIR}/sources/projectconsistencychecker.cpp
+  ${QET_DIR}/sources/projectconsistencychecker.h
+  ${QET_DIR}/sources/projectdiff.cpp
+  ${QET_DIR}/sources/projectdiff.h
+  ${QET_DIR}/sources/projectfilereader.cpp
+  ${QET_DIR}/sources/projectfilereader.h
+  ${QET_DIR}/sources/projectgenerator.cpp
+  ${QET_DIR}/sources/projectgenerator.h
   ${QET_DIR}/sources/projectview.cpp
   ${QET_DIR}/sources/projectview.h
   ${QET_DIR}/sources/qetapp.cpp
@@ -183,6 +195,8 @@ set(QET_SRC_FILES
   ${QET_DIR}/sources/qetinformation.h
   ${QET_DIR}/sources/qetmainwindow.cpp
   ${QET_DIR}/sources/qetmainwindow.h
+  ${QET_DIR}/sources/qetmemoryaccounting.cpp
+  ${QET_DIR}/sources/qetmemoryaccounting.h
   ${QET_DIR}/sources/qetmessagebox.cpp
   ${QET_DIR}/sources/qetmessagebox.h
   ${QET_DIR}/sources/qetproject.cpp
@@ -205,6 +219,8 @@ set(QET_SRC_FILES
   ${QET_DIR}/sources/qtextorientationwidget.h
   ${QET_DIR}/sources/recentfiles.cpp
   ${QET_DIR}/sources/recentfiles.h
+  ${QET_DIR}/sources/tiledrasterexport.cpp
+  ${QET_DIR}/sources/tiledrasterexport.h
   ${QET_DIR}/sources/titleblockcell.cpp
   ${QET_DIR}/sources/titleblockcell.h
   ${QET_DIR}/sources/titleblockproperties.cpp
@@ -354,6 +370,8 @@ set(QET_SRC_FILES
   ${QET_DIR}/sources/ElementsCollection/elementscollectionmodel.h
   ${QET_DIR}/sources/ElementsCollection/elementscollectionwidget.cpp
   ${QET_DIR}/sources/ElementsCollection/elementscollectionwidget.h
+  ${QET_DIR}/sources/ElementsCollection/elementssearchindex.cpp
+  ${QET_DIR}/sources/ElementsCollection/elementssearchindex.h
   ${QET_DIR}/sources/ElementsCollection/elementslocation.cpp
   ${QET_DIR}/sources/ElementsCollection/elementslocation.h
   ${QET_DIR}/sources/ElementsCollection/elementstreeview.cpp
@@ -468,6 +486,8 @@ set(QET_SRC_FILES
 
   ${QET_DIR}/sources/QetGraphicsItemModeler/qetgraphicshandleritem.cpp
   ${QET_DIR}/sources/QetGraphicsItemModeler/qetgraphicshandleritem.h
+  ${QET_DIR}/sources/QetGraphicsItemModeler/qetgraphicshandlerlayer.cpp
+  ${QET_DIR}/sources/QetGraphicsItemModeler/qetgraphicshandlerlayer.h
   ${QET_DIR}/sources/QetGraphicsItemModeler/qetgraphicshandlerutility.cpp
   ${QET_DIR}/sources/QetGraphicsItemModeler/qetgraphicshandlerutility.h
 
@@ -648,10 +668,16 @@ set(QET_SRC_FILES
   ${QET_DIR}/sources/ui/marginseditdialog.h
   ${QET_DIR}/sources/ui/masterpropertieswidget.cpp
   ${QET_DIR}/sources/ui/masterpropertieswidget.h
+  ${QET_DIR}/sources/ui/memoryreportdialog.cpp
+  ${QET_DIR}/sources/ui/memoryreportdialog.h
   ${QET_DIR}/sources/ui/multipastedialog.cpp
   ${QET_DIR}/sources/ui/multipastedialog.h
   ${QET_DIR}/sources/ui/potentialselectordialog.cpp
   ${QET_DIR}/sources/ui/potentialselectordialog.h
+  ${QET_DIR}/sources/ui/projectconsistencydialog.cpp
+  ${QET_DIR}/sources/ui/projectconsistencydialog.h
+  ${QET_DIR}/sources/ui/projectdiffdialog.cpp
+  ${QET_DIR}/sources/ui/projectdiffdialog.h
   ${QET_DIR}/sources/ui/projectpropertiesdialog.cpp
   ${QET_DIR}/sources/ui/projectpropertiesdialog.h
   ${QET_DIR}/sources/ui/reportpropertiewidget.cpp
@@ -699,10 +725,14 @@ set(QET_SRC_FILES
   ${QET_DIR}/sources/utils/conductorcreator.h
   ${QET_DIR}/sources/utils/macosxopenevent.cpp
   ${QET_DIR}/sources/utils/macosxopenevent.h
+  ${QET_DIR}/sources/utils/qetlevelofdetail.cpp
+  ${QET_DIR}/sources/utils/qetlevelofdetail.h
   ${QET_DIR}/sources/utils/qetsettings.cpp
   ${QET_DIR}/sources/utils/qetsettings.h
   ${QET_DIR}/sources/utils/qetutils.cpp
   ${QET_DIR}/sources/utils/qetutils.h
+  ${QET_DIR}/sources/utils/startupscheduler.cpp
+  ${QET_DIR}/sources/utils/startupscheduler.h
 
   ${QET_DIR}/sources/xml/terminalstripitemxml.cpp
   ${QET_DIR}/sources/xml/terminalstripitemxml.h
@@ -260,6 +260,7 @@ TARGET = qelectrotech
 # Ajustement des bibliotheques utilisees lors de l'edition des liens
 unix:QMAKE_LIBS_THREAD -= -lpthread
 unix|win32: PKGCONFIG += sqlite3
+unix|win32: PKGCONFIG += zlib
 
 # Enable C++17
 QMAKE_CXXFLAGS += -std=c++17
@@ -18,6 +18,10 @@
 
 #include "elementcollectionitem.h"
 
+#include "../NameList/nameslist.h"
+#include "../diagramcontext.h"
+#include "elementslocation.h"
+
 /**
 	@brief ElementCollectionItem::ElementCollectionItem
 	Constructor
@@ -35,6 +39,109 @@ void ElementCollectionItem::clearData()
 	setToolTip(QString());
 	setIcon(QIcon());
 	setData(QString());
+	setData(QVariant(), SearchFieldsRole);
+}
+
+/**
+	@brief ElementCollectionItem::canFetchMore
+	@return true if this item is a directory which have not yet
+	created its childs
+*/
+bool ElementCollectionItem::canFetchMore() const
+{
+	return isDir() && !m_populated;
+}
+
+/**
+	@brief ElementCollectionItem::fetchMore
+	Create the direct childs of this item, if not already done.
+	The childs of the childs are created when they are fetched.
+	@param set_data : if true, call setUpData for every created child
+*/
+void ElementCollectionItem::fetchMore(bool set_data)
+{
+	if (!canFetchMore())
+		return;
+
+	m_populated = true;
+	resetChildrenProbe();
+	populate(set_data);
+}
+
+/**
+	@brief ElementCollectionItem::hasChildrenToFetch
+	Used by the model to display the expand indicator of a directory
+	which have not yet created its childs.
+	Only the first child is looked up and the result is cached,
+	see probeChildren.
+	@return true if this item have at least one child to fetch
+*/
+bool ElementCollectionItem::hasChildrenToFetch() const
+{
+	if (!canFetchMore())
+		return false;
+
+	if (m_children_probe < 0)
+		m_children_probe = probeChildren() ? 1 : 0;
+
+	return m_children_probe == 1;
+}
+
+/**
+	@brief ElementCollectionItem::setElementHidden
+	Set if the elements are hidden, only the directories are created.
+	This is applied to every already created childs of this item
+	and is inherited by the childs created later.
+	@param hide
+*/
+void ElementCollectionItem::setElementHidden(bool hide)
+{
+	m_hide_element = hide;
+	resetChildrenProbe();
+
+	for (int i=rowCount()-1 ; i>=0 ; --i)
+	{
+		ElementCollectionItem *eci = static_cast<ElementCollectionItem *>(child(i));
+		if (hide && eci->isElement())
+			removeRow(i);
+		else
+			eci->setElementHidden(hide);
+	}
+}
+
+/**
+	@brief ElementCollectionItem::searchFields
+	The xml of the element is parsed only once for all the fields.
+	@param location : location of an element
+	@return the fields of the element used by the search :
+	"name" contain the names of the element in every languages,
+	one per line, and each element information is a field.
+*/
+QVariantHash ElementCollectionItem::searchFields(const ElementsLocation &location)
+{
+	QVariantHash fields;
+	if (!location.isElement()) {
+		return fields;
+	}
+
+	const auto document = location.pugiXml();
+	const auto root = document.document_element();
+
+	DiagramContext context;
+	context.fromXml(root.child("elementInformations"), "elementInformation");
+	for (const auto &key : context.keys()) {
+		fields.insert(key, context.value(key));
+	}
+
+	NamesList names;
+	names.fromXml(root);
+	QStringList names_list;
+	for (const auto &lang : names.langs()) {
+		names_list.append(names[lang]);
+	}
+	fields.insert(QStringLiteral("name"), names_list.join(QLatin1Char('\n')));
+
+	return fields;
 }
 
 /**
@@ -43,6 +150,8 @@ void ElementCollectionItem::clearData()
 	according to the given path.
 	Next_item is the first non existing item in this hierarchy according
 	to the given path.
+	The items of the path which have not yet created their childs
+	are fetched.
 	@param path : The path to find last item.
 	The path must be in form : path/otherPath/.../.../myElement.elmt.
 	@param no_found_path : The first item that not exist in this hierarchy
@@ -59,6 +168,7 @@ ElementCollectionItem *ElementCollectionItem::lastItemForPath(
 	ElementCollectionItem *return_eci = this;
 	foreach (QString str, str_list)
 	{
+		return_eci->fetchMore();
 		ElementCollectionItem *eci = return_eci->childWithCollectionName(str);
 		if (!eci)
 		{
@@ -145,6 +255,8 @@ int ElementCollectionItem::rowForInsertItem(const QString &name)
 
 /**
 	@brief ElementCollectionItem::itemAtPath
+	The items of the path which have not yet created their childs
+	are fetched.
 	@param path
 	@return the item at path or nullptr if doesn't exist
 */
@@ -156,6 +268,7 @@ ElementCollectionItem *ElementCollectionItem::itemAtPath(const QString &path)
 
 	ElementCollectionItem *match_eci = this;
 	foreach (QString str, str_list) {
+		match_eci->fetchMore();
 		ElementCollectionItem *eci = match_eci->childWithCollectionName(str);
 		if (!eci)
 			return nullptr;
@@ -233,6 +346,7 @@ QList<ElementCollectionItem *> ElementCollectionItem::directoriesChild() const
 /**
 	@brief ElementCollectionItem::items
 	@return every childs of this item (direct and indirect childs)
+	already created, see fetchMore
 */
 QList<ElementCollectionItem *> ElementCollectionItem::items() const
 {
@@ -20,11 +20,16 @@
 
 #include <QStandardItem>
 
+class ElementsLocation;
+
 /**
 	@brief The ElementCollectionItem class
 	This class represent a item (a directory or an element) in a element collection.
 	This class must be herited for specialisation.
 	This item is used by ElementsCollectionModel for manage the elements collection
+	The childs of a directory are created only when they are requested
+	(see fetchMore), the model create the childs of a directory
+	when the directory is expanded in a view.
 */
 class ElementCollectionItem : public QStandardItem
 {
@@ -34,6 +39,10 @@ class ElementCollectionItem : public QStandardItem
 		enum {Type = UserType+1};
 		int type() const override { return Type; }
 
+			///Data role of the fields indexed by ElementsSearchIndex
+		enum {SearchFieldsRole = Qt::UserRole+2};
+		static QVariantHash searchFields(const ElementsLocation &location);
+
 		virtual bool isDir() const = 0;
 		virtual bool isElement() const = 0;
 		virtual QString localName() = 0;
@@ -45,6 +54,12 @@ class ElementCollectionItem : public QStandardItem
 		virtual void setUpIcon() = 0;
 		virtual void clearData();
 
+		bool canFetchMore() const;
+		void fetchMore(bool set_data = true);
+		bool hasChildrenToFetch() const;
+		bool isElementHidden() const {return m_hide_element;}
+		void setElementHidden(bool hide);
+
 		ElementCollectionItem *lastItemForPath(const QString &path, QString &no_found_path);
 		ElementCollectionItem *childWithCollectionName(const QString& name) const;
 		QList<QStandardItem *> directChilds() const;
@@ -56,6 +71,18 @@ class ElementCollectionItem : public QStandardItem
 		QList<ElementCollectionItem *> elementsChild() const;
 		QList<ElementCollectionItem *> directoriesChild() const;
 		QList<ElementCollectionItem *> items() const;
+
+	protected:
+		virtual void populate(bool set_data) = 0;
+		virtual bool probeChildren() const = 0;
+		void resetChildrenProbe() {m_children_probe = -1;}
+
+	protected:
+		bool m_populated = false;
+		bool m_hide_element = false;
+
+	private:
+		mutable int m_children_probe = -1;
 };
 
 void setUpData(ElementCollectionItem *eci);
@@ -25,12 +25,19 @@
 #include "xmlelementcollection.h"
 #include "xmlprojectelementcollectionitem.h"
 
+#include <QDir>
+#include <QDirIterator>
+#include <QSet>
 #include <QFutureWatcher>
-#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0) // ### Qt 6: remove
+#include <QThread>
 #include <QtConcurrentMap>
-#else
 #include <QtConcurrentRun>
-#endif
+
+namespace
+{
+		///Every model alive, used by the memory report, see searchIndexes()
+	QSet<ElementsCollectionModel *> s_models;
+}
 
 /**
 	@brief ElementsCollectionModel::ElementsCollectionModel
@@ -40,6 +47,24 @@
 ElementsCollectionModel::ElementsCollectionModel(QObject *parent) :
 	QStandardItemModel(parent)
 {
+		//Direct connection, the data of the items are set up by worker threads
+		//while loading, see updateSearchIndex
+	connect(this, &QStandardItemModel::dataChanged,
+		this, &ElementsCollectionModel::updateSearchIndex,
+		Qt::DirectConnection);
+	connect(this, &QStandardItemModel::rowsAboutToBeRemoved,
+		this, &ElementsCollectionModel::removeFromSearchIndex);
+	connect(this, &QStandardItemModel::modelAboutToBeReset,
+		this, [this]() {m_search_index.clear();});
+	s_models.insert(this);
+}
+
+/**
+	@brief ElementsCollectionModel::~ElementsCollectionModel
+*/
+ElementsCollectionModel::~ElementsCollectionModel()
+{
+	s_models.remove(this);
 }
 
 /**
@@ -63,6 +88,59 @@ QVariant ElementsCollectionModel::data(const QModelIndex &index, int role) const
 	return QStandardItemModel::data(index, role);
 }
 
+/**
+	@brief ElementsCollectionModel::hasChildren
+	Reimplemented from QStandardItemModel
+	A directory which have not yet created its childs have no row,
+	ask to the item if there is something to fetch, so the view
+	can display the expand indicator.
+	@param parent
+	@return
+*/
+bool ElementsCollectionModel::hasChildren(const QModelIndex &parent) const
+{
+	if (parent.isValid())
+	{
+		ElementCollectionItem *eci = static_cast<ElementCollectionItem *>(itemFromIndex(parent));
+		if (eci && eci->canFetchMore())
+			return eci->hasChildrenToFetch();
+	}
+
+	return QStandardItemModel::hasChildren(parent);
+}
+
+/**
+	@brief ElementsCollectionModel::canFetchMore
+	Reimplemented from QStandardItemModel
+	@param parent
+	@return true if the childs of parent are not yet created
+*/
+bool ElementsCollectionModel::canFetchMore(const QModelIndex &parent) const
+{
+	if (!parent.isValid())
+		return false;
+
+	ElementCollectionItem *eci = static_cast<ElementCollectionItem *>(itemFromIndex(parent));
+	return eci && eci->canFetchMore();
+}
+
+/**
+	@brief ElementsCollectionModel::fetchMore
+	Reimplemented from QStandardItemModel
+	Create the direct childs of parent, called by the view
+	when parent is expanded.
+	@param parent
+*/
+void ElementsCollectionModel::fetchMore(const QModelIndex &parent)
+{
+	if (!parent.isValid())
+		return;
+
+	ElementCollectionItem *eci = static_cast<ElementCollectionItem *>(itemFromIndex(parent));
+	if (eci)
+		eci->fetchMore();
+}
+
 /**
 	@brief ElementsCollectionModel::mimeData
 	Reimplemented from QStandardItemModel
@@ -254,6 +332,8 @@ bool ElementsCollectionModel::dropMimeData(const QMimeData *data,
 	Prefer use this method instead of addCommonCollection,
 	addCustomCollection and addProject,
 	because it use multithreading to speed up the loading.
+	Only the root of each collection is created, the directories
+	are populated when they are fetched, see fetchMore.
 	This method emit loadingProgressRangeChanged(int, int)
 	for know the minimu and maximum progress value
 	This method emit loadingProgressValueChanged(int)
@@ -268,6 +348,7 @@ void ElementsCollectionModel::loadCollections(bool common_collection,
 						  bool custom_collection,
 						  QList<QETProject *> projects)
 {
+	ElementsLocation::invalidateCache();
 	m_items_list_to_setUp.clear();
 
 	if (common_collection)
@@ -286,6 +367,19 @@ void ElementsCollectionModel::loadCollections(bool common_collection,
 		addProject(project, false);
 		m_items_list_to_setUp.append(projectItems(project));
 	}
+
+		//The elements of the file collections are indexed from the
+		//files, in background, see search
+	QVector<QPair<QString, QString>> directories;
+	if (common_collection)
+		directories.append(qMakePair(QETApp::commonElementsDirN(), QStringLiteral("common://")));
+	if (company_collection)
+		directories.append(qMakePair(QETApp::companyElementsDirN(), QStringLiteral("company://")));
+	if (custom_collection)
+		directories.append(qMakePair(QETApp::customElementsDirN(), QStringLiteral("custom://")));
+	if (!directories.isEmpty())
+		indexDirectories(directories);
+
 	auto *watcher = new QFutureWatcher<void>();
 	connect(watcher, &QFutureWatcher<void>::progressValueChanged,
 		this, &ElementsCollectionModel::loadingProgressValueChanged);
@@ -319,7 +413,6 @@ void ElementsCollectionModel::addCommonCollection(bool set_data)
 {
 	FileElementCollectionItem *feci = new FileElementCollectionItem();
 	if (feci->setRootPath(QETApp::commonElementsDirN(),
-				  set_data,
 				  m_hide_element)) {
 		invisibleRootItem()->appendRow(feci);
 		if (set_data)
@@ -338,7 +431,6 @@ void ElementsCollectionModel::addCompanyCollection(bool set_data)
 {
 	FileElementCollectionItem *feci = new FileElementCollectionItem();
 	if (feci->setRootPath(QETApp::companyElementsDirN(),
-				  set_data,
 				  m_hide_element)) {
 		invisibleRootItem()->appendRow(feci);
 		if (set_data)
@@ -357,7 +449,6 @@ void ElementsCollectionModel::addCustomCollection(bool set_data)
 {
 	FileElementCollectionItem *feci = new FileElementCollectionItem();
 	if (feci->setRootPath(QETApp::customElementsDirN(),
-				  set_data,
 				  m_hide_element)) {
 		invisibleRootItem()->appendRow(feci);
 		if (set_data)
@@ -426,7 +517,8 @@ void ElementsCollectionModel::addLocation(const ElementsLocation& location)
 	Add project to this model
 	@param project : project to add.
 	@param set_data :
-	if true, setUpData is called for every ElementCollectionItem of project
+	if true, setUpData is called for the root item of project,
+	the childs are set up when they are fetched.
 */
 void ElementsCollectionModel::addProject(QETProject *project, bool set_data)
 {
@@ -438,10 +530,11 @@ void ElementsCollectionModel::addProject(QETProject *project, bool set_data)
 	XmlProjectElementCollectionItem *xpeci = new XmlProjectElementCollectionItem();
 	m_project_hash.insert(project, xpeci);
 
-	xpeci->setProject(project, set_data);
+	xpeci->setProject(project, m_hide_element);
 	insertRow(row, xpeci);
 	if (set_data)
 		xpeci->setUpData();
+	indexProject(project);
 	connect(project->embeddedElementCollection(),
 		&XmlElementCollection::elementAdded,
 		this, &ElementsCollectionModel::elementIntegratedToCollection);
@@ -566,11 +659,8 @@ QList<ElementCollectionItem *> ElementsCollectionModel::projectItems(
 void ElementsCollectionModel::hideElement()
 {
 	m_hide_element = true;
-	foreach(ElementCollectionItem *eci, items()) {
-		if (eci->isElement()) {
-			removeRow(eci->row(), indexFromItem(eci).parent());
-		}
-	}
+	for (int i=0 ; i<rowCount() ; i++)
+		static_cast<ElementCollectionItem *>(item(i))->setElementHidden(true);
 }
 
 /**
@@ -597,7 +687,7 @@ QModelIndex ElementsCollectionModel::indexFromLocation(
 				if (FileElementCollectionItem *feci = static_cast<FileElementCollectionItem *>(eci)) {
 					if ( (location.isCommonCollection() && feci->isCommonCollection()) ||
 						 (location.isCompanyCollection() && feci->isCompanyCollection()) ||
-						 (location.isCustomCollection() && !feci->isCommonCollection()) ) {
+						 (location.isCustomCollection() && feci->isCustomCollection()) ) {
 						match_eci = feci->itemAtPath(location.collectionPath(false));
 					}
 				}
@@ -615,6 +705,262 @@ QModelIndex ElementsCollectionModel::indexFromLocation(
 		return QModelIndex();
 }
 
+/**
+	@brief ElementsCollectionModel::fetchAll
+	Create every items of the subtree of @a parent which are not yet created.
+	The structure is created by this thread, the data of the new items are
+	set up by worker threads.
+	The search doesn't need it, see search.
+	@param parent : the root of the subtree, the whole model if not valid
+*/
+void ElementsCollectionModel::fetchAll(const QModelIndex &parent)
+{
+	QList <ElementCollectionItem *> to_fetch;
+	if (parent.isValid())
+		to_fetch.append(static_cast<ElementCollectionItem *>(itemFromIndex(parent)));
+	else
+		for (int i=0 ; i<rowCount() ; i++)
+			to_fetch.append(static_cast<ElementCollectionItem *>(item(i)));
+
+	QList <ElementCollectionItem *> fetched;
+	while (!to_fetch.isEmpty())
+	{
+		ElementCollectionItem *eci = to_fetch.takeLast();
+		const bool can_fetch = eci->canFetchMore();
+		eci->fetchMore(false);
+
+		for (int i=0 ; i<eci->rowCount() ; i++)
+		{
+			ElementCollectionItem *child = static_cast<ElementCollectionItem *>(eci->child(i));
+			if (can_fetch)
+				fetched.append(child);
+			if (child->isDir())
+				to_fetch.append(child);
+		}
+	}
+
+	if (fetched.isEmpty())
+		return;
+
+	QtConcurrent::blockingMap(fetched, setUpData);
+
+		//The changes done by the worker threads are ignored by
+		//updateSearchIndex, the new fields are indexed now
+	for (const auto &eci : qAsConst(fetched))
+	{
+		if (!eci->isElement()) {
+			continue;
+		}
+		const auto fields = eci->data(ElementCollectionItem::SearchFieldsRole).toHash();
+		if (!fields.isEmpty()) {
+			m_search_index.insert(itemLocation(eci), fields);
+		}
+	}
+}
+
+/**
+	@brief ElementsCollectionModel::search
+	Search the elements in the subtree of @a parent
+	with the search index of this model.
+	The index is built from the definitions, only the items of the found
+	elements (and their parent directories) are created.
+	The elements of the file collections are indexed in background
+	when the collections are loaded, searchIndexChanged is emitted
+	when they are added to the index.
+	@param text : the searched text, see ElementsSearchIndex for the syntax
+	@param parent : the root of the search, the whole model if not valid
+	@return the index of the found elements
+*/
+QModelIndexList ElementsCollectionModel::search(const QString &text,
+						const QModelIndex &parent)
+{
+	ElementsLocation root;
+	QString prefix;
+	if (parent.isValid())
+	{
+		root = itemLocation(static_cast<ElementCollectionItem *>(itemFromIndex(parent)));
+		prefix = root.collectionPath();
+		if (!prefix.endsWith(QLatin1Char('/'))) {
+			prefix.append(QLatin1Char('/'));
+		}
+	}
+
+	QModelIndexList list;
+	for (const auto &location : m_search_index.search(text))
+	{
+		if (parent.isValid() &&
+			(location.project() != root.project() ||
+			 !location.collectionPath().startsWith(prefix))) {
+			continue;
+		}
+
+		const QModelIndex index = indexFromLocation(location);
+		if (index.isValid()) {
+			list.append(index);
+		}
+	}
+
+	return list;
+}
+
+/**
+	@brief ElementsCollectionModel::itemLocation
+	@param eci
+	@return the location represented by @a eci
+*/
+ElementsLocation ElementsCollectionModel::itemLocation(ElementCollectionItem *eci) const
+{
+	if (eci->type() == XmlProjectElementCollectionItem::Type)
+	{
+		auto xpeci = static_cast<XmlProjectElementCollectionItem *>(eci);
+		return ElementsLocation(xpeci->embeddedPath(), xpeci->project());
+	}
+
+	return ElementsLocation(eci->collectionPath());
+}
+
+/**
+	@brief ElementsCollectionModel::indexDirectories
+	Index the element files of @a directories in a worker thread,
+	the result is merged to the search index of this model when finished.
+	@param directories : list of directory and protocol of the collection
+	("common://", "company://" or "custom://")
+*/
+void ElementsCollectionModel::indexDirectories(
+		const QVector<QPair<QString, QString>> &directories)
+{
+	auto *watcher = new QFutureWatcher<ElementsSearchIndex>(this);
+	connect(watcher, &QFutureWatcher<ElementsSearchIndex>::finished,
+		this, [this, watcher]()
+	{
+		m_search_index.merge(watcher->result());
+		watcher->deleteLater();
+		emit searchIndexChanged();
+	});
+
+	watcher->setFuture(QtConcurrent::run([directories]()
+	{
+		ElementsSearchIndex index;
+		for (const auto &directory : directories)
+		{
+			const QDir root(directory.first);
+			QDirIterator it(directory.first,
+					QStringList(QStringLiteral("*.elmt")),
+					QDir::Files,
+					QDirIterator::Subdirectories);
+			while (it.hasNext())
+			{
+				const ElementsLocation location(directory.second
+								+ root.relativeFilePath(it.next()));
+				index.insert(location,
+						 ElementCollectionItem::searchFields(location));
+			}
+		}
+		return index;
+	}));
+}
+
+/**
+	@brief ElementsCollectionModel::indexProject
+	Index the elements embedded in @a project.
+	The embedded collection is a dom document owned by the project,
+	it is read by this thread.
+	@param project
+*/
+void ElementsCollectionModel::indexProject(QETProject *project)
+{
+	const auto locations = project->embeddedElementCollection()->elementsLocation();
+	for (const auto &location : locations)
+	{
+		if (location.isElement()) {
+			m_search_index.insert(location,
+						  ElementCollectionItem::searchFields(location));
+		}
+	}
+}
+
+/**
+	@brief ElementsCollectionModel::searchIndexes
+	@return the search index of every model alive.
+	The indexes are only modified by the thread of their model,
+	they must be read from the gui thread.
+*/
+QList<const ElementsSearchIndex *> ElementsCollectionModel::searchIndexes()
+{
+	QList<const ElementsSearchIndex *> list;
+	for (const auto &model : qAsConst(s_models)) {
+		list << &model->m_search_index;
+	}
+	return list;
+}
+
+/**
+	@brief ElementsCollectionModel::updateSearchIndex
+	Update the search index when the search fields of an item change.
+	The index is not thread safe : the changes done by the worker threads
+	while loading are ignored, the index is rebuilt when the loading is finished.
+	@param top_left
+	@param bottom_right
+	@param roles
+*/
+void ElementsCollectionModel::updateSearchIndex(const QModelIndex &top_left,
+						const QModelIndex &bottom_right,
+						const QVector<int> &roles)
+{
+	if (QThread::currentThread() != thread()) {
+		return;
+	}
+	if (!roles.isEmpty() &&
+		!roles.contains(ElementCollectionItem::SearchFieldsRole)) {
+		return;
+	}
+
+	for (int row = top_left.row() ; row <= bottom_right.row() ; ++row)
+	{
+		auto eci = static_cast<ElementCollectionItem *>(
+					   itemFromIndex(index(row, 0, top_left.parent())));
+		if (!eci || !eci->isElement()) {
+			continue;
+		}
+
+		const auto fields = eci->data(ElementCollectionItem::SearchFieldsRole).toHash();
+		if (fields.isEmpty()) {
+			m_search_index.remove(itemLocation(eci));
+		} else {
+			m_search_index.insert(itemLocation(eci), fields);
+		}
+	}
+}
+
+/**
+	@brief ElementsCollectionModel::removeFromSearchIndex
+	Remove the locations of the items about to be removed from the
+	search index, a directory remove every element it contain,
+	even those not yet fetched.
+	When the elements are hidden, the rows of the elements are removed
+	but the elements still exist, the index is kept.
+	@param parent
+	@param first
+	@param last
+*/
+void ElementsCollectionModel::removeFromSearchIndex(const QModelIndex &parent,
+						   int first,
+						   int last)
+{
+	if (m_hide_element) {
+		return;
+	}
+
+	for (int row = first ; row <= last ; ++row)
+	{
+		auto eci = static_cast<ElementCollectionItem *>(
+					   itemFromIndex(index(row, 0, parent)));
+		if (eci) {
+			m_search_index.remove(itemLocation(eci));
+		}
+	}
+}
+
 /**
 	@brief ElementsCollectionModel::elementIntegratedToCollection
 	When an element is added to embedded collection of a project,
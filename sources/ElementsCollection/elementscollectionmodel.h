@@ -21,6 +21,7 @@
 #include <QStandardItemModel>
 #include <QHash>
 #include "elementslocation.h"
+#include "elementssearchindex.h"
 
 class XmlProjectElementCollectionItem;
 class ElementCollectionItem;
@@ -35,8 +36,12 @@ class ElementsCollectionModel : public QStandardItemModel
 
 	public:
 		ElementsCollectionModel(QObject *parent = Q_NULLPTR);
+		~ElementsCollectionModel() override;
 
 		QVariant data(const QModelIndex &index, int role) const override;
+		bool hasChildren(const QModelIndex &parent = QModelIndex()) const override;
+		bool canFetchMore(const QModelIndex &parent) const override;
+		void fetchMore(const QModelIndex &parent) override;
 		QMimeData *mimeData(const QModelIndexList &indexes) const override;
 		QStringList mimeTypes() const override;
 		bool canDropMimeData(const QMimeData *data, Qt::DropAction action, int row, int column, const QModelIndex &parent) const override;
@@ -60,16 +65,27 @@ class ElementsCollectionModel : public QStandardItemModel
 		void hideElement();
 		bool isHideElement() {return m_hide_element;}
 		QModelIndex indexFromLocation(const ElementsLocation &location);
+		void fetchAll(const QModelIndex &parent = QModelIndex());
+		QModelIndexList search(const QString &text, const QModelIndex &parent = QModelIndex());
+		static QList<const ElementsSearchIndex *> searchIndexes();
 
 	signals:
 		void loadingProgressValueChanged(int);
 		void loadingProgressRangeChanged(int, int);
 		void loadingFinished();
+		void searchIndexChanged();
 
 	private:
 		void elementIntegratedToCollection (const QString& path);
 		void itemRemovedFromCollection (const QString& path);
 		void updateItem (const QString& path);
+		ElementsLocation itemLocation(ElementCollectionItem *eci) const;
+		void indexDirectories(const QVector<QPair<QString, QString>> &directories);
+		void indexProject(QETProject *project);
+		void updateSearchIndex(const QModelIndex &top_left,
+							   const QModelIndex &bottom_right,
+							   const QVector<int> &roles);
+		void removeFromSearchIndex(const QModelIndex &parent, int first, int last);
 
 	private:
 		QList <QETProject *> m_project_list;
@@ -77,6 +93,7 @@ class ElementsCollectionModel : public QStandardItemModel
 		bool m_hide_element = false;
 		QFuture<void> m_future;
 		QList <ElementCollectionItem *> m_items_list_to_setUp;
+		ElementsSearchIndex m_search_index;
 };
 
 #endif // ELEMENTSCOLLECTIONMODEL2_H
@@ -596,6 +596,9 @@ void ElementsCollectionWidget::dirProperties()
 
 	if (eci && eci->isDir())
 	{
+			//The counts below need every child of the directory
+		m_model->fetchAll(m_index_at_context_menu);
+
 		QString filePath;
 		if (eci->type() == FileElementCollectionItem::Type) {
 			filePath = tr("Chemin dans le système de fichiers :  %1")
@@ -660,6 +663,17 @@ void ElementsCollectionWidget::reload()
 		&ElementsCollectionModel::loadingFinished,
 		this,
 		&ElementsCollectionWidget::loadingFinished);
+		//The file collections are indexed in background,
+		//the current search is done again with the complete index
+	ElementsCollectionModel *model = m_new_model;
+	connect(m_new_model,
+		&ElementsCollectionModel::searchIndexChanged,
+		this,
+		[this, model]()
+	{
+		if (model == m_model && !m_search_field->text().isEmpty())
+			search();
+	});
 
 	m_new_model->loadCollections(true, true, true, project_list);
 }
@@ -765,25 +779,10 @@ void ElementsCollectionWidget::search()
 	}
 
 	hideCollection(true);
-#if QT_VERSION < QT_VERSION_CHECK(5, 14, 0)	// ### Qt 6: remove
-	const QStringList text_list = text.split("+", QString::SkipEmptyParts);
-#else
-#if TODO_LIST
-#pragma message("@TODO remove code for QT 5.14 or later")
-#endif
-	const QStringList text_list = text.split("+", Qt::SkipEmptyParts);
-#endif
-	QModelIndexList match_index;
-	for (QString txt : text_list) {
-		match_index << m_model->match(m_showed_index.isValid()
-						  ? m_model->index(0,0,m_showed_index)
-						  : m_model->index(0,0),
-						  Qt::UserRole+1,
-						  QVariant(txt),
-						  -1,
-						  Qt::MatchContains
-						  | Qt::MatchRecursive);
-	}
+		//The terms separated by '+' are searched in the trigram index
+		//of the model, see ElementsSearchIndex, only the items of
+		//the found elements are created.
+	const QModelIndexList match_index = m_model->search(text, m_showed_index);
 
 	for(QModelIndex index : match_index)
 		showAndExpandItem(index);
@@ -25,7 +25,307 @@
 #include "../qetxml.h"
 #include "xmlelementcollection.h"
 
+#include <QMutex>
 #include <QPicture>
+#include <QReadWriteLock>
+
+/**
+	@brief The ElementsLocationData class
+	The resolved content of an ElementsLocation.
+	Every location with the same paths and project share the same data,
+	interned in the table of the process and never deleted,
+	so an ElementsLocation can keep a pointer to it.
+*/
+class ElementsLocationData
+{
+	public:
+		QString m_collection_path;
+		QString m_collection_path_without_protocol;
+		QString m_file_system_path;
+		QETProject *m_project = nullptr;
+		bool m_is_element = false;
+
+			/// Existence of the location in the project collection,
+			/// generation of the cache * 2 + exist, see ElementsLocation::exist()
+		mutable QAtomicInt m_exist;
+			/// Uuid of the element and generation of the cache when read,
+			/// protected by the mutex of the table
+		mutable QUuid m_uuid;
+		mutable int m_uuid_generation = 0;
+};
+
+namespace
+{
+		///Approximate size of a node of a QHash, without its key and value
+	const qint64 HASH_NODE_OVERHEAD = 2 * sizeof(void *) + sizeof(uint);
+
+		/**
+			Key of an interned ElementsLocationData
+		*/
+	struct DataKey
+	{
+		QString collection_path;
+		QString file_system_path;
+		QETProject *project;
+
+		bool operator==(const DataKey &other) const {
+			return collection_path == other.collection_path &&
+					file_system_path == other.file_system_path &&
+					project == other.project;
+		}
+
+		friend inline uint qHash(const DataKey &key, uint seed = 0) {
+			return qHash(key.collection_path, seed) ^
+					qHash(key.file_system_path, seed) ^
+					qHash(key.project, seed);
+		}
+	};
+
+		/**
+			Key of an already resolved path :
+			the path given to ElementsLocation::setPath
+			and the data of the location before the call
+		*/
+	struct ResolveKey
+	{
+		QString path;
+		const ElementsLocationData *previous;
+
+		bool operator==(const ResolveKey &other) const {
+			return path == other.path && previous == other.previous;
+		}
+
+		friend inline uint qHash(const ResolveKey &key, uint seed = 0) {
+			return qHash(key.path, seed) ^ qHash(key.previous, seed);
+		}
+	};
+
+		/**
+			The table of the interned ElementsLocationData
+			and of the paths already resolved.
+			Used by the gui thread and by the threads which load the collections.
+		*/
+	class LocationTable
+	{
+		public:
+			LocationTable() {
+				m_empty = intern(QString(), QString(), nullptr);
+			}
+
+			const ElementsLocationData *empty() const {
+				return m_empty;
+			}
+
+			const ElementsLocationData *intern(const QString &collection_path,
+											   const QString &file_system_path,
+											   QETProject *project)
+			{
+				const DataKey key{collection_path, file_system_path, project};
+				{
+					QReadLocker locker(&m_lock);
+					if (auto data = m_data.value(key)) {
+						return data;
+					}
+				}
+
+				QWriteLocker locker(&m_lock);
+				if (auto data = m_data.value(key)) {
+					return data;
+				}
+
+				auto data = new ElementsLocationData();
+				data->m_collection_path = collection_path;
+				data->m_collection_path_without_protocol = QString(collection_path)
+						.remove(QRegularExpression(QStringLiteral("common://|company://|custom://|embed://")));
+				data->m_file_system_path = file_system_path;
+				data->m_project = project;
+				data->m_is_element = collection_path.endsWith(QLatin1String(".elmt"));
+				m_data.insert(key, data);
+				return data;
+			}
+
+			const ElementsLocationData *resolved(const ResolveKey &key) const
+			{
+				QReadLocker locker(&m_lock);
+				return m_resolved.value(key);
+			}
+
+			void insertResolved(const ResolveKey &key, const ElementsLocationData *data)
+			{
+				QWriteLocker locker(&m_lock);
+				m_resolved.insert(key, data);
+			}
+
+			void clearResolved()
+			{
+				QWriteLocker locker(&m_lock);
+				m_resolved.clear();
+			}
+
+			ElementsLocation::CacheStatistics statistics() const
+			{
+				ElementsLocation::CacheStatistics stats;
+				QReadLocker locker(&m_lock);
+
+					//The strings of the keys are shared with the data
+				stats.locations = m_data.size();
+				for (const auto &data : m_data)
+				{
+					stats.locations_bytes += sizeof(ElementsLocationData) + sizeof(DataKey)
+							+ sizeof(void *) + HASH_NODE_OVERHEAD
+							+ (data->m_collection_path.capacity()
+							   + data->m_collection_path_without_protocol.capacity()
+							   + data->m_file_system_path.capacity()) * sizeof(QChar);
+				}
+
+				stats.resolved_paths = m_resolved.size();
+				for (auto it = m_resolved.constBegin() ; it != m_resolved.constEnd() ; ++it)
+				{
+					stats.resolved_paths_bytes += sizeof(ResolveKey) + sizeof(void *)
+							+ HASH_NODE_OVERHEAD
+							+ it.key().path.capacity() * sizeof(QChar);
+				}
+				return stats;
+			}
+
+			QAtomicInt m_generation = 1;
+			QMutex m_uuid_mutex;
+
+		private:
+			mutable QReadWriteLock m_lock;
+			QHash<DataKey, const ElementsLocationData *> m_data;
+			QHash<ResolveKey, const ElementsLocationData *> m_resolved;
+			const ElementsLocationData *m_empty = nullptr;
+	};
+
+		/**
+			The table is never deleted, because the locations
+			can be used until the very end of the process.
+		*/
+	LocationTable &table()
+	{
+		static LocationTable *table_ = new LocationTable();
+		return *table_;
+	}
+
+		/**
+			Resolve @a path as described by ElementsLocation::setPath.
+			@a collection_path, @a file_system_path and @a project are
+			the values of the location before the call, and are modified.
+			@return false if the result depends on the registered projects,
+			and so can't be kept in the table.
+		*/
+	bool resolvePath(const QString &path,
+					 QString &collection_path,
+					 QString &file_system_path,
+					 QETProject *&project)
+	{
+		QString tmp_path = path;
+#ifdef Q_OS_WIN32
+			//On windows, we convert backslash to slash
+		tmp_path = QDir::fromNativeSeparators(path);
+
+#endif
+
+		//There is a project, the path is for an embedded coolection.
+		if (project)
+		{
+			collection_path = path;
+			//Add the protocol to the collection path
+			if (!path.startsWith("embed://"))
+				collection_path.prepend("embed://");
+
+		}
+
+		//The path start with project, we get the project and the path from the string
+		else if (tmp_path.startsWith("project"))
+		{
+			static const QRegularExpression re
+				("^project(?<project_id>[0-9])\\+(?<collection_path>embed://*.*)$");
+			if (!re.isValid())
+			{
+				qWarning() <<QObject::tr("this is an error in the code")
+					  << re.errorString()
+					  << re.patternErrorOffset();
+				return false;
+			}
+			QRegularExpressionMatch match = re.match(tmp_path);
+			if (!match.hasMatch())
+			{
+				qDebug()<<"no Match => return"
+					   <<tmp_path;
+				return false;
+			}
+			bool conv_ok;
+			uint project_id = match.captured("project_id").toUInt(&conv_ok);
+			if (!conv_ok)
+			{
+				qWarning()<<"toUint failed"
+					 <<match.captured("project_id")
+					 <<re
+					 <<tmp_path;
+				return false;
+			}
+			QETProject *project_ = QETApp::project(project_id);
+			if (project_)
+			{
+				collection_path = match.captured("collection_path");
+				project = project_;
+			}
+			return false;
+		}
+
+		// The path is in file system,
+		// the given path is relative to common or custom collection
+		else if (path.startsWith("common://") || path.startsWith("company://") || path.startsWith("custom://"))
+		{
+			QString p;
+			if (path.startsWith("common://"))
+			{
+				tmp_path.remove("common://");
+				p = QETApp::commonElementsDirN() % "/" % tmp_path;
+			}
+			else if (path.startsWith("company://"))
+			{
+				tmp_path.remove("company://");
+				p = QETApp::companyElementsDirN() % "/" % tmp_path;
+			}
+			else
+			{
+				tmp_path.remove("custom://");
+				p = QETApp::customElementsDirN() % "/" % tmp_path;
+			}
+
+			file_system_path = p;
+			collection_path = path;
+		}
+		//In this case, the path is supposed to be relative to the file system.
+		else
+		{
+			QString path_ = path;
+			file_system_path = path_;
+			if (path_.startsWith(QETApp::commonElementsDirN()))
+			{
+				path_.remove(QETApp::commonElementsDirN()+="/");
+				path_.prepend("common://");
+				collection_path = path_;
+			}
+			else if (path_.startsWith(QETApp::companyElementsDirN()))
+			{
+				path_.remove(QETApp::companyElementsDirN()+="/");
+				path_.prepend("company://");
+				collection_path = path_;
+			}
+			else if (path_.startsWith(QETApp::customElementsDirN()))
+			{
+				path_.remove(QETApp::customElementsDirN()+="/");
+				path_.prepend("custom://");
+				collection_path = path_;
+			}
+		}
+		return true;
+	}
+}
 
 // make this class usable with QVariant
 int ElementsLocation::MetaTypeId = qRegisterMetaType<ElementsLocation>("ElementsLocation");
@@ -34,7 +334,8 @@ int ElementsLocation::MetaTypeId = qRegisterMetaType<ElementsLocation>("Elements
 	@brief ElementsLocation::ElementsLocation
 	Constructor
 */
-ElementsLocation::ElementsLocation()
+ElementsLocation::ElementsLocation() :
+	m_data(table().empty())
 {}
 
 /**
@@ -45,7 +346,8 @@ ElementsLocation::ElementsLocation()
 	\~French Projet de l'emplacement de l'element
 */
 ElementsLocation::ElementsLocation(const QString &path, QETProject *project) :
-	m_project(project)
+	m_data(project ? table().intern(QString(), QString(), project)
+				   : table().empty())
 {
 	setPath(path);
 }
@@ -66,9 +368,7 @@ ElementsLocation::~ElementsLocation()
 	\~French Autre emplacement d'element a copier
 */
 ElementsLocation::ElementsLocation(const ElementsLocation &other) :
-	m_collection_path(other.m_collection_path),
-	m_file_system_path(other.m_file_system_path),
-	m_project(other.m_project)
+	m_data(other.m_data)
 {}
 
 /**
@@ -79,7 +379,8 @@ ElementsLocation::ElementsLocation(const ElementsLocation &other) :
 	This location can be null even if format is valid.
 	@param data
 */
-ElementsLocation::ElementsLocation(const QMimeData *data)
+ElementsLocation::ElementsLocation(const QMimeData *data) :
+	m_data(table().empty())
 {
 	if (data->hasFormat("application/x-qet-element-uri")
 			|| data->hasFormat("application/x-qet-category-uri"))
@@ -96,9 +397,7 @@ ElementsLocation::ElementsLocation(const QMimeData *data)
 	\~ @return *this ElementsLocation
 */
 ElementsLocation &ElementsLocation::operator=(const ElementsLocation &other) {
-	m_collection_path = other.m_collection_path;
-	m_file_system_path = other.m_file_system_path;
-	m_project = other.m_project;
+	m_data = other.m_data;
 	return(*this);
 }
 
@@ -115,8 +414,9 @@ ElementsLocation &ElementsLocation::operator=(const ElementsLocation &other) {
 bool ElementsLocation::operator==(const ElementsLocation &other) const
 {
 	return(
-		m_collection_path == other.m_collection_path &&\
-		m_project == other.m_project
+		m_data == other.m_data ||
+		(m_data->m_collection_path == other.m_data->m_collection_path &&
+		 m_data->m_project == other.m_data->m_project)
 	);
 }
 
@@ -129,10 +429,7 @@ bool ElementsLocation::operator==(const ElementsLocation &other) const
 */
 bool ElementsLocation::operator!=(const ElementsLocation &other) const
 {
-	return(
-		m_collection_path != other.m_collection_path ||\
-		m_project != other.m_project
-	);
+	return(!(*this == other));
 }
 
 /**
@@ -154,11 +451,11 @@ QString ElementsLocation::baseName() const
 		return QString();
 	}
 
-	QRegularExpressionMatch match = regexp.match(m_collection_path);
+	QRegularExpressionMatch match = regexp.match(m_data->m_collection_path);
 	if (!match.hasMatch())
 	{
 		qDebug()<<"no Match => return"
-			<<m_collection_path;
+			<<m_data->m_collection_path;
 		return QString();
 	}
 	return match.captured("name");
@@ -177,12 +474,9 @@ QString ElementsLocation::baseName() const
 QString ElementsLocation::collectionPath(bool protocol) const
 {
 	if (protocol)
-		return m_collection_path;
+		return m_data->m_collection_path;
 	else
-	{
-		QString path = m_collection_path;
-		return path.remove(QRegularExpression("common://|company://|custom://|embed://"));
-	}
+		return m_data->m_collection_path_without_protocol;
 }
 
 /**
@@ -196,7 +490,7 @@ QString ElementsLocation::projectCollectionPath() const
 		return QString();
 	else
 		return QString("project"
-				   % QString::number(QETApp::projectId(m_project))
+				   % QString::number(QETApp::projectId(m_data->m_project))
 				   % "+"
 				   % collectionPath());
 }
@@ -209,8 +503,8 @@ QString ElementsLocation::projectCollectionPath() const
 */
 QString ElementsLocation::fileSystemPath() const
 {
-	if (!m_project)
-		return m_file_system_path;
+	if (!m_data->m_project)
+		return m_data->m_file_system_path;
 	else
 		return QString();
 }
@@ -222,7 +516,7 @@ QString ElementsLocation::fileSystemPath() const
 */
 QString ElementsLocation::path() const
 {
-	return(m_collection_path);
+	return(m_data->m_collection_path);
 }
 
 /**
@@ -234,132 +528,22 @@ QString ElementsLocation::path() const
 */
 void ElementsLocation::setPath(const QString &path)
 {
-	QString tmp_path = path;
-#ifdef Q_OS_WIN32
-		//On windows, we convert backslash to slash
-	tmp_path = QDir::fromNativeSeparators(path);
-
-#endif
-
-	//There is a project, the path is for an embedded coolection.
-	if (m_project)
+	auto &table_ = table();
+	const ResolveKey key{path, m_data};
+	if (auto data = table_.resolved(key))
 	{
-		m_collection_path = path;
-		//Add the protocol to the collection path
-		if (!path.startsWith("embed://"))
-			m_collection_path.prepend("embed://");
-
+		m_data = data;
+		return;
 	}
 
-	//The path start with project, we get the project and the path from the string
-	else if (tmp_path.startsWith("project"))
-	{
-		QRegularExpression re
-			("^project(?<project_id>[0-9])\\+(?<collection_path>embed://*.*)$");
-		if (!re.isValid())
-		{
-			qWarning() <<QObject::tr("this is an error in the code")
-				  << re.errorString()
-				  << re.patternErrorOffset();
-			return;
-		}
-		QRegularExpressionMatch match = re.match(tmp_path);
-		if (!match.hasMatch())
-		{
-			qDebug()<<"no Match => return"
-				   <<tmp_path;
-			return;
-		}
-		bool conv_ok;
-		uint project_id = match.captured("project_id").toUInt(&conv_ok);
-		if (!conv_ok)
-		{
-			qWarning()<<"toUint failed"
-				 <<match.captured("project_id")
-				 <<re
-				 <<tmp_path;
-			return;
-		}
-		QETProject *project = QETApp::project(project_id);
-		if (project)
-		{
-			m_collection_path = match.captured("collection_path");
-			m_project = project;
-		}
-	}
+	QString collection_path = m_data->m_collection_path;
+	QString file_system_path = m_data->m_file_system_path;
+	QETProject *project = m_data->m_project;
+	const bool keep = resolvePath(path, collection_path, file_system_path, project);
 
-	// The path is in file system,
-	// the given path is relative to common or custom collection
-	else if (path.startsWith("common://") || path.startsWith("company://") || path.startsWith("custom://"))
-	{
-		QString p;
-		if (path.startsWith("common://"))
-		{
-			tmp_path.remove("common://");
-			p = QETApp::commonElementsDirN() % "/" % tmp_path;
-		}
-		else if (path.startsWith("company://"))
-		{
-			tmp_path.remove("company://");
-			p = QETApp::companyElementsDirN() % "/" % tmp_path;
-		}
-		else
-		{
-			tmp_path.remove("custom://");
-			p = QETApp::customElementsDirN() % "/" % tmp_path;
-		}
-
-		m_file_system_path = p;
-		m_collection_path = path;
-	}
-	//In this case, the path is supposed to be relative to the file system.
-	else
-	{
-		QString path_ = path;
-		if(path_.endsWith(".elmt"))
-		{
-			m_file_system_path = path_;
-			if (path_.startsWith(QETApp::commonElementsDirN()))
-			{
-				path_.remove(QETApp::commonElementsDirN()+="/");
-				path_.prepend("common://");
-				m_collection_path = path_;
-			}
-			else if (path_.startsWith(QETApp::companyElementsDirN()))
-			{
-				path_.remove(QETApp::companyElementsDirN()+="/");
-				path_.prepend("company://");
-				m_collection_path = path_;
-			}
-			else if (path_.startsWith(QETApp::customElementsDirN()))
-			{
-				path_.remove(QETApp::customElementsDirN()+="/");
-				path_.prepend("custom://");
-				m_collection_path = path_;
-			}
-		}
-		else
-		{
-			m_file_system_path = path_;
-			if (path_.startsWith(QETApp::commonElementsDirN()))
-			{
-				path_.remove(QETApp::commonElementsDirN()+="/");
-				path_.prepend("common://");
-				m_collection_path = path_;
-			}
-			else if (path_.startsWith(QETApp::companyElementsDirN()))
-			{
-				path_.remove(QETApp::companyElementsDirN()+="/");
-				path_.prepend("company://");
-				m_collection_path = path_;
-			}
-			else if (path_.startsWith(QETApp::customElementsDirN()))
-			{
-				path_.remove(QETApp::customElementsDirN()+="/");
-				path_.prepend("custom://");
-				m_collection_path = path_;
-			}
-		}
+	m_data = table_.intern(collection_path, file_system_path, project);
+	if (keep) {
+		table_.insertResolved(key, m_data);
 	}
 }
 
@@ -371,7 +555,7 @@ void ElementsLocation::setPath(const QString &path)
 */
 bool ElementsLocation::addToPath(const QString &string)
 {
-	if (m_collection_path.endsWith(".elmt", Qt::CaseInsensitive))
+	if (m_data->m_collection_path.endsWith(".elmt", Qt::CaseInsensitive))
 	{
 		qDebug() << "ElementsLocation::addToPath :"
 				" Can't add string to the path of an element";
@@ -380,13 +564,13 @@ bool ElementsLocation::addToPath(const QString &string)
 
 	QString added_path = string;
 
-	if (!m_collection_path.endsWith("/") && !added_path.startsWith("/"))
+	if (!m_data->m_collection_path.endsWith("/") && !added_path.startsWith("/"))
 		added_path.prepend("/");
 
-	if (isFileSystem())
-		m_file_system_path += added_path;
-
-	m_collection_path += added_path;
+	setData(m_data->m_collection_path + added_path,
+			isFileSystem() ? m_data->m_file_system_path + added_path
+						   : m_data->m_file_system_path,
+			m_data->m_project);
 	return(true);
 }
 
@@ -406,12 +590,12 @@ ElementsLocation ElementsLocation::parent() const
 			<< re.errorString()
 			<< re.patternErrorOffset();
 	}
-	QRegularExpressionMatch match = re.match(m_collection_path);
+	QRegularExpressionMatch match = re.match(m_data->m_collection_path);
 	if (!match.hasMatch())
 	{
 		qDebug()
 			<<"no Match => return"
-			<<m_collection_path;
+			<<m_data->m_collection_path;
 	}else {
 		copy.setPath(match.captured("path_proto"));
 	}
@@ -427,7 +611,7 @@ ElementsLocation ElementsLocation::parent() const
 */
 QETProject *ElementsLocation::project() const
 {
-	return(m_project);
+	return(m_data->m_project);
 }
 
 /**
@@ -439,7 +623,21 @@ QETProject *ElementsLocation::project() const
 	Indiquer 0 pour que cet emplacement ne soit plus lie a un projet.
 */
 void ElementsLocation::setProject(QETProject *project) {
-	m_project = project;
+	setData(m_data->m_collection_path, m_data->m_file_system_path, project);
+}
+
+/**
+	@brief ElementsLocation::setData
+	Point this location to the interned data of the given values
+	@param collection_path
+	@param file_system_path
+	@param project
+*/
+void ElementsLocation::setData(const QString &collection_path,
+							   const QString &file_system_path,
+							   QETProject *project)
+{
+	m_data = table().intern(collection_path, file_system_path, project);
 }
 
 /**
@@ -450,7 +648,7 @@ void ElementsLocation::setProject(QETProject *project) {
 */
 bool ElementsLocation::isNull() const
 {
-	return(m_collection_path.isEmpty());
+	return(m_data->m_collection_path.isEmpty());
 }
 
 /**
@@ -461,13 +659,13 @@ bool ElementsLocation::isNull() const
 QString ElementsLocation::toString() const
 {
 	QString result;
-	if (m_project) {
-		int project_id = QETApp::projectId(m_project);
+	if (m_data->m_project) {
+		int project_id = QETApp::projectId(m_data->m_project);
 		if (project_id != -1) {
 			result += "project" % QString().setNum(project_id) % "+";
 		}
 	}
-	result += m_collection_path;
+	result += m_data->m_collection_path;
 	return(result);
 }
 
@@ -477,7 +675,7 @@ QString ElementsLocation::toString() const
 */
 bool ElementsLocation::isElement() const
 {
-	return m_collection_path.endsWith(".elmt");
+	return m_data->m_is_element;
 }
 
 /**
@@ -486,7 +684,7 @@ bool ElementsLocation::isElement() const
 */
 bool ElementsLocation::isDirectory() const
 {
-	return (!isElement() && !m_collection_path.isEmpty());
+	return (!isElement() && !m_data->m_collection_path.isEmpty());
 }
 
 /**
@@ -495,8 +693,8 @@ bool ElementsLocation::isDirectory() const
 */
 bool ElementsLocation::isFileSystem() const
 {
-	if (m_project) return false;
-	if (m_file_system_path.isEmpty()) return false;
+	if (m_data->m_project) return false;
+	if (m_data->m_file_system_path.isEmpty()) return false;
 	return true;
 }
 
@@ -536,7 +734,7 @@ bool ElementsLocation::isCustomCollection() const
 */
 bool ElementsLocation::isProject() const
 {
-	if (m_project && !m_collection_path.isEmpty())
+	if (m_data->m_project && !m_data->m_collection_path.isEmpty())
 		return true;
 	else
 		return false;
@@ -544,15 +742,25 @@ bool ElementsLocation::isProject() const
 
 /**
 	@brief ElementsLocation::exist
+	The existence in a project collection is kept until
+	invalidateCache() is called.
 	@return
 	True if this location represent an existing directory or element.
 */
 bool ElementsLocation::exist() const
 {
-	if (m_project)
+	if (m_data->m_project)
 	{
-		return m_project->embeddedElementCollection()
+		const int generation = table().m_generation.loadAcquire();
+		const int cached = m_data->m_exist.loadAcquire();
+		if ((cached >> 1) == generation) {
+			return cached & 1;
+		}
+
+		const bool exist_ = m_data->m_project->embeddedElementCollection()
 				->exist(collectionPath(false));
+		m_data->m_exist.storeRelease((generation << 1) | (exist_ ? 1 : 0));
+		return exist_;
 	}
 	else
 	{
@@ -576,8 +784,8 @@ bool ElementsLocation::exist() const
 */
 bool ElementsLocation::isWritable() const
 {
-	if (m_project)
-		return !m_project->isReadOnly();
+	if (m_data->m_project)
+		return !m_data->m_project->isReadOnly();
 	else if (isFileSystem())
 	{
 		if (fileSystemPath().startsWith(QETApp::commonElementsDirN()))
@@ -596,8 +804,8 @@ bool ElementsLocation::isWritable() const
 */
 XmlElementCollection *ElementsLocation::projectCollection() const
 {
-	if (m_project)
-		return m_project->embeddedElementCollection();
+	if (m_data->m_project)
+		return m_data->m_project->embeddedElementCollection();
 	else
 		return nullptr;
 }
@@ -617,8 +825,8 @@ NamesList ElementsLocation::nameList()
 
 	if (isDirectory())
 	{
-		if (m_project)
-			nl.fromXml(m_project->embeddedElementCollection()
+		if (m_data->m_project)
+			nl.fromXml(m_data->m_project->embeddedElementCollection()
 				   ->directory(collectionPath(false)));
 		else
 		{
@@ -652,26 +860,26 @@ NamesList ElementsLocation::nameList()
 */
 QDomElement ElementsLocation::xml() const
 {
-	if (!m_project)
+	if (!m_data->m_project)
 	{
-		QFile file (m_file_system_path);
+		QFile file (m_data->m_file_system_path);
 		QDomDocument docu;
 		if (docu.setContent(&file))
 			return docu.documentElement();
 	}
 	else
 	{
-		QString str = m_collection_path;
+		QString str = m_data->m_collection_path;
 		if (isElement())
 		{
-			QDomElement element = m_project
+			QDomElement element = m_data->m_project
 					->embeddedElementCollection()
 					->element(str.remove("embed://"));
 			return element.firstChildElement("definition");
 		}
 		else
 		{
-			QDomElement element = m_project
+			QDomElement element = m_data->m_project
 					->embeddedElementCollection()
 					->directory(str.remove("embed://"));
 			return element;
@@ -702,26 +910,26 @@ pugi::xml_document ElementsLocation::pugiXml() const
 		return docu;
 	}
 #endif
-	if (!m_project)
+	if (!m_data->m_project)
 	{
 #ifndef Q_OS_LINUX
-		if (docu.load_file(m_file_system_path.toStdString().c_str())) {
+		if (docu.load_file(m_data->m_file_system_path.toStdString().c_str())) {
 			docu.save(m_string_stream);
 		}
 #else
-		docu.load_file(m_file_system_path.toStdString().c_str());
+		docu.load_file(m_data->m_file_system_path.toStdString().c_str());
 #endif
 	}
 	else
 	{
 			//Get the xml dom from Qt xml and copie to pugi xml
 		QDomDocument qdoc;
-		QString str = m_collection_path;
+		QString str = m_data->m_collection_path;
 		if (isElement()) {
-			QDomElement element = m_project->embeddedElementCollection()->element(str.remove("embed://"));
+			QDomElement element = m_data->m_project->embeddedElementCollection()->element(str.remove("embed://"));
 			qdoc.appendChild(qdoc.importNode(element.firstChildElement("definition"),true));
 		} else {
-			QDomElement element = m_project->embeddedElementCollection()->directory(str.remove("embed://"));
+			QDomElement element = m_data->m_project->embeddedElementCollection()->directory(str.remove("embed://"));
 			qdoc.appendChild(qdoc.importNode(element, true));
 		}
 		docu.load_string(qdoc.toString(4).toStdString().c_str());
@@ -761,6 +969,7 @@ bool ElementsLocation::setXml(const QDomDocument &xml_document) const
 			return false;
 		}
 		else {
+			invalidateCache();
 			return true;
 		}
 	}
@@ -775,6 +984,7 @@ bool ElementsLocation::setXml(const QDomDocument &xml_document) const
 			parent_node.appendChild(xml_document
 						.documentElement()
 						.cloneNode(true));
+			invalidateCache();
 			return true;
 		}
 		//Element doesn't exist, we create the element
@@ -839,12 +1049,70 @@ QUuid ElementsLocation::uuid() const
 		return QUuid();
 	}
 
+	auto &table_ = table();
+	const int generation = table_.m_generation.loadAcquire();
+	{
+		QMutexLocker locker(&table_.m_uuid_mutex);
+		if (m_data->m_uuid_generation == generation) {
+			return m_data->m_uuid;
+		}
+	}
+
+	QUuid uuid_;
 	auto document = pugiXml();
 	auto uuid_node = document.document_element().child("uuid");
-	if (uuid_node.empty()) {
-		return QUuid();
+	if (!uuid_node.empty()) {
+		uuid_ = QUuid(uuid_node.attribute("uuid").as_string());
 	}
-	return QUuid(uuid_node.attribute("uuid").as_string());
+
+	QMutexLocker locker(&table_.m_uuid_mutex);
+	m_data->m_uuid = uuid_;
+	m_data->m_uuid_generation = generation;
+	return uuid_;
+}
+
+/**
+	@brief ElementsLocation::invalidateCache
+	Forget the existence and the uuid of every location,
+	they will be resolved again at the next request.
+	Called when the content of a collection change.
+*/
+void ElementsLocation::invalidateCache()
+{
+	table().m_generation.fetchAndAddOrdered(1);
+}
+
+/**
+	@brief ElementsLocation::cacheGeneration
+	@return the generation of the cache, incremented by each call of
+	invalidateCache(). Used by the other caches built from the
+	definitions of the elements to know when they are outdated.
+*/
+int ElementsLocation::cacheGeneration()
+{
+	return table().m_generation.loadAcquire();
+}
+
+/**
+	@brief ElementsLocation::clearResolvedPaths
+	Forget the paths already resolved by setPath,
+	called when the directories of the collections change.
+*/
+void ElementsLocation::clearResolvedPaths()
+{
+	table().clearResolved();
+	invalidateCache();
+}
+
+/**
+	@brief ElementsLocation::cacheStatistics
+	@return the number of entries and the estimated size in bytes
+	of the table of the interned locations and of the resolved paths.
+	The interned locations are never deleted.
+*/
+ElementsLocation::CacheStatistics ElementsLocation::cacheStatistics()
+{
+	return table().statistics();
 }
 
 /**
@@ -854,7 +1122,7 @@ QUuid ElementsLocation::uuid() const
 */
 QIcon ElementsLocation::icon() const
 {
-	if (!m_project)
+	if (!m_data->m_project)
 	{
 		ElementsCollectionCache *cache = QETApp::collectionCache();
 		// Make a copy of this to keep this method const
@@ -891,10 +1159,10 @@ QString ElementsLocation::name() const
 */
 QString ElementsLocation::fileName() const
 {
-	if (m_collection_path.isEmpty())
+	if (m_data->m_collection_path.isEmpty())
 		return QString();
 
-	QStringList qsl = m_collection_path.split("/");
+	QStringList qsl = m_data->m_collection_path.split("/");
 	if (qsl.isEmpty())
 		return QString();
 	else
@@ -31,6 +31,7 @@
 
 class QETProject;
 class XmlElementCollection;
+class ElementsLocationData;
 
 /**
 	@brief The ElementsLocation class
@@ -38,6 +39,14 @@ class XmlElementCollection;
 	the location of an element or of a category,
 	even of a collection ... in a collection.
 	It encapsulates a virtual path.
+
+	The path is resolved once : every location with the same path
+	and project share the same ElementsLocationData, interned in a process
+	wide table, so an ElementsLocation is only a pointer, cheap to copy
+	and to compare.
+	The existence of the locations of the project collections and the uuid
+	of the elements are resolved at the first request and kept until
+	invalidateCache() is called, when a collection change.
 	\~French
 	Cette classe represente la localisation, l'emplacement d'un element ou
 	d'une categorie, voire d'une collection... dans une collection.
@@ -46,6 +55,19 @@ class XmlElementCollection;
 class ElementsLocation
 {
 	public:
+		/**
+			@brief The CacheStatistics struct
+			Size of the process wide table of the locations,
+			see ElementsLocation::cacheStatistics
+		*/
+		struct CacheStatistics
+		{
+			int locations = 0;
+			qint64 locations_bytes = 0;
+			int resolved_paths = 0;
+			qint64 resolved_paths_bytes = 0;
+		};
+
 		ElementsLocation();
 		ElementsLocation(const QString &path,
 				 QETProject *project = nullptr);
@@ -93,11 +115,19 @@ class ElementsLocation
 		QString name() const;
 		QString fileName() const;
 		DiagramContext elementInformations() const;
+
+		static void invalidateCache();
+		static int cacheGeneration();
+		static void clearResolvedPaths();
+		static CacheStatistics cacheStatistics();
 	
 	private:
-		QString m_collection_path;
-		QString m_file_system_path;
-		QETProject *m_project = nullptr;
+		void setData(const QString &collection_path,
+				 const QString &file_system_path,
+				 QETProject *project);
+
+	private:
+		const ElementsLocationData *m_data;
 #ifndef Q_OS_LINUX
 		mutable std::stringstream m_string_stream;
 #endif
@@ -0,0 +1,408 @@
+/*
+	Copyright 2006-2026 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech. If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "elementssearchindex.h"
+
+#include <QSet>
+#include <QStringList>
+
+#include <algorithm>
+
+namespace
+{
+		///Approximate size of a node of a QHash, without its key and value
+	const qint64 HASH_NODE_OVERHEAD = 2 * sizeof(void *) + sizeof(uint);
+}
+
+/**
+	@brief ElementsSearchIndex::insert
+	Index the element at @a location with the search fields @a fields.
+	If the element is already indexed, the previous fields are replaced.
+	@param location
+	@param fields : name of the field -> text of the field
+*/
+void ElementsSearchIndex::insert(const ElementsLocation &location, const QVariantHash &fields)
+{
+	if (!location.isElement()) {
+		return;
+	}
+
+	Document document;
+	document.location = location;
+	QStringList all;
+	for (auto it = fields.constBegin() ; it != fields.constEnd() ; ++it)
+	{
+		const auto text = fold(it.value().toString());
+		if (text.isEmpty()) {
+			continue;
+		}
+		document.fields.insert(it.key().toLower(), text);
+		all << text;
+	}
+		//Each field on its own line, a term can't match over two fields
+	document.all = all.join(QLatin1Char('\n'));
+
+	const auto it = m_ids.constFind(key(location));
+	if (it != m_ids.constEnd())
+	{
+			//The items of the model set up their data each time they
+			//are created, the fields are most of the time unchanged
+		if (m_documents.at(it.value()).fields == document.fields) {
+			return;
+		}
+		removeDocument(it.value());
+	}
+
+	insertDocument(document);
+	if (m_removed > 1000 && m_removed > m_documents.size()/2) {
+		compact();
+	}
+}
+
+/**
+	@brief ElementsSearchIndex::remove
+	Remove the element at @a location from the index.
+	If @a location is a directory, every element of the directory
+	and of its sub-directories is removed.
+	@param location
+*/
+void ElementsSearchIndex::remove(const ElementsLocation &location)
+{
+	if (location.isElement())
+	{
+		const auto it = m_ids.constFind(key(location));
+		if (it != m_ids.constEnd()) {
+			removeDocument(it.value());
+		}
+	}
+	else if (!location.isNull())
+	{
+		QString prefix = location.collectionPath();
+		if (!prefix.endsWith(QLatin1Char('/'))) {
+			prefix.append(QLatin1Char('/'));
+		}
+
+		for (int id = 0 ; id < m_documents.size() ; ++id)
+		{
+			const auto &document = m_documents.at(id);
+			if (!document.removed &&
+				document.location.project() == location.project() &&
+				document.location.collectionPath().startsWith(prefix)) {
+				removeDocument(id);
+			}
+		}
+	}
+
+	if (m_removed > 1000 && m_removed > m_documents.size()/2) {
+		compact();
+	}
+}
+
+/**
+	@brief ElementsSearchIndex::clear
+	Remove every element from the index
+*/
+void ElementsSearchIndex::clear()
+{
+	m_documents.clear();
+	m_ids.clear();
+	m_trigrams.clear();
+	m_removed = 0;
+}
+
+/**
+	@brief ElementsSearchIndex::contains
+	@param location
+	@return true if the element at @a location is indexed
+*/
+bool ElementsSearchIndex::contains(const ElementsLocation &location) const
+{
+	return m_ids.contains(key(location));
+}
+
+/**
+	@brief ElementsSearchIndex::count
+	@return the number of indexed elements
+*/
+int ElementsSearchIndex::count() const
+{
+	return m_ids.size();
+}
+
+/**
+	@brief ElementsSearchIndex::bytes
+	@return the estimated size in bytes of this index : the documents
+	with their folded fields, the table of the locations and the lists
+	of the trigrams. The removed documents not yet compacted are included.
+*/
+qint64 ElementsSearchIndex::bytes() const
+{
+	qint64 bytes_ = m_documents.capacity() * sizeof(Document);
+	for (const auto &document : m_documents)
+	{
+		bytes_ += document.all.capacity() * sizeof(QChar);
+		for (auto it = document.fields.constBegin() ; it != document.fields.constEnd() ; ++it)
+		{
+			bytes_ += 2 * sizeof(QString) + HASH_NODE_OVERHEAD
+					+ (it.key().capacity() + it.value().capacity()) * sizeof(QChar);
+		}
+	}
+
+		//The paths of the keys are shared with the interned locations
+	bytes_ += m_ids.size() * (sizeof(Key) + sizeof(int) + HASH_NODE_OVERHEAD);
+
+	for (const auto &ids : m_trigrams)
+	{
+		bytes_ += sizeof(quint64) + sizeof(QVector<int>) + HASH_NODE_OVERHEAD
+				+ ids.capacity() * sizeof(int);
+	}
+	return bytes_;
+}
+
+/**
+	@brief ElementsSearchIndex::merge
+	Add the elements of @a other to this index.
+	The elements already indexed by this index are kept as is,
+	they were indexed after @a other was built.
+	@param other
+*/
+void ElementsSearchIndex::merge(const ElementsSearchIndex &other)
+{
+	m_documents.reserve(m_documents.size() + other.count());
+	for (const auto &document : other.m_documents)
+	{
+		if (!document.removed && !m_ids.contains(key(document.location))) {
+			insertDocument(document);
+		}
+	}
+}
+
+/**
+	@brief ElementsSearchIndex::search
+	@param query : terms separated by '+', see the class description
+	@return the location of the elements which match @a query,
+	in the order of indexation
+*/
+QVector<ElementsLocation> ElementsSearchIndex::search(const QString &query) const
+{
+	QSet<int> found;
+	const auto terms = query.split(QLatin1Char('+'));
+	for (const auto &raw_term : terms)
+	{
+		QString field;
+		QString term = raw_term.trimmed();
+
+		const int colon = term.indexOf(QLatin1Char(':'));
+		if (colon > 0 && !term.left(colon).contains(QLatin1Char(' ')))
+		{
+			field = term.left(colon).trimmed().toLower();
+			term = term.mid(colon + 1);
+		}
+		term = fold(term.trimmed());
+		if (term.isEmpty()) {
+			continue;
+		}
+
+		if (term.size() >= 3)
+		{
+			for (const auto &id : candidates(term)) {
+				if (match(m_documents.at(id), field, term)) {
+					found.insert(id);
+				}
+			}
+		}
+		else
+		{
+			for (int id = 0 ; id < m_documents.size() ; ++id) {
+				if (match(m_documents.at(id), field, term)) {
+					found.insert(id);
+				}
+			}
+		}
+	}
+
+	auto ids = found.values();
+	std::sort(ids.begin(), ids.end());
+
+	QVector<ElementsLocation> locations;
+	locations.reserve(ids.size());
+	for (const auto &id : qAsConst(ids)) {
+		locations.append(m_documents.at(id).location);
+	}
+	return locations;
+}
+
+/**
+	@brief ElementsSearchIndex::fold
+	@param text
+	@return @a text in lower case and without diacritics
+*/
+QString ElementsSearchIndex::fold(const QString &text)
+{
+	const QString decomposed = text.normalized(QString::NormalizationForm_D);
+	QString folded;
+	folded.reserve(decomposed.size());
+	for (const auto &c : decomposed) {
+		if (c.category() != QChar::Mark_NonSpacing) {
+			folded.append(c);
+		}
+	}
+	return folded.toCaseFolded();
+}
+
+/**
+	@brief ElementsSearchIndex::candidates
+	@param term : folded term of at least three characters
+	@return the id of the documents which contain all the trigrams of @a term,
+	sorted.
+*/
+QVector<int> ElementsSearchIndex::candidates(const QString &term) const
+{
+	QVector<const QVector<int> *> lists;
+	for (const auto &trigram : trigrams(term))
+	{
+		const auto it = m_trigrams.constFind(trigram);
+		if (it == m_trigrams.constEnd()) {
+			return QVector<int>();
+		}
+		lists.append(&it.value());
+	}
+	if (lists.isEmpty()) {
+		return QVector<int>();
+	}
+
+		//Intersect from the shortest list
+	std::sort(lists.begin(), lists.end(), [](const QVector<int> *a, const QVector<int> *b) {
+		return a->size() < b->size();
+	});
+
+	QVector<int> result = *lists.first();
+	for (int i = 1 ; i < lists.size() && !result.isEmpty() ; ++i)
+	{
+		QVector<int> intersection;
+		std::set_intersection(result.constBegin(), result.constEnd(),
+							  lists.at(i)->constBegin(), lists.at(i)->constEnd(),
+							  std::back_inserter(intersection));
+		result.swap(intersection);
+	}
+	return result;
+}
+
+/**
+	@brief ElementsSearchIndex::match
+	@param document
+	@param field : the field to search in, or empty for all the fields
+	@param term : folded term
+	@return true if @a document contain @a term
+*/
+bool ElementsSearchIndex::match(const ElementsSearchIndex::Document &document,
+								const QString &field,
+								const QString &term) const
+{
+	if (document.removed) {
+		return false;
+	}
+	if (field.isEmpty()) {
+		return document.all.contains(term);
+	}
+	return document.fields.value(field).contains(term);
+}
+
+/**
+	@brief ElementsSearchIndex::key
+	@param location
+	@return the key of @a location in this index
+*/
+ElementsSearchIndex::Key ElementsSearchIndex::key(const ElementsLocation &location)
+{
+	return qMakePair(location.project(), location.collectionPath());
+}
+
+/**
+	@brief ElementsSearchIndex::insertDocument
+	Add @a document at the end of the documents
+	@param document : a document with folded fields
+*/
+void ElementsSearchIndex::insertDocument(const Document &document)
+{
+	const int id = m_documents.size();
+	for (const auto &trigram : trigrams(document.all)) {
+		m_trigrams[trigram].append(id);
+	}
+	m_documents.append(document);
+	m_ids.insert(key(document.location), id);
+}
+
+/**
+	@brief ElementsSearchIndex::removeDocument
+	The id stay in the lists of trigrams until the next compaction,
+	the document is only emptied.
+	@param id
+*/
+void ElementsSearchIndex::removeDocument(int id)
+{
+	auto &document = m_documents[id];
+	m_ids.remove(key(document.location));
+	document.removed = true;
+	document.fields.clear();
+	document.all.clear();
+	++m_removed;
+}
+
+/**
+	@brief ElementsSearchIndex::compact
+	Rebuild the index without the removed documents
+*/
+void ElementsSearchIndex::compact()
+{
+	const auto documents = m_documents;
+	m_documents.clear();
+	m_ids.clear();
+	m_trigrams.clear();
+	m_removed = 0;
+
+	for (const auto &document : documents)
+	{
+		if (!document.removed) {
+			insertDocument(document);
+		}
+	}
+}
+
+/**
+	@brief ElementsSearchIndex::trigrams
+	@param text
+	@return the distinct trigrams of @a text, each packed in an integer
+*/
+QVector<quint64> ElementsSearchIndex::trigrams(const QString &text)
+{
+	QVector<quint64> list;
+	if (text.size() < 3) {
+		return list;
+	}
+
+	list.reserve(text.size() - 2);
+	for (int i = 0 ; i + 2 < text.size() ; ++i)
+	{
+		list.append(quint64(text.at(i).unicode()) << 32
+					| quint64(text.at(i+1).unicode()) << 16
+					| quint64(text.at(i+2).unicode()));
+	}
+	std::sort(list.begin(), list.end());
+	list.erase(std::unique(list.begin(), list.end()), list.end());
+	return list;
+}
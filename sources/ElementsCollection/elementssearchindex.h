@@ -0,0 +1,97 @@
+/*
+	Copyright 2006-2026 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech. If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef ELEMENTSSEARCHINDEX_H
+#define ELEMENTSSEARCHINDEX_H
+
+#include "elementslocation.h"
+
+#include <QHash>
+#include <QPair>
+#include <QString>
+#include <QVariantHash>
+#include <QVector>
+
+class QETProject;
+
+/**
+	@brief The ElementsSearchIndex class
+	Trigram index of the elements of the collections,
+	used to filter the elements panel.
+
+	Each element is indexed by its location, with its search fields
+	(see ElementCollectionItem::searchFields) :
+	the names of the element in all languages and the element informations
+	(manufacturer, reference...).
+	The texts are folded : lower case and without diacritics,
+	so "resistance" find "Résistance".
+
+	A query is a list of terms separated by '+', an element match
+	if it contain at least one of the terms.
+	A term can be restricted to a field with the syntax "field:text",
+	for example "manufacturer:schneider" or "name:contactor".
+	A term of three characters or more is searched only in the elements
+	which contain all the trigrams of the term, the shorter terms are
+	searched in every element.
+
+	The index doesn't refer to the items of the model, so an index can be
+	built by a worker thread from the definitions and merged afterward
+	(see merge()), and the items are only created for the found elements.
+*/
+class ElementsSearchIndex
+{
+	public:
+		void insert(const ElementsLocation &location, const QVariantHash &fields);
+		void remove(const ElementsLocation &location);
+		void clear();
+		bool contains(const ElementsLocation &location) const;
+		int count() const;
+		qint64 bytes() const;
+		void merge(const ElementsSearchIndex &other);
+
+		QVector<ElementsLocation> search(const QString &query) const;
+
+		static QString fold(const QString &text);
+
+	private:
+		using Key = QPair<QETProject *, QString>;
+
+		struct Document
+		{
+			ElementsLocation location;
+			QHash<QString, QString> fields;
+			QString all;
+			bool removed = false;
+		};
+
+		static Key key(const ElementsLocation &location);
+		void insertDocument(const Document &document);
+		void removeDocument(int id);
+		QVector<int> candidates(const QString &term) const;
+		bool match(const Document &document,
+				   const QString &field,
+				   const QString &term) const;
+		void compact();
+		static QVector<quint64> trigrams(const QString &text);
+
+		QVector<Document> m_documents;
+		QHash<Key, int> m_ids;
+		QHash<quint64, QVector<int>> m_trigrams;
+		int m_removed = 0;
+};
+
+#endif // ELEMENTSSEARCHINDEX_H
@@ -23,6 +23,7 @@
 #include "elementslocation.h"
 
 #include <QDir>
+#include <QDirIterator>
 
 /**
 	@brief FileElementCollectionItem::FileElementCollectionItem
@@ -35,20 +36,19 @@ FileElementCollectionItem::FileElementCollectionItem()
 	@brief FileElementCollectionItem::setRootPath
 	Set path has root path for this file item.
 	Use this function only to set the beginning of a file collection.
+	The childs are created when they are fetched, see fetchMore.
 	@param path
-	@param set_data
 	@param hide_element
 	@return true if path exist.
 */
 bool FileElementCollectionItem::setRootPath(const QString& path,
-						bool set_data,
 						bool hide_element)
 {
 	QDir dir(path);
 	if (dir.exists())
 	{
 		m_path = path;
-		populate(set_data, hide_element);
+		m_hide_element = hide_element;
 		return true;
 	}
 
@@ -266,6 +266,13 @@ void FileElementCollectionItem::addChildAtPath(const QString &collection_name)
 	if (collection_name.isEmpty())
 		return;
 
+		//The childs are not yet created, the new child
+		//will be created with the others when fetched.
+	if (canFetchMore()) {
+		resetChildrenProbe();
+		return;
+	}
+
 	FileElementCollectionItem *feci = new FileElementCollectionItem();
 	insertRow(rowForInsertItem(collection_name), feci);
 	feci->setPathName(collection_name);
@@ -295,12 +302,16 @@ void FileElementCollectionItem::setUpData()
 		//Set the local name and all informations of the element
 		//in the data Qt::UserRole+1, these data will be use for search.
 		ElementsLocation loc(collectionPath());
-		DiagramContext context = loc.elementInformations();
+		const auto fields = searchFields(loc);
 		QStringList search_list;
-		for (QString& key : context.keys())
-		{ search_list.append(context.value(key).toString()); }
+		for (auto it = fields.constBegin() ; it != fields.constEnd() ; ++it)
+		{
+			if (it.key() != QLatin1String("name"))
+				search_list.append(it.value().toString());
+		}
 		search_list.append(localName(loc));
 		setData(search_list.join(" "));
+		setData(fields, SearchFieldsRole);
 	}
 
 	setToolTip(collectionPath());
@@ -343,27 +354,21 @@ void FileElementCollectionItem::setUpIcon()
 	because they should be a child item of another.
 	For create a new file collection see setRootPath.
 	@param path_name
-	@param set_data
-	@param hide_element
 */
-void FileElementCollectionItem::setPathName(const QString& path_name,
-						bool set_data,
-						bool hide_element)
+void FileElementCollectionItem::setPathName(const QString& path_name)
 {
 	m_path = path_name;
-
-	//This isn't an element, we create the childs
-	if (!path_name.endsWith(".elmt"))
-		populate(set_data, hide_element);
+	if (parent())
+		m_hide_element = static_cast<ElementCollectionItem *>(parent())->isElementHidden();
 }
 
 /**
 	@brief FileElementCollectionItem::populate
-	Create the childs of this item
+	Create the direct childs of this item,
+	the childs of the directories are created when they are fetched.
 	@param set_data : if true, call setUpData for every child of this item
-	@param hide_element
 */
-void FileElementCollectionItem::populate(bool set_data, bool hide_element)
+void FileElementCollectionItem::populate(bool set_data)
 {
 	QDir dir (fileSystemPath());
 
@@ -373,12 +378,12 @@ void FileElementCollectionItem::populate(bool set_data, bool hide_element)
 	{
 		FileElementCollectionItem *feci = new FileElementCollectionItem();
 		appendRow(feci);
-		feci->setPathName(str, set_data, hide_element);
+		feci->setPathName(str);
 		if (set_data)
 			feci->setUpData();
 	}
 
-	if (hide_element)
+	if (m_hide_element)
 		return;
 
 		//Get all elmt file in this directory
@@ -388,8 +393,29 @@ void FileElementCollectionItem::populate(bool set_data, bool hide_element)
 	{
 		FileElementCollectionItem *feci = new FileElementCollectionItem();
 		appendRow(feci);
-		feci->setPathName(str, set_data);
+		feci->setPathName(str);
 		if (set_data)
 			feci->setUpData();
 	}
 }
+
+/**
+	@brief FileElementCollectionItem::probeChildren
+	Only the first entry of the directory is read,
+	the directory isn't listed.
+	@return true if the directory of this item isn't empty
+*/
+bool FileElementCollectionItem::probeChildren() const
+{
+	const QString path = fileSystemPath();
+
+	if (QDirIterator(path, QDir::Dirs | QDir::NoDotAndDotDot).hasNext())
+		return true;
+
+	if (m_hide_element)
+		return false;
+
+	return QDirIterator(path,
+				QStringList() << "*.elmt",
+				QDir::Files | QDir::NoDotAndDotDot).hasNext();
+}
@@ -35,7 +35,6 @@ class FileElementCollectionItem : public ElementCollectionItem
 		int type() const override { return Type;}
 
 		bool setRootPath(const QString& path,
-				 bool set_data = true,
 				 bool hide_element = false);
 		QString fileSystemPath() const;
 		QString dirPath() const;
@@ -55,11 +54,12 @@ class FileElementCollectionItem : public ElementCollectionItem
 		void setUpData() override;
 		void setUpIcon() override;
 
+	protected:
+		void populate(bool set_data) override;
+		bool probeChildren() const override;
+
 	private:
-		void setPathName(const QString& path_name,
-				 bool set_data = true,
-				 bool hide_element = false);
-		void populate(bool set_data = true, bool hide_element = false);
+		void setPathName(const QString& path_name);
 
 	private:
 		QString m_path;
@@ -106,6 +106,7 @@ XmlElementCollection::XmlElementCollection(QETProject *project) :
 	//names.addName("zh",    "导入元件");
 
 	import.appendChild(names.toXml(m_dom_document));
+	connectLocationCache();
 }
 
 /**
@@ -126,6 +127,22 @@ XmlElementCollection::XmlElementCollection(const QDomElement &dom_element,
 						   dom_element, true));
 	else
 		qDebug() << "XmlElementCollection : tagName of dom_element is not collection";
+	connectLocationCache();
+}
+
+/**
+	@brief XmlElementCollection::connectLocationCache
+	The existence and the uuid of the ElementsLocation are cached,
+	invalidate the cache each time the content of this collection change.
+*/
+void XmlElementCollection::connectLocationCache()
+{
+	connect(this, &XmlElementCollection::elementAdded,     &ElementsLocation::invalidateCache);
+	connect(this, &XmlElementCollection::elementChanged,   &ElementsLocation::invalidateCache);
+	connect(this, &XmlElementCollection::elementRemoved,   &ElementsLocation::invalidateCache);
+	connect(this, &XmlElementCollection::directorieAdded,  &ElementsLocation::invalidateCache);
+	connect(this, &XmlElementCollection::directoryRemoved, &ElementsLocation::invalidateCache);
+	connect(this, &QObject::destroyed,                     &ElementsLocation::invalidateCache);
 }
 
 /**
@@ -86,6 +86,7 @@ class XmlElementCollection : public QObject
 		ElementsLocation copyElement(ElementsLocation &source,
 					     ElementsLocation &destination,
 					     const QString& rename = QString());
+		void connectLocationCache();
 
 	signals:
 		/**
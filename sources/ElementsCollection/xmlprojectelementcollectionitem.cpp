@@ -140,6 +140,13 @@ void XmlProjectElementCollectionItem::addChildAtPath(
 	if (collection_name.isEmpty())
 		return;
 
+		//The childs are not yet created, the new child
+		//will be created with the others when fetched.
+	if (canFetchMore()) {
+		resetChildrenProbe();
+		return;
+	}
+
 	QString str (collection_name.endsWith(".elmt")? "element" : "category");
 	QDomElement child_element = m_dom_element.firstChildElement(str);
 
@@ -168,13 +175,12 @@ QETProject *XmlProjectElementCollectionItem::project() const
 /**
 	@brief XmlProjectElementCollectionItem::setProject
 	Set the project for this item.
-	Use this method for set this item the root of the collection
+	Use this method for set this item the root of the collection.
+	The childs are created when they are fetched, see fetchMore.
 	@param project : project to manage the collection
-	@param set_data : if true, call setUpData for every child of this item
 	@param hide_element : bool
 */
 void XmlProjectElementCollectionItem::setProject(QETProject *project,
-						 bool set_data,
 						 bool hide_element)
 {
 	if (m_project)
@@ -182,7 +188,7 @@ void XmlProjectElementCollectionItem::setProject(QETProject *project,
 
 	m_project = project;
 	m_dom_element = project->embeddedElementCollection()->root();
-	populate(set_data, hide_element);
+	m_hide_element = hide_element;
 }
 
 /**
@@ -204,13 +210,16 @@ void XmlProjectElementCollectionItem::setUpData()
 			//Set the local name and all informations of the element
 			//in the data Qt::UserRole+1, these data will be use for search.
 		ElementsLocation location(embeddedPath(), m_project);
-		DiagramContext context = location.elementInformations();
+		const auto fields = searchFields(location);
 		QStringList search_list;
-		for (QString key : context.keys()) {
-			search_list.append(context.value(key).toString());
+		for (auto it = fields.constBegin() ; it != fields.constEnd() ; ++it) {
+			if (it.key() != QLatin1String("name")) {
+				search_list.append(it.value().toString());
+			}
 		}
 		search_list.append(localName());
 		setData(search_list.join(" "));
+		setData(fields, SearchFieldsRole);
 	}
 
 	setToolTip(collectionPath());
@@ -238,11 +247,11 @@ void XmlProjectElementCollectionItem::setUpIcon()
 
 /**
 	@brief XmlProjectElementCollectionItem::populate
-	Create the childs of this item
+	Create the direct childs of this item,
+	the childs of the directories are created when they are fetched.
 	@param set_data : if true, call setUpData for every child of this item
-	@param hide_element : bool
 */
-void XmlProjectElementCollectionItem::populate(bool set_data, bool hide_element)
+void XmlProjectElementCollectionItem::populate(bool set_data)
 {
 	QList <QDomElement> dom_category = m_project->embeddedElementCollection()->directories(m_dom_element);
 	std::sort(dom_category.begin(), dom_category.end(), [](QDomElement a, QDomElement b){return (a.attribute("name") < b.attribute("name"));});
@@ -251,12 +260,12 @@ void XmlProjectElementCollectionItem::populate(bool set_data, bool hide_element)
 	{
 		XmlProjectElementCollectionItem *xpeci = new XmlProjectElementCollectionItem();
 		appendRow(xpeci);
-		xpeci->setXmlElement(element, m_project, set_data, hide_element);
+		xpeci->setXmlElement(element, m_project);
 		if (set_data)
 			xpeci->setUpData();
 	}
 
-	if (hide_element)
+	if (m_hide_element)
 		return;
 
 	QList <QDomElement> dom_elements = m_project->embeddedElementCollection()->elements(m_dom_element);
@@ -266,27 +275,38 @@ void XmlProjectElementCollectionItem::populate(bool set_data, bool hide_element)
 	{
 		XmlProjectElementCollectionItem *xpeci = new XmlProjectElementCollectionItem();
 		appendRow(xpeci);
-		xpeci->setXmlElement(element, m_project, set_data);
+		xpeci->setXmlElement(element, m_project);
 		if (set_data)
 			xpeci->setUpData();
 	}
 }
 
+/**
+	@brief XmlProjectElementCollectionItem::probeChildren
+	@return true if the dom element of this item
+	have at least one child directory or element
+*/
+bool XmlProjectElementCollectionItem::probeChildren() const
+{
+	if (!m_dom_element.firstChildElement("category").isNull())
+		return true;
+
+	return !m_hide_element
+			&& !m_dom_element.firstChildElement("element").isNull();
+}
+
 /**
 	@brief XmlProjectElementCollectionItem::setXmlElement
 	Set the managed content of this item
 	@param element :
 	the dom element (directory or element), to be managed by this item
 	@param project : the parent project of managed collection
-	@param set_data : if true, call setUpData for every child of this item
-	@param hide_element : bool
 */
 void XmlProjectElementCollectionItem::setXmlElement(const QDomElement& element,
-						    QETProject *project,
-						    bool set_data,
-						    bool hide_element)
+						    QETProject *project)
 {
 	m_dom_element = element;
 	m_project = project;
-	populate(set_data, hide_element);
+	if (parent())
+		m_hide_element = static_cast<ElementCollectionItem *>(parent())->isElementHidden();
 }
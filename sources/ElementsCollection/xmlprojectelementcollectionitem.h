@@ -47,17 +47,17 @@ class XmlProjectElementCollectionItem : public ElementCollectionItem
 		QETProject * project() const;
 
 		void setProject (QETProject *project,
-				 bool set_data = true,
 				 bool hide_element = false);
 		void setUpData() override;
 		void setUpIcon() override;
 
+	protected:
+		void populate(bool set_data) override;
+		bool probeChildren() const override;
+
 	private:
-		void populate(bool set_data = true, bool hide_element = false);
 		void setXmlElement(const QDomElement& element,
-				   QETProject *project,
-				   bool set_data = true,
-				   bool hide_element = false);
+				   QETProject *project);
 
 	private:
 		QETProject *m_project = nullptr;
@@ -38,6 +38,7 @@ class PropertiesEditorWidget : public QWidget
 		virtual QUndoCommand *associatedUndo () const;
 		virtual QString title() const;
 		virtual void updateUi() {}
+		virtual void releaseEditedItems() {}
 
 		virtual bool setLiveEdit (bool live_edit);
 		bool isLiveEdit() const;
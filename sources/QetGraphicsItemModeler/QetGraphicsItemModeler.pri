@@ -1,7 +1,9 @@
 HEADERS += \
     $$PWD/qetgraphicshandlerutility.h \
-    $$PWD/qetgraphicshandleritem.h
+    $$PWD/qetgraphicshandleritem.h \
+    $$PWD/qetgraphicshandlerlayer.h
 
 SOURCES += \
     $$PWD/qetgraphicshandlerutility.cpp \
-    $$PWD/qetgraphicshandleritem.cpp
+    $$PWD/qetgraphicshandleritem.cpp \
+    $$PWD/qetgraphicshandlerlayer.cpp
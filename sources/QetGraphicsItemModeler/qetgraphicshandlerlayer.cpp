@@ -0,0 +1,483 @@
+/*
+	Copyright 2006-2026 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech. If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "qetgraphicshandlerlayer.h"
+
+#include <QGraphicsScene>
+#include <QGraphicsSceneHoverEvent>
+#include <QGraphicsSceneMouseEvent>
+#include <QGraphicsView>
+#include <QPainter>
+#include <QStyleOptionGraphicsItem>
+#include <QTimer>
+
+#include <algorithm>
+#include <utility>
+
+namespace
+{
+		///The hovered handler is drawn bigger
+	const qreal HOVER_FACTOR = 1.5;
+}
+
+/**
+	@brief QetGraphicsHandlerLayer::QetGraphicsHandlerLayer
+	@param size : the size of the handlers, in pixel
+*/
+QetGraphicsHandlerLayer::QetGraphicsHandlerLayer(qreal size) :
+	m_size(size),
+	m_color(Qt::blue)
+{
+	setAcceptHoverEvents(true);
+	setFlag(QGraphicsItem::ItemUsesExtendedStyleOption);
+}
+
+/**
+	@brief QetGraphicsHandlerLayer::setSize
+	@param size : the size of the handlers, in pixel
+*/
+void QetGraphicsHandlerLayer::setSize(qreal size)
+{
+	m_size = size;
+	updateGeometry();
+}
+
+/**
+	@brief QetGraphicsHandlerLayer::size
+	@return the size of the handlers, in pixel
+*/
+qreal QetGraphicsHandlerLayer::size() const {
+	return m_size;
+}
+
+/**
+	@brief QetGraphicsHandlerLayer::setColor
+	@param color : set the color of the handlers
+*/
+void QetGraphicsHandlerLayer::setColor(QColor color)
+{
+	m_color = std::move(color);
+	update();
+}
+
+/**
+	@brief QetGraphicsHandlerLayer::setHandlerColor
+	Set the color of the handler at @a index only
+	@param index
+	@param color
+*/
+void QetGraphicsHandlerLayer::setHandlerColor(int index, const QColor &color)
+{
+	if (index < 0 || index >= m_points.size()) {
+		return;
+	}
+	m_handler_colors.insert(index, color);
+	update(handlerRect(m_points.at(index), radius(m_geometry_scale) * HOVER_FACTOR));
+}
+
+/**
+	@brief QetGraphicsHandlerLayer::resetHandlerColors
+	Draw every handler with the color of the layer
+*/
+void QetGraphicsHandlerLayer::resetHandlerColors()
+{
+	if (!m_handler_colors.isEmpty()) {
+		m_handler_colors.clear();
+		update();
+	}
+}
+
+/**
+	@brief QetGraphicsHandlerLayer::setPoints
+	Set the position of the handlers.
+	The color of each handler is kept if the number of handlers doesn't change.
+	@param points : the position of each handler, in scene coordinate
+*/
+void QetGraphicsHandlerLayer::setPoints(const QVector<QPointF> &points)
+{
+	if (points.size() != m_points.size()) {
+		m_handler_colors.clear();
+	}
+	m_points = points;
+	m_index_is_valid = false;
+	if (m_hovered_index >= m_points.size()) {
+		m_hovered_index = -1;
+	}
+	updateGeometry();
+}
+
+/**
+	@brief QetGraphicsHandlerLayer::setPoint
+	Move the handler at @a index only, the index of the handlers
+	is updated for this handler instead of being sorted again.
+	Used while a handler is dragged.
+	@param index
+	@param point : the new position of the handler, in scene coordinate
+*/
+void QetGraphicsHandlerLayer::setPoint(int index, const QPointF &point)
+{
+	if (index < 0 || index >= m_points.size() || m_points.at(index) == point) {
+		return;
+	}
+
+	const qreal r = radius(m_geometry_scale) * HOVER_FACTOR;
+	update(handlerRect(m_points.at(index), r));
+
+	if (m_index_is_valid)
+	{
+		m_sorted_index.removeOne(index);
+		m_points[index] = point;
+		auto it = std::lower_bound(m_sorted_index.begin(),
+								   m_sorted_index.end(),
+								   point.x(),
+								   [this](int i, qreal x) { return m_points.at(i).x() < x; });
+		m_sorted_index.insert(it, index);
+	}
+	else {
+		m_points[index] = point;
+	}
+
+	m_shape_scale = 0;
+	if (m_br.contains(handlerRect(point, r))) {
+		update(handlerRect(point, r));
+	} else {
+		updateGeometry();
+	}
+}
+
+/**
+	@brief QetGraphicsHandlerLayer::points
+	@return the position of the handlers
+*/
+QVector<QPointF> QetGraphicsHandlerLayer::points() const {
+	return m_points;
+}
+
+/**
+	@brief QetGraphicsHandlerLayer::count
+	@return the number of handlers
+*/
+int QetGraphicsHandlerLayer::count() const {
+	return m_points.size();
+}
+
+/**
+	@brief QetGraphicsHandlerLayer::handlerAt
+	@param scene_pos
+	@param widget : the viewport which received the event at @a scene_pos,
+	the size of the handlers is the one at the zoom of its view.
+	If null, the handlers are the biggest they are in the views.
+	@return the index of the handler at @a scene_pos,
+	the nearest if several handlers are at this pos, or -1 if there is no handler.
+*/
+int QetGraphicsHandlerLayer::handlerAt(const QPointF &scene_pos, const QWidget *widget) const
+{
+	if (m_points.isEmpty()) {
+		return -1;
+	}
+
+	buildIndex();
+	const QPointF pos = mapFromScene(scene_pos);
+	const qreal r = radius(viewScale(widget));
+	const qreal r2 = r*r;
+
+	auto it = std::lower_bound(m_sorted_index.constBegin(),
+							   m_sorted_index.constEnd(),
+							   pos.x() - r,
+							   [this](int index, qreal x) { return m_points.at(index).x() < x; });
+
+	int nearest = -1;
+	qreal nearest_d2 = r2;
+	for ( ; it != m_sorted_index.constEnd() ; ++it)
+	{
+		const QPointF &point = m_points.at(*it);
+		if (point.x() > pos.x() + r) {
+			break;
+		}
+		const QPointF d = point - pos;
+		const qreal d2 = d.x()*d.x() + d.y()*d.y();
+		if (d2 <= nearest_d2) {
+			nearest_d2 = d2;
+			nearest = *it;
+		}
+	}
+	return nearest;
+}
+
+/**
+	@brief QetGraphicsHandlerLayer::boundingRect
+	@return
+*/
+QRectF QetGraphicsHandlerLayer::boundingRect() const {
+	return m_br;
+}
+
+/**
+	@brief QetGraphicsHandlerLayer::shape
+	@return the shape of the handlers at the smallest zoom of the views
+*/
+QPainterPath QetGraphicsHandlerLayer::shape() const
+{
+	if (m_shape_scale != m_geometry_scale)
+	{
+		m_shape = QPainterPath();
+		const qreal r = radius(m_geometry_scale);
+		for (const auto &point : m_points) {
+			m_shape.addEllipse(point, r, r);
+		}
+		m_shape_scale = m_geometry_scale;
+	}
+	return m_shape;
+}
+
+/**
+	@brief QetGraphicsHandlerLayer::contains
+	Reimplemented to use the index instead of the shape.
+	The view is unknown here, the handlers are tested at their biggest size,
+	the mouse press is then checked at the zoom of the view (see mousePressEvent).
+	@param point
+	@return true if @a point is on a handler
+*/
+bool QetGraphicsHandlerLayer::contains(const QPointF &point) const {
+	return handlerAt(mapToScene(point)) != -1;
+}
+
+/**
+	@brief QetGraphicsHandlerLayer::paint
+	Draw every handler in the exposed rect
+	@param painter
+	@param option
+	@param widget
+*/
+void QetGraphicsHandlerLayer::paint(QPainter *painter,
+				   const QStyleOptionGraphicsItem *option,
+				   QWidget *widget)
+{
+	Q_UNUSED(widget)
+
+		//The scale of the painted view only, the others views can be at another zoom
+	qreal scale = QStyleOptionGraphicsItem::levelOfDetailFromTransform(painter->worldTransform());
+	if (scale <= 0) {
+		scale = m_geometry_scale;
+	}
+		//The view was zoomed out, the handlers are now bigger
+		//in the scene than the bounding rect.
+	if (scale < m_geometry_scale && !m_geometry_update_pending)
+	{
+		m_geometry_update_pending = true;
+		QTimer::singleShot(0, this, [this]()
+		{
+			m_geometry_update_pending = false;
+			updateGeometry();
+		});
+	}
+
+	buildIndex();
+	const qreal r = radius(scale);
+	const QRectF exposed = option->exposedRect.adjusted(-r*HOVER_FACTOR, -r*HOVER_FACTOR,
+														 r*HOVER_FACTOR, r*HOVER_FACTOR);
+
+	painter->save();
+	QPen pen(QBrush(m_color),
+		 2,
+		 Qt::SolidLine,
+		 Qt::SquareCap,
+		 Qt::MiterJoin);
+	pen.setCosmetic(true);
+	QColor current_color = m_color;
+	painter->setBrush(QBrush(current_color));
+	painter->setPen(pen);
+	painter->setRenderHint(QPainter::Antialiasing, true);
+
+	auto it = std::lower_bound(m_sorted_index.constBegin(),
+							   m_sorted_index.constEnd(),
+							   exposed.left(),
+							   [this](int index, qreal x) { return m_points.at(index).x() < x; });
+	for ( ; it != m_sorted_index.constEnd() ; ++it)
+	{
+		const QPointF &point = m_points.at(*it);
+		if (point.x() > exposed.right()) {
+			break;
+		}
+		if (point.y() < exposed.top() || point.y() > exposed.bottom()) {
+			continue;
+		}
+		const QColor color = m_handler_colors.isEmpty() ? m_color
+														: m_handler_colors.value(*it, m_color);
+		if (color != current_color)
+		{
+			current_color = color;
+			pen.setColor(color);
+			painter->setPen(pen);
+			painter->setBrush(QBrush(color));
+		}
+		const qreal handler_r = *it == m_hovered_index ? r*HOVER_FACTOR : r;
+		painter->drawEllipse(point, handler_r, handler_r);
+	}
+	painter->restore();
+}
+
+/**
+	@brief QetGraphicsHandlerLayer::hoverMoveEvent
+	@param event
+*/
+void QetGraphicsHandlerLayer::hoverMoveEvent(QGraphicsSceneHoverEvent *event) {
+	setHoveredIndex(handlerAt(event->scenePos(), event->widget()));
+}
+
+/**
+	@brief QetGraphicsHandlerLayer::hoverLeaveEvent
+	@param event
+*/
+void QetGraphicsHandlerLayer::hoverLeaveEvent(QGraphicsSceneHoverEvent *event)
+{
+	Q_UNUSED(event)
+	setHoveredIndex(-1);
+}
+
+/**
+	@brief QetGraphicsHandlerLayer::mousePressEvent
+	Accept the event only if a handler is pressed,
+	so the layer grab the mouse and the item which filter the events
+	of the layer receive the next mouse move and release.
+	@param event
+*/
+void QetGraphicsHandlerLayer::mousePressEvent(QGraphicsSceneMouseEvent *event)
+{
+	if (handlerAt(event->scenePos(), event->widget()) == -1) {
+		event->ignore();
+	} else {
+		event->accept();
+	}
+}
+
+/**
+	@brief QetGraphicsHandlerLayer::updateGeometry
+	Update the bounding rect of the layer, with a margin for the
+	size of the handlers at the smallest zoom of the views of the scene.
+*/
+void QetGraphicsHandlerLayer::updateGeometry()
+{
+	prepareGeometryChange();
+
+	qreal scale = 0;
+	if (scene())
+	{
+		for (const auto &view : scene()->views())
+		{
+			const qreal view_scale = QStyleOptionGraphicsItem::levelOfDetailFromTransform(view->transform());
+			if (view_scale > 0) {
+				scale = scale > 0 ? qMin(scale, view_scale) : view_scale;
+			}
+		}
+	}
+	if (scale > 0) {
+		m_geometry_scale = scale;
+	}
+	scale = m_geometry_scale;
+
+	if (m_points.isEmpty()) {
+		m_br = QRectF();
+	} else {
+		const qreal margin = radius(scale) * HOVER_FACTOR + 2/scale;
+		m_br = QPolygonF(m_points).boundingRect().adjusted(-margin, -margin, margin, margin);
+	}
+	m_shape_scale = 0;
+	update();
+}
+
+/**
+	@brief QetGraphicsHandlerLayer::buildIndex
+	Sort the index of the points on the x coordinate,
+	if the points changed since the last call.
+*/
+void QetGraphicsHandlerLayer::buildIndex() const
+{
+	if (m_index_is_valid) {
+		return;
+	}
+
+	m_sorted_index.resize(m_points.size());
+	for (int i = 0 ; i < m_points.size() ; ++i) {
+		m_sorted_index[i] = i;
+	}
+	std::sort(m_sorted_index.begin(), m_sorted_index.end(), [this](int a, int b) {
+		return m_points.at(a).x() < m_points.at(b).x();
+	});
+	m_index_is_valid = true;
+}
+
+/**
+	@brief QetGraphicsHandlerLayer::radius
+	@param scale : the scale of the view
+	@return the radius of a handler in the scene
+*/
+qreal QetGraphicsHandlerLayer::radius(qreal scale) const {
+	return scale > 0 ? m_size/2/scale : m_size/2;
+}
+
+/**
+	@brief QetGraphicsHandlerLayer::viewScale
+	@param widget : the viewport of a view
+	@return the scale of the view of @a widget,
+	or the smallest scale of the views if @a widget isn't the viewport of a view.
+*/
+qreal QetGraphicsHandlerLayer::viewScale(const QWidget *widget) const
+{
+	if (widget)
+	{
+		if (auto view = qobject_cast<const QGraphicsView *>(widget->parentWidget()))
+		{
+			const qreal scale = QStyleOptionGraphicsItem::levelOfDetailFromTransform(view->transform());
+			if (scale > 0) {
+				return scale;
+			}
+		}
+	}
+	return m_geometry_scale;
+}
+
+/**
+	@brief QetGraphicsHandlerLayer::handlerRect
+	@return the rect to update to redraw the handler at @a point
+*/
+QRectF QetGraphicsHandlerLayer::handlerRect(const QPointF &point, qreal radius) const
+{
+	const qreal margin = radius + 2/m_geometry_scale;
+	return QRectF(point.x() - margin, point.y() - margin, margin*2, margin*2);
+}
+
+/**
+	@brief QetGraphicsHandlerLayer::setHoveredIndex
+	Set the handler under the mouse and redraw the previous and the new one.
+	@param index
+*/
+void QetGraphicsHandlerLayer::setHoveredIndex(int index)
+{
+	if (index == m_hovered_index) {
+		return;
+	}
+
+	const qreal r = radius(m_geometry_scale) * HOVER_FACTOR;
+	if (m_hovered_index >= 0 && m_hovered_index < m_points.size()) {
+		update(handlerRect(m_points.at(m_hovered_index), r));
+	}
+	m_hovered_index = index;
+	if (m_hovered_index >= 0) {
+		update(handlerRect(m_points.at(m_hovered_index), r));
+	}
+}
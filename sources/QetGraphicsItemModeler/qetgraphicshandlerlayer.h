@@ -0,0 +1,108 @@
+/*
+	Copyright 2006-2026 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech. If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef QETGRAPHICSHANDLERLAYER_H
+#define QETGRAPHICSHANDLERLAYER_H
+
+#include <QGraphicsObject>
+#include <QHash>
+
+/**
+	@brief The QetGraphicsHandlerLayer class
+	This graphics item represents all the handlers of a graphics item
+	to modify (like a polygon), unlike QetGraphicsHandlerItem which
+	represents only one handler.
+	Every handler is drawn in one pass and no graphics item is created
+	by handler, the handler under a point is found through an index
+	sorted on the x coordinate, so the cost doesn't grow with the number
+	of handlers of the item.
+
+	Like QetGraphicsHandlerItem the handlers keep the same size
+	on screen whatever the zoom.
+	The graphics item to be modified must call "installSceneEventFilter"
+	of the layer with itself for argument, and use handlerAt()
+	in its "sceneEventFilter" to know which handler is used.
+	The layer only accept the mouse press on a handler,
+	the others events go to the items below.
+	The size of the handlers depend of the zoom of each view, so the
+	handler under the mouse is found with the zoom of the view which
+	received the event (see handlerAt).
+*/
+class QetGraphicsHandlerLayer : public QGraphicsObject
+{
+		Q_OBJECT
+
+	public:
+		QetGraphicsHandlerLayer(qreal size = 10);
+
+		enum { Type = UserType + 1201};
+		int type() const override {return Type;}
+
+		void setSize(qreal size);
+		qreal size() const;
+		void setColor(QColor color);
+		void setHandlerColor(int index, const QColor &color);
+		void resetHandlerColors();
+
+		void setPoints(const QVector<QPointF> &points);
+		void setPoint(int index, const QPointF &point);
+		QVector<QPointF> points() const;
+		int count() const;
+
+		int handlerAt(const QPointF &scene_pos, const QWidget *widget = nullptr) const;
+
+		QRectF boundingRect() const override;
+		QPainterPath shape() const override;
+		bool contains(const QPointF &point) const override;
+
+	protected:
+		void paint(QPainter *painter,
+			   const QStyleOptionGraphicsItem *option,
+			   QWidget *widget) override;
+		void hoverMoveEvent(QGraphicsSceneHoverEvent *event) override;
+		void hoverLeaveEvent(QGraphicsSceneHoverEvent *event) override;
+		void mousePressEvent(QGraphicsSceneMouseEvent *event) override;
+
+	private:
+		void updateGeometry();
+		void buildIndex() const;
+		qreal radius(qreal scale) const;
+		qreal viewScale(const QWidget *widget) const;
+		QRectF handlerRect(const QPointF &point, qreal radius) const;
+		void setHoveredIndex(int index);
+
+	private:
+		QVector<QPointF> m_points;
+		QRectF m_br;
+		qreal m_size = 10;
+		QColor m_color;
+			///Color of the handlers which don't use m_color
+		QHash<int, QColor> m_handler_colors;
+			///Smallest scale of the views, the size of the handlers is given in pixel
+			///so the handlers are the biggest in the scene at this scale
+		qreal m_geometry_scale = 1;
+		bool m_geometry_update_pending = false;
+		int m_hovered_index = -1;
+
+			///Index of the points sorted on the x coordinate
+		mutable QVector<int> m_sorted_index;
+		mutable bool m_index_is_valid = false;
+		mutable QPainterPath m_shape;
+		mutable qreal m_shape_scale = 0;
+};
+
+#endif // QETGRAPHICSHANDLERLAYER_H
@@ -16,6 +16,8 @@
 	along with QElectroTech.  If not, see <http://www.gnu.org/licenses/>.
 */
 #include "qetgraphicshandlerutility.h"
+#include "qetgraphicshandleritem.h"
+#include "qetgraphicshandlerlayer.h"
 #include <QPainterPath>
 
 
@@ -397,3 +399,17 @@ qreal QetGraphicsHandlerUtility::percentageInRange(qreal min, qreal max, qreal v
 	return ((value - min) * 100) / (max - min);
 }
 
+
+/**
+	@brief QetGraphicsHandlerUtility::isHandler
+	@param item
+	@return true if @a item is a handler, a single one (QetGraphicsHandlerItem)
+	or a layer of handlers (QetGraphicsHandlerLayer).
+	The handlers follow the interactive gestures of the item they modify.
+*/
+bool QetGraphicsHandlerUtility::isHandler(const QGraphicsItem *item)
+{
+	return item &&
+			(item->type() == QetGraphicsHandlerItem::Type ||
+			 item->type() == QetGraphicsHandlerLayer::Type);
+}
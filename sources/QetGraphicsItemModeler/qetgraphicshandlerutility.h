@@ -23,6 +23,7 @@
 #include <QPolygonF>
 
 class QPainter;
+class QGraphicsItem;
 
 /**
 	@brief The QetGraphicsHandlerUtility class
@@ -44,6 +45,7 @@ class QetGraphicsHandlerUtility
 		static QVector <QPointF> pointForRadiusRect (const QRectF &rect, qreal xRadius, qreal yRadius, Qt::SizeMode mode = Qt::AbsoluteSize);
 		static qreal radiusForPosAtIndex (const QRectF &rect, const QPointF &pos, int index, Qt::SizeMode mode = Qt::AbsoluteSize);
 		static qreal percentageInRange(qreal min, qreal max, qreal value);
+		static bool isHandler(const QGraphicsItem *item);
 };
 
 #endif // QETGRAPHICSHANDLERUTILITY_H
@@ -472,6 +472,16 @@ QVector<QSharedPointer<RealTerminal>> TerminalStrip::realTerminals() const
 	return vector_;
 }
 
+/**
+ * @brief TerminalStrip::unresolvedTerminals
+ * @return the uuid of the terminal elements referenced by the xml
+ * read by fromXml, which are not found in the project.
+ * These terminals are not part of this strip.
+ */
+QVector<QUuid> TerminalStrip::unresolvedTerminals() const {
+	return m_unresolved_terminals;
+}
+
 
 /**
  * @brief TerminalStrip::setSortedTo
@@ -1000,6 +1010,7 @@ bool TerminalStrip::fromXml(QDomElement &xml_element)
 	if (xml_element.tagName() != xmlTagName()) {
 		return false;
 	}
+	m_unresolved_terminals.clear();
 
 		//Read terminal strip data
 	auto xml_data = xml_element.firstChildElement(m_data.xmlTagName());
@@ -1024,6 +1035,7 @@ bool TerminalStrip::fromXml(QDomElement &xml_element)
 			for (auto &xml_real : QETXML::findInDomElement(xml_physical, RealTerminal::xmlTagName()))
 			{
 				const auto uuid_ = QUuid(xml_real.attribute(QStringLiteral("element_uuid")));
+				bool found = false;
 				for (auto terminal_elmt : qAsConst(free_terminals))
 				{
 					if (terminal_elmt->uuid() == uuid_)
@@ -1032,9 +1044,13 @@ bool TerminalStrip::fromXml(QDomElement &xml_element)
 							//Remove the actual terminal element from the vector, they dicrease the size
 							//of the vector and so each iteration have less terminal element to check
 						free_terminals.removeOne(terminal_elmt);
+						found = true;
 						break;
 					}
 				}
+				if (!found) {
+					m_unresolved_terminals.append(uuid_);
+				}
 			}
 
             if (!real_t_vector.isEmpty()) {
@@ -97,6 +97,7 @@ class TerminalStrip : public QObject
 		QVector<QSharedPointer<PhysicalTerminal>> physicalTerminal() const;
 		QSharedPointer<RealTerminal> realTerminalForUuid(const QUuid &uuid) const;
 		QVector<QSharedPointer<RealTerminal>> realTerminals() const;
+		QVector<QUuid> unresolvedTerminals() const;
 
 		bool setOrderTo(const QVector<QSharedPointer<PhysicalTerminal>> &sorted_vector);
 		bool groupTerminals(const QSharedPointer<PhysicalTerminal> &receiver_terminal, const QVector<QSharedPointer<RealTerminal>> &added_terminals);
@@ -126,6 +127,8 @@ class TerminalStrip : public QObject
 		QPointer<QETProject> m_project;
 		QVector<QSharedPointer<PhysicalTerminal>> m_physical_terminals;
 		QVector<QSharedPointer<TerminalStripBridge>> m_bridge;
+			///Uuid of the terminal elements read by fromXml but not found in the project
+		QVector<QUuid> m_unresolved_terminals;
 };
 
 #endif // TERMINALSTRIP_H
@@ -16,6 +16,9 @@
 	along with QElectroTech.  If not, see <http://www.gnu.org/licenses/>.
 */
 #include "conductorproperties.h"
+
+#include "qetxml.h"
+
 #include <QPainter>
 #include <QMetaEnum>
 #include <QRegularExpression>
@@ -217,9 +220,10 @@ void SingleLineProperties::drawPen(QPainter *painter,
 */
 void SingleLineProperties::toXml(QDomElement &e) const
 {
-	e.setAttribute("ground",  hasGround  ? "true" : "false");
-	e.setAttribute("neutral", hasNeutral ? "true" : "false");
-	e.setAttribute("phase",   phases);
+	const QString tag_name = QStringLiteral("conductor");
+	QETXML::setElidableAttribute(e, tag_name, "ground",  hasGround  ? "true" : "false");
+	QETXML::setElidableAttribute(e, tag_name, "neutral", hasNeutral ? "true" : "false");
+	QETXML::setElidableAttribute(e, tag_name, "phase",   QString::number(phases));
 	if (isPen()) e.setAttribute("pen", "true");
 }
 
@@ -268,37 +272,43 @@ ConductorProperties::~ConductorProperties()
 */
 void ConductorProperties::toXml(QDomElement &e) const
 {
-	e.setAttribute("type", typeToString(type));
+		//With the compact serialisation, the attributes equal to
+		//the default value of fromXml are not written, see QETXML::elidedDefaults
+	auto setAttribute = [&e](const QString &name, const QString &value) {
+		QETXML::setElidableAttribute(e, QStringLiteral("conductor"), name, value);
+	};
+
+	setAttribute("type", typeToString(type));
 
 	if (color != QColor(Qt::black))
 		e.setAttribute("color", color.name());
 
-	e.setAttribute("bicolor", m_bicolor? "true" : "false");
-	e.setAttribute("color2", m_color_2.name());
-	e.setAttribute("dash-size", QString::number(m_dash_size));
+	setAttribute("bicolor", m_bicolor? "true" : "false");
+	setAttribute("color2", m_color_2.name());
+	setAttribute("dash-size", QString::number(m_dash_size));
 
 	if (type == Single)
 		singleLineProperties.toXml(e);
 
-	e.setAttribute("num", text);
-	e.setAttribute("text_color", text_color.name());
-	e.setAttribute("formula", m_formula);
-	e.setAttribute("cable", m_cable);
-	e.setAttribute("bus", m_bus);
-	e.setAttribute("function", m_function);
-	e.setAttribute("tension_protocol", m_tension_protocol);
-	e.setAttribute("conductor_color", m_wire_color);
-	e.setAttribute("conductor_section", m_wire_section);
-	e.setAttribute("numsize", QString::number(text_size));
-	e.setAttribute("condsize", QString::number(cond_size));
-	e.setAttribute("displaytext", m_show_text);
-	e.setAttribute("onetextperfolio", m_one_text_per_folio);
-	e.setAttribute("vertirotatetext", QString::number(verti_rotate_text));
-	e.setAttribute("horizrotatetext", QString::number(horiz_rotate_text));
+	setAttribute("num", text);
+	setAttribute("text_color", text_color.name());
+	setAttribute("formula", m_formula);
+	setAttribute("cable", m_cable);
+	setAttribute("bus", m_bus);
+	setAttribute("function", m_function);
+	setAttribute("tension_protocol", m_tension_protocol);
+	setAttribute("conductor_color", m_wire_color);
+	setAttribute("conductor_section", m_wire_section);
+	setAttribute("numsize", QString::number(text_size));
+	setAttribute("condsize", QString::number(cond_size));
+	setAttribute("displaytext", QString::number(m_show_text));
+	setAttribute("onetextperfolio", QString::number(m_one_text_per_folio));
+	setAttribute("vertirotatetext", QString::number(verti_rotate_text));
+	setAttribute("horizrotatetext", QString::number(horiz_rotate_text));
 
 	QMetaEnum me = QMetaEnum::fromType<Qt::Alignment>();
-	e.setAttribute("horizontal-alignment", me.valueToKey(m_horizontal_alignment));
-	e.setAttribute("vertical-alignment", me.valueToKey(m_vertical_alignment));
+	setAttribute("horizontal-alignment", me.valueToKey(m_horizontal_alignment));
+	setAttribute("vertical-alignment", me.valueToKey(m_vertical_alignment));
 
 	QString conductor_style = writeStyle();
 	if (!conductor_style.isEmpty())
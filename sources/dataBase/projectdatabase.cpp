@@ -51,6 +51,9 @@ projectDataBase::projectDataBase(QETProject *project, QObject *parent) :
 	});
 	connect(m_project, &QETProject::projectDiagramsOrderChanged, [this]()
 	{
+		if (!m_incremental_update) {
+			return;
+		}
 		for (auto diagram : m_project->diagrams())
 		{
 			m_diagram_order_changed.bindValue(":pos", m_project->folioIndex(diagram)+1);
@@ -90,6 +93,19 @@ void projectDataBase::updateDB()
 	emit dataBaseUpdated();
 }
 
+/**
+	@brief projectDataBase::setIncrementalUpdate
+	When @a update is false, the changes of the project are no longer
+	written to the data base, which is then only filled by updateDB().
+	Used by a project about to be deleted, which has no need
+	to maintain the data base while its items are removed.
+	@param update
+*/
+void projectDataBase::setIncrementalUpdate(bool update)
+{
+	m_incremental_update = update;
+}
+
 /**
 	@brief projectDataBase::project
 	@return the project of this  database
@@ -114,6 +130,10 @@ QSqlQuery projectDataBase::newQuery(const QString &query) {
 */
 void projectDataBase::addElement(Element *element)
 {
+	if (!m_incremental_update) {
+		return;
+	}
+
 	m_insert_elements_query.bindValue(":uuid", element->uuid().toString());
 	m_insert_elements_query.bindValue(":diagram_uuid", element->diagram()->uuid().toString());
 	m_insert_elements_query.bindValue(":pos", element->diagram()->convertPosition(element->scenePos()).toString());
@@ -145,6 +165,10 @@ void projectDataBase::addElement(Element *element)
 */
 void projectDataBase::removeElement(Element *element)
 {
+	if (!m_incremental_update) {
+		return;
+	}
+
 	m_remove_element_query.bindValue(":uuid", element->uuid().toString());
 	if(!m_remove_element_query.exec()) {
 		qDebug() << "projectDataBase::removeElement remove error : " << m_remove_element_query.lastError();
@@ -159,6 +183,10 @@ void projectDataBase::removeElement(Element *element)
 */
 void projectDataBase::elementInfoChanged(Element *element)
 {
+	if (!m_incremental_update) {
+		return;
+	}
+
 	auto hash = elementInfoToString(element);
 	for (auto str : QETInformation::elementInfoKeys()) {
 		m_update_element_query.bindValue(":" + str, hash.value(str));
@@ -173,6 +201,10 @@ void projectDataBase::elementInfoChanged(Element *element)
 
 void projectDataBase::elementInfoChanged(QList<Element *> elements)
 {
+	if (!m_incremental_update) {
+		return;
+	}
+
 	this->blockSignals(true);
 		//Block signal for not emit dataBaseUpdated at
 		//each call of the method elementInfoChanged(Element *element)
@@ -189,6 +221,10 @@ void projectDataBase::elementInfoChanged(QList<Element *> elements)
 
 void projectDataBase::addDiagram(Diagram *diagram)
 {
+	if (!m_incremental_update) {
+		return;
+	}
+
 	m_insert_diagram_query.bindValue(":uuid", diagram->uuid().toString());
 	m_insert_diagram_query.bindValue(":pos", m_project->folioIndex(diagram)+1);
 	if(!m_insert_diagram_query.exec()) {
@@ -217,6 +253,10 @@ void projectDataBase::addDiagram(Diagram *diagram)
 
 void projectDataBase::removeDiagram(Diagram *diagram)
 {
+	if (!m_incremental_update) {
+		return;
+	}
+
 	m_remove_diagram_query.bindValue(":uuid", diagram->uuid().toString());
 	if (!m_remove_diagram_query.exec()) {
 		qDebug() << "projectDataBase::removeDiagram delete error : " << m_remove_diagram_query.lastError();
@@ -227,6 +267,10 @@ void projectDataBase::removeDiagram(Diagram *diagram)
 
 void projectDataBase::diagramInfoChanged(Diagram *diagram)
 {
+	if (!m_incremental_update) {
+		return;
+	}
+
 	bindDiagramInfoValues(m_update_diagram_info_query, diagram);
 
 	if (!m_update_diagram_info_query.exec()) {
@@ -45,6 +45,7 @@ class projectDataBase : public QObject
 		virtual ~projectDataBase() override;
 
 		void updateDB();
+		void setIncrementalUpdate(bool update);
 		QETProject *project() const;
 		QSqlQuery newQuery(const QString &query = QString());
 
@@ -77,6 +78,7 @@ class projectDataBase : public QObject
 	private:
 		QPointer<QETProject> m_project;
 		QSqlDatabase m_data_base;
+		bool m_incremental_update = true;
 		QSqlQuery m_insert_elements_query,
 				  m_insert_element_info_query,
 				  m_remove_element_query,
@@ -24,6 +24,7 @@
 #include "diagramcontent.h"
 #include "diagramevent/diagrameventinterface.h"
 #include "diagramposition.h"
+#include "diagramview.h"
 #include "factory/elementfactory.h"
 #include "qetapp.h"
 #include "qetgraphicsitem/ViewItem/qetgraphicstableitem.h"
@@ -96,6 +97,9 @@ Diagram::Diagram(QETProject *project) :
 			conductor->refreshText();
 		}
 		emit diagramInformationChanged();
+		if (m_project) {
+			m_project->changeBus()->publish(ProjectChangeBus::FolioInformation, m_uuid);
+		}
 	});
 
 	connect(m_project, &QETProject::projectInformationsChanged, this, [this]() {
@@ -113,6 +117,13 @@ Diagram::Diagram(QETProject *project) :
 	connect(&border_and_titleblock,
 		&BorderTitleBlock::titleBlockFolioChanged,
 		this, &Diagram::titleChanged);
+	connect(&border_and_titleblock,
+		&BorderTitleBlock::titleBlockFolioChanged,
+		this, [this]() {
+		if (m_project) {
+			m_project->changeBus()->publish(ProjectChangeBus::FolioTitleBlock, m_uuid);
+		}
+	});
 	connect(&border_and_titleblock,
 		&BorderTitleBlock::borderChanged,
 		this, &Diagram::adjustSceneRect);
@@ -142,21 +153,12 @@ Diagram::~Diagram()
 	if (m_event_interface)
 	delete m_event_interface;
 
-	// list removable items
-	QVector<QGraphicsItem *> deletable_items;
-	for(const auto &qgi : items())
-	{
-		if (qgi->parentItem())
-			continue;
-		if (qgraphicsitem_cast<Conductor *>(qgi))
-			continue;
-		deletable_items.append(qgi);
-	}
-	for (const auto &item : qAsConst(deletable_items))
-	{
-		removeItem(item);
-		delete item;
-	}
+		//The whole project is deleted, nothing need to be
+		//updated by the removal of the items, release them at once.
+	if (m_tearing_down)
+		QGraphicsScene::clear();
+	else
+		clearContent();
 }
 
 /**
@@ -628,22 +630,7 @@ bool Diagram::toPaintDevice(QPaintDevice &pix,
 				Qt::AspectRatioMode aspectRatioMode) {
 	// determine the source area = schema content + margins
 	// determine la zone source =  contenu du schema + marges
-	QRectF source_area;
-	if (!use_border_) {
-		source_area = itemsBoundingRect();
-		source_area.translate(-margin, -margin);
-		source_area.setWidth (source_area.width () + 2.0 * margin);
-		source_area.setHeight(source_area.height() + 2.0 * margin);
-	} else {
-		source_area = QRectF(
-			0.0,
-			0.0,
-			border_and_titleblock.borderAndTitleBlockRect().width()
-					+ 2.0 * margin,
-			border_and_titleblock.borderAndTitleBlockRect().height()
-					+ 2.0 * margin
-		);
-	}
+	const QRectF source_area = paintSourceArea();
 
 	/* if the dimensions are not specified,
 	 *  the image is exported at 1: 1 scale
@@ -684,6 +671,33 @@ bool Diagram::toPaintDevice(QPaintDevice &pix,
 	return(true);
 }
 
+/**
+	@brief Diagram::paintSourceArea
+	@return the area of the scene rendered by toPaintDevice() :
+	the content of the diagram (or the border and title block if used)
+	plus the margins.
+*/
+QRectF Diagram::paintSourceArea() const
+{
+	QRectF source_area;
+	if (!use_border_) {
+		source_area = itemsBoundingRect();
+		source_area.translate(-margin, -margin);
+		source_area.setWidth (source_area.width () + 2.0 * margin);
+		source_area.setHeight(source_area.height() + 2.0 * margin);
+	} else {
+		source_area = QRectF(
+			0.0,
+			0.0,
+			border_and_titleblock.borderAndTitleBlockRect().width()
+					+ 2.0 * margin,
+			border_and_titleblock.borderAndTitleBlockRect().height()
+					+ 2.0 * margin
+		);
+	}
+	return source_area;
+}
+
 /**
 	@brief Diagram::imageSize
 	Allows you to know the dimensions
@@ -2130,6 +2144,36 @@ QList <Conductor *> Diagram::conductors() const
 	return (cnd_list);
 }
 
+/**
+	@brief Diagram::beginStaticBackdrop
+	Ask to every view of this diagram to capture the static content
+	in a backdrop during an interactive gesture.
+	@param participants : items modified during the gesture
+	@sa DiagramView::beginStaticBackdrop
+*/
+void Diagram::beginStaticBackdrop(const QList<QGraphicsItem *> &participants)
+{
+	for (const auto &view : views()) {
+		if (auto diagram_view = qobject_cast<DiagramView *>(view)) {
+			diagram_view->beginStaticBackdrop(participants);
+		}
+	}
+}
+
+/**
+	@brief Diagram::endStaticBackdrop
+	End the static backdrop of every views of this diagram
+	@sa DiagramView::endStaticBackdrop
+*/
+void Diagram::endStaticBackdrop()
+{
+	for (const auto &view : views()) {
+		if (auto diagram_view = qobject_cast<DiagramView *>(view)) {
+			diagram_view->endStaticBackdrop();
+		}
+	}
+}
+
 /**
 	@brief Diagram::elementsMover
 	@return
@@ -2256,6 +2300,54 @@ void Diagram::adjustSceneRect()
 	update(old_rect.united(sceneRect()));
 }
 
+/**
+	@brief Diagram::clearContent
+	Remove and delete every item of this diagram.
+	The conductors are not deleted here because they are deleted
+	with the terminals of the elements.
+*/
+void Diagram::clearContent()
+{
+	QVector<QGraphicsItem *> deletable_items;
+	for(const auto &qgi : items())
+	{
+		if (qgi->parentItem())
+			continue;
+		if (qgraphicsitem_cast<Conductor *>(qgi))
+			continue;
+		deletable_items.append(qgi);
+	}
+	for (const auto &item : qAsConst(deletable_items))
+	{
+		removeItem(item);
+		delete item;
+	}
+}
+
+/**
+	@brief Diagram::beginTeardown
+	Prepare the deletion of this diagram with its project.
+	Once called, the diagram and its items can only be deleted :
+	@li the index of the scene is no longer updated at each removed item
+	@li the links between the elements are forgotten without unlinking
+	(the linked elements are deleted too, maybe in another folio)
+	@li the destructor delete the items at once
+	without removing them one by one from the project.
+	Must be called for every diagram of the project
+	before deleting the first one.
+	@see QETProject::beginTeardown
+*/
+void Diagram::beginTeardown()
+{
+	if (m_tearing_down)
+		return;
+
+	m_tearing_down = true;
+	setItemIndexMethod(QGraphicsScene::NoIndex);
+	for (const auto &element : elements())
+		element->detachLinks();
+}
+
 /**
 	@brief Diagram::applyProperties
 	This method allows you to apply new rendering options while
@@ -128,6 +128,8 @@ class Diagram : public QGraphicsScene
 		bool m_freeze_new_elements;
 		bool m_freeze_new_conductors_;
 		QUuid m_uuid = QUuid::createUuid();
+			/// The diagram is about to be deleted with its project
+		bool m_tearing_down = false;
 	
 	// METHODS
 	protected:
@@ -167,6 +169,10 @@ class Diagram : public QGraphicsScene
 		void setConductorStart (QPointF);
 		void setConductorStop(QPointF);
 		QList < QSet <Conductor *> > potentials();
+
+		// methods related to interactive gestures
+		void beginStaticBackdrop(const QList<QGraphicsItem *> &participants = QList<QGraphicsItem *>());
+		void endStaticBackdrop();
 	
 		// methods related to XML import/export
 		QDomDocument toXml(bool wholeContent = true, bool is_copy_command = false);
@@ -221,6 +227,7 @@ class Diagram : public QGraphicsScene
 		QString title() const;
 		bool toPaintDevice(QPaintDevice &, int = -1, int = -1,
 				   Qt::AspectRatioMode = Qt::KeepAspectRatio);
+		QRectF paintSourceArea() const;
 		QSize imageSize() const;
 		
 		bool isEmpty() const;
@@ -258,6 +265,9 @@ class Diagram : public QGraphicsScene
 				       const QString& title, const QString& seq,
 				       NumerotationContext *nc);
 		void changeZValue(QET::DepthOption option);
+		void clearContent();
+		void beginTeardown();
+		bool isTearingDown() const {return m_tearing_down;}
 
 	public slots:
 		void adjustSceneRect ();
@@ -297,9 +307,15 @@ Q_DECLARE_METATYPE(Diagram *)
 */
 inline void Diagram::setConductor(bool adding) {
 	if (adding) {
-		if (!conductor_setter_ -> scene()) addItem(conductor_setter_);
+		if (!conductor_setter_ -> scene()) {
+			addItem(conductor_setter_);
+			beginStaticBackdrop();
+		}
 	} else {
-		if (conductor_setter_ -> scene()) removeItem(conductor_setter_);
+		if (conductor_setter_ -> scene()) {
+			removeItem(conductor_setter_);
+			endStaticBackdrop();
+		}
 	}
 }
 
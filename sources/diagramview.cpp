@@ -18,6 +18,7 @@
 #include "diagramview.h"
 
 #include "QPropertyUndoCommand/qpropertyundocommand.h"
+#include "QetGraphicsItemModeler/qetgraphicshandlerutility.h"
 #include "diagramcommands.h"
 #include "diagramevent/diagrameventaddelement.h"
 #include "dvevent/dveventinterface.h"
@@ -26,12 +27,14 @@
 #include "qetgraphicsitem/conductor.h"
 #include "qetgraphicsitem/conductortextitem.h"
 #include "qetgraphicsitem/independenttextitem.h"
+#include "qetgraphicsitem/terminal.h"
 #include "qeticons.h"
 #include "titleblock/integrationmovetemplateshandler.h"
 #include "ui/diagrampropertiesdialog.h"
 #include "ui/multipastedialog.h"
 #include "undocommand/changetitleblockcommand.h"
 #include "utils/conductorcreator.h"
+#include "utils/qetlevelofdetail.h"
 #include "undocommand/addgraphicsobjectcommand.h"
 #include "diagram.h"
 
@@ -63,6 +66,14 @@ DiagramView::DiagramView(Diagram *diagram, QWidget *parent) :
 	setRenderHint(QPainter::TextAntialiasing, true);
 	setRenderHint(QPainter::SmoothPixmapTransform, true);
 
+		//While the view is scrolled or zoomed, draw a fast draft,
+		//refined with the full quality once the view is idle.
+	QSettings settings;
+	m_progressive_render = settings.value("diagramview/progressive-render", true).toBool();
+	m_draft_timer.setSingleShot(true);
+	m_draft_timer.setInterval(settings.value("diagramview/progressive-render-delay", 150).toInt());
+	connect(&m_draft_timer, &QTimer::timeout, this, &DiagramView::endDraftRendering);
+
 	setScene(m_diagram);
 	m_diagram -> undoStack().setClean();
 	setWindowIcon(QET::Icons::QETLogo);
@@ -95,6 +106,15 @@ DiagramView::DiagramView(Diagram *diagram, QWidget *parent) :
 	connect(m_diagram, SIGNAL(sceneRectChanged(QRectF)), this, SLOT(adjustSceneRect()));
 	connect(&(m_diagram -> border_and_titleblock), SIGNAL(diagramTitleChanged(const QString &)), this, SLOT(updateWindowTitle()));
 	connect(diagram, SIGNAL(findElementRequired(ElementsLocation)), this, SIGNAL(findElementRequired(ElementsLocation)));
+	connect(m_diagram, &QGraphicsScene::selectionChanged, this, &DiagramView::updateStaticBackdropSelection);
+	connect(this, &QGraphicsView::rubberBandChanged, [this](QRect rubber_band_rect)
+	{
+		if (rubber_band_rect.isNull()) {
+			endStaticBackdrop();
+		} else if (!m_backdrop_running) {
+			beginStaticBackdrop();
+		}
+	});
 
 	QShortcut *edit_conductor_color_shortcut = new QShortcut(QKeySequence(Qt::Key_F2), this);
 	connect(edit_conductor_color_shortcut, &QShortcut::activated, [this]()
@@ -145,7 +165,10 @@ DiagramView::DiagramView(Diagram *diagram, QWidget *parent) :
 	Destructeur
 */
 DiagramView::~DiagramView()
-{}
+{
+	endStaticBackdrop();
+	QetLevelOfDetail::setDraft(viewport(), false);
+}
 
 /**
 	Accepte ou refuse le drag'n drop en fonction du type de donnees entrant
@@ -327,6 +350,7 @@ void DiagramView::setSelectionMode()
 */
 void DiagramView::zoom(const qreal zoom_factor)
 {
+	beginDraftRendering();
 	if (zoom_factor >= 1){
 		scale(zoom_factor, zoom_factor);
 	}
@@ -489,6 +513,7 @@ void DiagramView::mousePressEvent(QMouseEvent *e)
 	{
 		m_free_rubberbanding = true;
 		m_free_rubberband = QPolygon();
+		beginStaticBackdrop();
 		e->accept();
 		return;
 	}
@@ -543,6 +568,7 @@ void DiagramView::mouseMoveEvent(QMouseEvent *e)
 		if (!e->buttons()) {
 			m_free_rubberbanding = false;
 			m_free_rubberband = QPolygon();
+			endStaticBackdrop();
 			return;
 		}
 		m_free_rubberband.append(mapToScene(e->pos()));
@@ -629,6 +655,7 @@ void DiagramView::mouseReleaseEvent(QMouseEvent *e)
 
 		m_free_rubberbanding = false;
 		m_free_rubberband = QPolygon();
+		endStaticBackdrop();
 		emit freeRubberBandChanged(m_free_rubberband);
 		e->accept();
 	}
@@ -680,6 +707,75 @@ void DiagramView::wheelEvent(QWheelEvent *event)
 		QGraphicsView::wheelEvent(event);
 }
 
+/**
+	@brief DiagramView::scrollContentsBy
+	Reimplemented from QGraphicsView
+	The view is drawn in draft while it is scrolled
+	@param dx
+	@param dy
+*/
+void DiagramView::scrollContentsBy(int dx, int dy)
+{
+	beginDraftRendering();
+	QGraphicsView::scrollContentsBy(dx, dy);
+	discardStaleStaticBackdrop();
+}
+
+/**
+	@brief DiagramView::resizeEvent
+	Reimplemented from QGraphicsView
+	@param event
+*/
+void DiagramView::resizeEvent(QResizeEvent *event)
+{
+	QGraphicsView::resizeEvent(event);
+	discardStaleStaticBackdrop();
+}
+
+/**
+	@brief DiagramView::beginDraftRendering
+	Draw the view in draft until it's idle for a short time :
+	no antialiasing, and the items are drawn with less detail
+	(see QetLevelOfDetail::setDraft).
+	The draft is refined by endDraftRendering.
+	Nothing is done if the setting "diagramview/progressive-render" is false.
+*/
+void DiagramView::beginDraftRendering()
+{
+	if (!m_progressive_render) {
+		return;
+	}
+
+	if (!m_draft_rendering)
+	{
+		m_draft_rendering = true;
+		setRenderHint(QPainter::Antialiasing, false);
+		setRenderHint(QPainter::TextAntialiasing, false);
+		setRenderHint(QPainter::SmoothPixmapTransform, false);
+		QetLevelOfDetail::setDraft(viewport(), true);
+	}
+	m_draft_timer.start();
+}
+
+/**
+	@brief DiagramView::endDraftRendering
+	Draw again the view with the full quality
+	@see beginDraftRendering
+*/
+void DiagramView::endDraftRendering()
+{
+	if (!m_draft_rendering) {
+		return;
+	}
+
+	m_draft_rendering = false;
+	setRenderHint(QPainter::Antialiasing, true);
+	setRenderHint(QPainter::TextAntialiasing, true);
+	setRenderHint(QPainter::SmoothPixmapTransform, true);
+	QetLevelOfDetail::setDraft(viewport(), false);
+	viewport()->update();
+}
+
 /**
 	@brief DiagramView::gestureEvent
 	Use the pinch of the trackpad for zoom
@@ -942,9 +1038,11 @@ void DiagramView::updateWindowTitle()
 
 /**
 	Enables or disables the drawing grid according to the amount of pixels display
+	This is called after each zoom, so the static backdrop is checked here too.
 */
 void DiagramView::adjustGridToZoom()
 {
+	discardStaleStaticBackdrop();
 	QRectF viewed_scene = viewedSceneRect();
 	if (diagramEditor()->drawGrid())
 		m_diagram->setDisplayGrid(viewed_scene.width() < 2000 || viewed_scene.height() < 2000);
@@ -1086,6 +1184,208 @@ void DiagramView::paintEvent(QPaintEvent *event)
 	}
 }
 
+/**
+	@brief DiagramView::drawBackground
+	Reimplemented from QGraphicsView
+	When a static backdrop is running, draw the backdrop instead of the
+	background, the static items are already drawn in the backdrop.
+	A backdrop which is no longer valid is normally discarded before the paint
+	(see discardStaleStaticBackdrop), else it is discarded after this paint :
+	the items must not be changed while the scene is drawn.
+	@param painter
+	@param rect
+*/
+void DiagramView::drawBackground(QPainter *painter, const QRectF &rect)
+{
+	if (m_backdrop_running)
+	{
+		if (staticBackdropIsValid())
+		{
+			painter->save();
+			painter->resetTransform();
+			painter->drawPixmap(0, 0, m_backdrop);
+			painter->restore();
+			return;
+		}
+		QTimer::singleShot(0, this, &DiagramView::endStaticBackdrop);
+	}
+
+	QGraphicsView::drawBackground(painter, rect);
+}
+
+/**
+	@brief DiagramView::staticBackdropIsValid
+	@return true if the view was not scrolled, zoomed or resized
+	since the backdrop was captured.
+*/
+bool DiagramView::staticBackdropIsValid() const
+{
+	return viewportTransform() == m_backdrop_transform &&
+			m_backdrop.size() / m_backdrop.devicePixelRatio() == viewport()->size();
+}
+
+/**
+	@brief DiagramView::discardStaleStaticBackdrop
+	Call endStaticBackdrop if the view was scrolled, zoomed or resized
+	since the backdrop was captured.
+*/
+void DiagramView::discardStaleStaticBackdrop()
+{
+	if (m_backdrop_running && !staticBackdropIsValid()) {
+		endStaticBackdrop();
+	}
+}
+
+/**
+	@brief DiagramView::beginStaticBackdrop
+	Capture the current content of the view, except @a participants
+	(and their children), in a pixmap used as backdrop until
+	endStaticBackdrop is called.
+	While the backdrop is running, only the participants are painted
+	over the backdrop, the static items of the view are not painted
+	anymore, this keep the interactive gestures (move, rubber band, conductor
+	creation) fluid even on heavy folios.
+	The static items keep their shape, so they can still be hovered,
+	selected and found under the mouse.
+	Nothing is done if the setting "diagramview/static-backdrop" is false.
+	@param participants : items modified during the gesture
+*/
+void DiagramView::beginStaticBackdrop(const QList<QGraphicsItem *> &participants)
+{
+	endStaticBackdrop();
+
+	QSettings settings;
+	if (!settings.value("diagramview/static-backdrop", true).toBool() ||
+		!isVisible() || viewport()->size().isEmpty()) {
+		return;
+	}
+
+	QSet<QGraphicsItem *> participants_set;
+	for (const auto &item : participants) {
+		participants_set.insert(item);
+	}
+	auto is_participant = [&participants_set](QGraphicsItem *item)
+	{
+		for (auto item_ = item ; item_ ; item_ = item_->parentItem()) {
+			if (participants_set.contains(item_)) {
+				return true;
+			}
+		}
+		return false;
+	};
+
+		//Only the items in the visible part of the scene are managed,
+		//the backdrop is discarded if the view is scrolled.
+	QList<QGraphicsObject *> static_items;
+	QList<QGraphicsObject *> moving_items;
+	const auto visible_items = m_diagram->items(mapToScene(viewport()->rect()).boundingRect());
+	for (const auto &item : visible_items)
+	{
+		auto object_ = item->toGraphicsObject();
+		if (!object_ ||
+			object_->flags() & QGraphicsItem::ItemHasNoContents) {
+			continue;
+		}
+
+			//The handlers are drawn over their item and follow the gesture,
+			//like the moving items.
+		if (is_participant(item) ||
+			QetGraphicsHandlerUtility::isHandler(item)) {
+			moving_items.append(object_);
+		}
+			//Terminals are kept alive for the hover feedback
+			//when a conductor is created.
+		else if (item->type() != Terminal::Type) {
+			static_items.append(object_);
+		}
+	}
+
+		//Capture the backdrop without the moving items
+	for (const auto &object_ : qAsConst(moving_items)) {
+		object_->setFlag(QGraphicsItem::ItemHasNoContents, true);
+	}
+
+	const qreal ratio_ = viewport()->devicePixelRatioF();
+	m_backdrop = QPixmap(viewport()->size() * ratio_);
+	m_backdrop.setDevicePixelRatio(ratio_);
+	m_backdrop.fill(Qt::white);
+	QPainter painter(&m_backdrop);
+	painter.setRenderHints(renderHints());
+	render(&painter, QRectF(), viewport()->rect());
+	painter.end();
+
+	for (const auto &object_ : qAsConst(moving_items)) {
+		object_->setFlag(QGraphicsItem::ItemHasNoContents, false);
+	}
+
+		//From now, the static items are only drawn through the backdrop
+	m_backdrop_items.clear();
+	m_backdrop_items.reserve(static_items.size());
+	for (const auto &object_ : qAsConst(static_items))
+	{
+		m_backdrop_items.append(qMakePair(QPointer<QGraphicsObject>(object_),
+										  object_->isSelected()));
+		object_->setFlag(QGraphicsItem::ItemHasNoContents, true);
+	}
+
+	m_backdrop_transform = viewportTransform();
+	m_backdrop_running = true;
+}
+
+/**
+	@brief DiagramView::endStaticBackdrop
+	Discard the backdrop created by beginStaticBackdrop
+	and draw again every items of the view.
+*/
+void DiagramView::endStaticBackdrop()
+{
+	if (!m_backdrop_running) {
+		return;
+	}
+	m_backdrop_running = false;
+
+	for (const auto &pair_ : qAsConst(m_backdrop_items)) {
+		if (pair_.first) {
+			pair_.first->setFlag(QGraphicsItem::ItemHasNoContents, false);
+		}
+	}
+	m_backdrop_items.clear();
+	m_backdrop = QPixmap();
+	viewport()->update();
+}
+
+/**
+	@brief DiagramView::staticBackdropIsRunning
+	@return true if a static backdrop is running
+*/
+bool DiagramView::staticBackdropIsRunning() const {
+	return m_backdrop_running;
+}
+
+/**
+	@brief DiagramView::updateStaticBackdropSelection
+	The static items captured in the backdrop are drawn with their selection
+	state at the time of the capture. When the selection state of a static item
+	change during the gesture (typically with the rubber band)
+	the item is drawn again over the backdrop.
+*/
+void DiagramView::updateStaticBackdropSelection()
+{
+	if (!m_backdrop_running) {
+		return;
+	}
+
+	for (auto &pair_ : m_backdrop_items)
+	{
+		if (pair_.first && pair_.first->isSelected() != pair_.second)
+		{
+			pair_.first->setFlag(QGraphicsItem::ItemHasNoContents, false);
+			pair_.first->update();
+			pair_.first.clear();
+		}
+	}
+}
+
 /**
 	Switch to visualisation mode if the user is pressing Ctrl and Shift.
 	@return true if the view was switched to visualisation mode, false
@@ -23,6 +23,9 @@
 
 #include <QClipboard>
 #include <QGraphicsView>
+#include <QPixmap>
+#include <QPointer>
+#include <QTimer>
 
 class Conductor;
 class Diagram;
@@ -60,6 +63,17 @@ class DiagramView : public QGraphicsView
 		QList<QAction *>  m_separators;
 		QPolygonF m_free_rubberband;
 		bool m_free_rubberbanding = false;
+
+			///Static backdrop used during interactive gestures
+		bool m_backdrop_running = false;
+		QPixmap m_backdrop;
+		QTransform m_backdrop_transform;
+		QVector<QPair<QPointer<QGraphicsObject>, bool>> m_backdrop_items;
+
+			///Progressive rendering during scroll and zoom
+		bool m_progressive_render = true,
+		m_draft_rendering = false;
+		QTimer m_draft_timer;
 		
 		
 	public:
@@ -70,16 +84,22 @@ class DiagramView : public QGraphicsView
 		void editSelection();
 		void setEventInterface (DVEventInterface *event_interface);
 		QList<QAction *> contextMenuActions() const;
+		void beginStaticBackdrop(const QList<QGraphicsItem *> &participants = QList<QGraphicsItem *>());
+		void endStaticBackdrop();
+		bool staticBackdropIsRunning() const;
 	
 	protected:
 		void mouseDoubleClickEvent(QMouseEvent *) override;
 		void contextMenuEvent(QContextMenuEvent *) override;
 		void wheelEvent(QWheelEvent *) override;
+		void scrollContentsBy(int dx, int dy) override;
+		void resizeEvent(QResizeEvent *event) override;
 		void focusInEvent(QFocusEvent *) override;
 		void keyPressEvent(QKeyEvent *) override;
 		void keyReleaseEvent(QKeyEvent *) override;
 		bool event(QEvent *) override;
 		void paintEvent(QPaintEvent *event) override;
+		void drawBackground(QPainter *painter, const QRectF &rect) override;
 		void mousePressEvent(QMouseEvent *) override;
 		void mouseMoveEvent(QMouseEvent *) override;
 		void mouseReleaseEvent(QMouseEvent *) override;
@@ -101,6 +121,8 @@ class DiagramView : public QGraphicsView
 		QRectF viewedSceneRect() const;
 		bool mustIntegrateTitleBlockTemplate(const TitleBlockTemplateLocation &) const;
 		bool gestures() const;
+		void beginDraftRendering();
+		bool staticBackdropIsValid() const;
 
 	signals:
 			/// Signal emitted after the selection mode changed
@@ -133,5 +155,8 @@ class DiagramView : public QGraphicsView
 	private slots:
 		void adjustGridToZoom();
 		void applyReadOnly();
+		void updateStaticBackdropSelection();
+		void discardStaleStaticBackdrop();
+		void endDraftRendering();
 };
 #endif
@@ -21,6 +21,7 @@
 #include "../NameList/ui/namelistwidget.h"
 #include "../QPropertyUndoCommand/qpropertyundocommand.h"
 #include "../QetGraphicsItemModeler/qetgraphicshandleritem.h"
+#include "../QetGraphicsItemModeler/qetgraphicshandlerlayer.h"
 #include "editorcommands.h"
 #include "elementcontent.h"
 #include "elementprimitivedecorator.h"
@@ -785,7 +786,8 @@ void ElementScene::slot_select(const ElementContent &content)
 	QList<QGraphicsItem*> items_list;
 	for (QGraphicsItem *qgi : content)
 	{
-		if(qgi->type() != QetGraphicsHandlerItem::Type)
+		if(qgi->type() != QetGraphicsHandlerItem::Type &&
+		   qgi->type() != QetGraphicsHandlerLayer::Type)
 			items_list << qgi;
 	}
 	clearSelection();
@@ -1014,7 +1016,8 @@ QList<QGraphicsItem *> ElementScene::zItems(ItemOptions options) const
 		if (
 			qgi -> type() == ElementPrimitiveDecorator::Type ||
 			qgi -> type() == QGraphicsRectItem::Type ||
-			qgi->type() == QetGraphicsHandlerItem::Type
+			qgi->type() == QetGraphicsHandlerItem::Type ||
+			qgi->type() == QetGraphicsHandlerLayer::Type
 		) {
 			i.remove();
 			helpers << qgi;
@@ -1096,7 +1099,8 @@ void ElementScene::reset()
 	QList<QGraphicsItem*> items_list;
 	for (QGraphicsItem *qgi : items())
 	{
-		if(qgi->type() != QetGraphicsHandlerItem::Type)
+		if(qgi->type() != QetGraphicsHandlerItem::Type &&
+		   qgi->type() != QetGraphicsHandlerLayer::Type)
 			items_list << qgi;
 	}
 
@@ -18,7 +18,7 @@
 #include "partpolygon.h"
 
 #include "../../QPropertyUndoCommand/qpropertyundocommand.h"
-#include "../../QetGraphicsItemModeler/qetgraphicshandleritem.h"
+#include "../../QetGraphicsItemModeler/qetgraphicshandlerlayer.h"
 #include "../../QetGraphicsItemModeler/qetgraphicshandlerutility.h"
 #include "../../qeticons.h"
 #include "../elementscene.h"
@@ -270,9 +270,14 @@ void PartPolygon::setClosed(bool close)
 */
 void PartPolygon::setHandlerColor(QPointF pos, const QColor &color)
 {
-	for (QetGraphicsHandlerItem *qghi : m_handler_vector) {
-		if (qghi->pos() == mapToScene(pos)) {
-			qghi->setColor(color);
+	if (!m_handler_layer) {
+		return;
+	}
+	const auto scene_pos = mapToScene(pos);
+	const auto points = m_handler_layer->points();
+	for (int i = 0 ; i < points.size() ; ++i) {
+		if (points.at(i) == scene_pos) {
+			m_handler_layer->setHandlerColor(i, color);
 		}
 	}
 }
@@ -283,8 +288,8 @@ void PartPolygon::setHandlerColor(QPointF pos, const QColor &color)
 */
 void PartPolygon::resetAllHandlerColor()
 {
-	for (QetGraphicsHandlerItem *qghi : m_handler_vector) {
-		qghi->setColor(Qt::blue);
+	if (m_handler_layer) {
+		m_handler_layer->resetHandlerColors();
 	}
 }
 
@@ -360,31 +365,31 @@ QVariant PartPolygon::itemChange(QGraphicsItem::GraphicsItemChange change, const
 */
 bool PartPolygon::sceneEventFilter(QGraphicsItem *watched, QEvent *event)
 {
-		//Watched must be an handler
-	if(watched->type() == QetGraphicsHandlerItem::Type)
+		//Watched must be the layer of the handlers
+	if(watched == m_handler_layer)
 	{
-		QetGraphicsHandlerItem *qghi = qgraphicsitem_cast<QetGraphicsHandlerItem *>(watched);
-
-		if(m_handler_vector.contains(qghi)) //Handler must be in m_vector_index, then we can start resize
+		auto mouse_event = static_cast<QGraphicsSceneMouseEvent *>(event);
+		if(event->type() == QEvent::GraphicsSceneMousePress) //Click
 		{
-			m_vector_index = m_handler_vector.indexOf(qghi);
+				//The handler used until the release
+			m_vector_index = m_handler_layer->handlerAt(mouse_event->scenePos(), mouse_event->widget());
 			if (m_vector_index != -1)
 			{
-				if(event->type() == QEvent::GraphicsSceneMousePress) //Click
-				{
-					handlerMousePressEvent(qghi, static_cast<QGraphicsSceneMouseEvent *>(event));
-					return true;
-				}
-				else if(event->type() == QEvent::GraphicsSceneMouseMove) //Move
-				{
-					handlerMouseMoveEvent(qghi, static_cast<QGraphicsSceneMouseEvent *>(event));
-					return true;
-				}
-				else if (event->type() == QEvent::GraphicsSceneMouseRelease) //Release
-				{
-					handlerMouseReleaseEvent(qghi, static_cast<QGraphicsSceneMouseEvent *>(event));
-					return true;
-				}
+				handlerMousePressEvent(mouse_event);
+				return true;
+			}
+		}
+		else if (m_vector_index != -1)
+		{
+			if(event->type() == QEvent::GraphicsSceneMouseMove) //Move
+			{
+				handlerMouseMoveEvent(mouse_event);
+				return true;
+			}
+			else if (event->type() == QEvent::GraphicsSceneMouseRelease) //Release
+			{
+				handlerMouseReleaseEvent(mouse_event);
+				return true;
 			}
 		}
 	}
@@ -400,16 +405,11 @@ void PartPolygon::contextMenuEvent(QGraphicsSceneContextMenuEvent *event)
 	{
 		QList<QAction *> list;
 		list << m_insert_point;
-		if (m_handler_vector.count() > 2)
+		if (m_handler_layer &&
+			m_handler_layer->count() > 2 &&
+			m_handler_layer->handlerAt(event->scenePos(), event->widget()) != -1)
 		{
-			for (QetGraphicsHandlerItem *qghi : m_handler_vector)
-			{
-				if (qghi->contains(qghi->mapFromScene(event->scenePos())))
-				{
-					list << m_remove_point;
-					break;
-				}
-			}
+			list << m_remove_point;
 		}
 		elementScene()->editor()->contextMenu(event->screenPos(), list);
 		event->accept();
@@ -421,31 +421,18 @@ void PartPolygon::contextMenuEvent(QGraphicsSceneContextMenuEvent *event)
 */
 void PartPolygon::adjustHandlerPos()
 {
-	if(m_handler_vector.isEmpty())
+	if(!m_handler_layer)
 		return;
 
-	if (m_handler_vector.size() == m_polygon.size())
-	{
-		QVector <QPointF> points_vector = mapToScene(m_polygon);
-		for (int i = 0 ; i < points_vector.size() ; ++i)
-			m_handler_vector.at(i)->setPos(points_vector.at(i));
-	}
-	else
-	{
-		qDeleteAll(m_handler_vector);
-		m_handler_vector.clear();
-		addHandler();
-	}
+	m_handler_layer->setPoints(mapToScene(m_polygon));
 }
 
 /**
 	@brief PartPolygon::handlerMousePressEvent
-	@param qghi
 	@param event
 */
-void PartPolygon::handlerMousePressEvent(QetGraphicsHandlerItem *qghi, QGraphicsSceneMouseEvent *event)
+void PartPolygon::handlerMousePressEvent(QGraphicsSceneMouseEvent *event)
 {
-	Q_UNUSED(qghi);
 	Q_UNUSED(event);
 
 	m_undo_command = new QPropertyUndoCommand(this, "polygon", QVariant(m_polygon));
@@ -454,12 +441,10 @@ void PartPolygon::handlerMousePressEvent(QetGraphicsHandlerItem *qghi, QGraphics
 
 /**
 	@brief PartPolygon::handlerMouseMoveEvent
-	@param qghi
 	@param event
 */
-void PartPolygon::handlerMouseMoveEvent(QetGraphicsHandlerItem *qghi, QGraphicsSceneMouseEvent *event)
+void PartPolygon::handlerMouseMoveEvent(QGraphicsSceneMouseEvent *event)
 {
-	Q_UNUSED(qghi);
 
 	QPointF new_pos = event->scenePos();
 	if (event->modifiers() != Qt::ControlModifier)
@@ -468,18 +453,19 @@ void PartPolygon::handlerMouseMoveEvent(QetGraphicsHandlerItem *qghi, QGraphicsS
 
 	prepareGeometryChange();
 	m_polygon.replace(m_vector_index, new_pos);
-	adjustHandlerPos();
+		//Only the dragged handler moved
+	if (m_handler_layer) {
+		m_handler_layer->setPoint(m_vector_index, mapToScene(new_pos));
+	}
 	emit polygonChanged();
 }
 
 /**
 	@brief PartPolygon::handlerMouseReleaseEvent
-	@param qghi
 	@param event
 */
-void PartPolygon::handlerMouseReleaseEvent(QetGraphicsHandlerItem *qghi, QGraphicsSceneMouseEvent *event)
+void PartPolygon::handlerMouseReleaseEvent(QGraphicsSceneMouseEvent *event)
 {
-	Q_UNUSED(qghi);
 	Q_UNUSED(event);
 
 	m_undo_command->setNewValue(QVariant(m_polygon));
@@ -494,17 +480,14 @@ void PartPolygon::handlerMouseReleaseEvent(QetGraphicsHandlerItem *qghi, QGraphi
 */
 void PartPolygon::addHandler()
 {
-	if (m_handler_vector.isEmpty() && scene())
+	if (!m_handler_layer && scene())
 	{
-		m_handler_vector = QetGraphicsHandlerItem::handlerForPoint(mapToScene(m_polygon));
-
-		for(QetGraphicsHandlerItem *handler : m_handler_vector)
-		{
-			handler->setColor(Qt::blue);
-			scene()->addItem(handler);
-			handler->installSceneEventFilter(this);
-			handler->setZValue(this->zValue()+1);
-		}
+		m_handler_layer = new QetGraphicsHandlerLayer();
+		m_handler_layer->setPoints(mapToScene(m_polygon));
+		m_handler_layer->setColor(Qt::blue);
+		scene()->addItem(m_handler_layer);
+		m_handler_layer->installSceneEventFilter(this);
+		m_handler_layer->setZValue(this->zValue()+1);
 	}
 }
 
@@ -514,11 +497,8 @@ void PartPolygon::addHandler()
 */
 void PartPolygon::removeHandler()
 {
-	if (!m_handler_vector.isEmpty())
-	{
-		qDeleteAll(m_handler_vector);
-		m_handler_vector.clear();
-	}
+	delete m_handler_layer;
+	m_handler_layer = nullptr;
 }
 
 /**
@@ -544,21 +524,11 @@ void PartPolygon::insertPoint()
 */
 void PartPolygon::removePoint()
 {
-	if (m_handler_vector.size() == 2)
+	if (!m_handler_layer || m_handler_layer->count() == 2)
 		return;
 
-	QPointF point = mapToScene(m_context_menu_pos);
-	int index = -1;
-	for (int i=0 ; i<m_handler_vector.size() ; i++)
-	{
-		QetGraphicsHandlerItem *qghi = m_handler_vector.at(i);
-		if (qghi->contains(qghi->mapFromScene(point)))
-		{
-			index = i;
-			break;
-		}
-	}
-	if (index > -1 && index<m_handler_vector.count())
+	const int index = m_handler_layer->handlerAt(mapToScene(m_context_menu_pos));
+	if (index > -1 && index<m_handler_layer->count())
 	{
 		QPolygonF polygon = this->polygon();
 		qDebug() << index;
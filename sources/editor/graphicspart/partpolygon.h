@@ -22,7 +22,7 @@
 #include "customelementgraphicpart.h"
 
 class QPropertyUndoCommand;
-class QetGraphicsHandlerItem;
+class QetGraphicsHandlerLayer;
 class QAction;
 
 /**
@@ -102,9 +102,9 @@ class PartPolygon : public CustomElementGraphicPart
 	
 	private:
 		void adjustHandlerPos();
-		void handlerMousePressEvent   (QetGraphicsHandlerItem *qghi, QGraphicsSceneMouseEvent *event);
-		void handlerMouseMoveEvent    (QetGraphicsHandlerItem *qghi, QGraphicsSceneMouseEvent *event);
-		void handlerMouseReleaseEvent (QetGraphicsHandlerItem *qghi, QGraphicsSceneMouseEvent *event);
+		void handlerMousePressEvent   (QGraphicsSceneMouseEvent *event);
+		void handlerMouseMoveEvent    (QGraphicsSceneMouseEvent *event);
+		void handlerMouseReleaseEvent (QGraphicsSceneMouseEvent *event);
 
 		void insertPoint();
 		void removePoint();
@@ -115,7 +115,7 @@ class PartPolygon : public CustomElementGraphicPart
 		QPolygonF m_polygon;
 		QPropertyUndoCommand *m_undo_command;
 		int m_vector_index = -1;
-		QVector<QetGraphicsHandlerItem *> m_handler_vector;
+		QetGraphicsHandlerLayer *m_handler_layer = nullptr;
 		QAction *m_insert_point,
 				*m_remove_point;
 		QPointF m_context_menu_pos;
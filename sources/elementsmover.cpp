@@ -105,6 +105,11 @@ int ElementsMover::beginMovement(Diagram *diagram, QGraphicsItem *driver_item)
 	 * There is now a move in progress */
 	m_movement_running = true;
 
+		//The moved items and the conductors to update are the only
+		//items modified by the movement, the other items are drawn
+		//from a static backdrop until the end of the movement.
+	m_diagram->beginStaticBackdrop(m_moved_content.items());
+
 	return(m_moved_content.count());
 }
 
@@ -240,6 +245,7 @@ void ElementsMover::endMovement()
 		// There is no movement in progress now
 	m_movement_running = false;
 	m_moved_content.clear();
+	m_diagram->endStaticBackdrop();
 
 	if (m_status_bar) {
 		m_status_bar->clearMessage();
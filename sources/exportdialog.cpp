@@ -33,6 +33,7 @@
 #include "qetgraphicsitem/terminal.h"
 #include "qeticons.h"
 #include "qetmessagebox.h"
+#include "tiledrasterexport.h"
 
 #include <QGraphicsSimpleTextItem>
 #include <QSvgGenerator>
@@ -365,6 +366,48 @@ QImage ExportDialog::generateImage(
 	return(image);
 }
 
+/**
+	@brief ExportDialog::generateTiledImage
+	Export the diagram to a raster image rendered and written band by band,
+	without allocating an image of the size of the export.
+	@param diagram : diagram to export
+	@param width : width of the export
+	@param height : height of the export
+	@param keep_aspect_ratio : true to keep the aspect ratio
+	@param format : format of the image, must be supported by TiledRasterExport
+	@param file : file where the image is written
+	@return true on success
+*/
+bool ExportDialog::generateTiledImage(
+		Diagram *diagram,
+		int width,
+		int height,
+		bool keep_aspect_ratio,
+		const QString &format,
+		QFile &file)
+{
+	saveReloadDiagramParameters(diagram, true);
+
+	TiledRasterExport raster_export(
+		diagram,
+		width,
+		height,
+		keep_aspect_ratio ? Qt::KeepAspectRatio : Qt::IgnoreAspectRatio
+	);
+	const bool ok = raster_export.write(&file, format);
+
+	saveReloadDiagramParameters(diagram, false);
+
+	if (!ok) {
+		QET::QetMessageBox::warning(
+			this,
+			tr("Impossible d'exporter le folio", "message box title"),
+			raster_export.errorString()
+		);
+	}
+	return ok;
+}
+
 /**
 	Sauve ou restaure les parametres du schema
 	@param diagram Schema dont on sauve ou restaure les parametres
@@ -818,6 +861,15 @@ void ExportDialog::exportDiagram(ExportDiagramLine *diagram_line) {
 			diagram_line -> height -> value(),
 			diagram_path
 		);
+	} else if (TiledRasterExport::supportsFormat(format_acronym)) {
+		generateTiledImage(
+			diagram_line -> diagram,
+			diagram_line -> width  -> value(),
+			diagram_line -> height -> value(),
+			diagram_line -> keep_ratio -> isChecked(),
+			format_acronym,
+			target_file
+		);
 	} else {
 		QImage image = generateImage(
 			diagram_line -> diagram,
@@ -93,6 +93,7 @@ class ExportDialog : public QDialog {
 	void generateSvg(Diagram *, int, int, bool, QIODevice &);
 	void generateDxf(Diagram *, int, int, QString &);
 	QImage generateImage(Diagram *, int, int, bool);
+	bool generateTiledImage(Diagram *, int, int, bool, const QString &, QFile &);
 	void exportDiagram(ExportDiagramLine *);
 	qreal diagramRatio(Diagram *);
 	QSize diagramSize(Diagram *);
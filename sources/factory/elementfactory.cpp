@@ -17,6 +17,7 @@
 */
 #include "elementfactory.h"
 
+#include "../qetgraphicsitem/dynamicelementtextitem.h"
 #include "../qetgraphicsitem/masterelement.h"
 #include "../qetgraphicsitem/reportelement.h"
 #include "../qetgraphicsitem/simpleelement.h"
@@ -26,6 +27,40 @@
 #include <QDomElement>
 
 ElementFactory* ElementFactory::factory_ = nullptr;
+
+/**
+	@brief ElementPrototype::ElementPrototype
+	@param element : the fully built element used as template,
+	the prototype take ownership of the element.
+	@param link_type : the link type of the definition
+*/
+ElementPrototype::ElementPrototype(Element *element, const QString &link_type) :
+	m_element(element),
+	m_link_type(link_type)
+{
+		//The dynamic texts are stored in the same form as they are saved in a project,
+		//so the clones load them without having to convert the definition again
+	for (const auto &deti : m_element->dynamicTextItems()) {
+		m_dynamic_texts << deti->toXml(m_document);
+	}
+}
+
+/**
+	@brief ElementPrototype::~ElementPrototype
+*/
+ElementPrototype::~ElementPrototype()
+{
+	delete m_element;
+}
+
+/**
+	@brief ElementFactory::~ElementFactory
+*/
+ElementFactory::~ElementFactory()
+{
+	clearPrototypes();
+}
+
 /**
 	@brief ElementFactory::createElement
 	@param location create element at this location
@@ -42,20 +77,153 @@ Element * ElementFactory::createElement(const ElementsLocation &location, QGraph
 		return nullptr;
 	}
 
-	auto doc = location.pugiXml();
-	if (doc.document_element().attribute("link_type"))
+		//The uuid is cached by the location, the definition is only
+		//parsed when the prototype must be built
+	const QUuid uuid = location.uuid();
+	if (!uuid.isNull())
 	{
-		QString link_type(doc.document_element().attribute("link_type").as_string());
-		if (link_type == QLatin1String("next_report") || link_type == QLatin1String("previous_report"))
-			return (new ReportElement(location, link_type, qgi, state));
-		if (link_type == QLatin1String("master"))
-			return (new MasterElement   (location, qgi, state));
-		if (link_type == QLatin1String("slave"))
-			return (new SlaveElement    (location, qgi, state));
-		if (link_type == QLatin1String("terminal"))
-			return (new TerminalElement (location, qgi, state));
-	}
-	
+		if (const auto proto = prototype(location, uuid)) {
+			return newElement(location, proto->linkType(), qgi, state, proto);
+		}
+	}
+
+		//A definition without uuid can't be identified, build it from the xml
+	return newElement(location, linkType(location), qgi, state);
+}
+
+/**
+	@brief ElementFactory::prototypesCount
+	@return the number of element definitions which have a prototype
+*/
+int ElementFactory::prototypesCount() const
+{
+	return m_prototypes.size();
+}
+
+/**
+	@brief ElementFactory::prototypes
+	@return the prototypes of the factory, valid until the prototypes
+	are cleared or a new element is created.
+*/
+QList<const ElementPrototype *> ElementFactory::prototypes() const
+{
+	QList<const ElementPrototype *> list;
+	for (const auto &prototype : m_prototypes) {
+		list << prototype;
+	}
+	return list;
+}
+
+/**
+	@brief ElementFactory::clearPrototypes
+	Delete all prototypes, the next element of each definition
+	will be built again from the xml.
+*/
+void ElementFactory::clearPrototypes()
+{
+	qDeleteAll(m_prototypes);
+	m_prototypes.clear();
+}
+
+/**
+	@brief ElementFactory::clearPrototypes
+	Delete the prototypes of the definitions embedded in @a project.
+	Called when the project is closed.
+	@param project
+*/
+void ElementFactory::clearPrototypes(QETProject *project)
+{
+	for (auto it = m_prototypes.begin() ; it != m_prototypes.end() ;)
+	{
+		if (it.value()->element()->location().project() == project)
+		{
+			delete it.value();
+			it = m_prototypes.erase(it);
+		}
+		else {
+			++it;
+		}
+	}
+}
+
+/**
+	@brief ElementFactory::newElement
+	Create the element matching @a link_type
+	@param location : location of the definition
+	@param link_type : link type of the definition
+	@param qgi : parent item for the element
+	@param state : state of the creation
+	@param prototype : if not null, the element is cloned from this prototype
+	instead of being built from the xml of the definition
+	@return the new element
+*/
+Element *ElementFactory::newElement(const ElementsLocation &location,
+									const QString &link_type,
+									QGraphicsItem *qgi,
+									int *state,
+									const ElementPrototype *prototype)
+{
+	if (link_type == QLatin1String("next_report") || link_type == QLatin1String("previous_report"))
+		return (new ReportElement(location, link_type, qgi, state, prototype));
+	if (link_type == QLatin1String("master"))
+		return (new MasterElement   (location, qgi, state, prototype));
+	if (link_type == QLatin1String("slave"))
+		return (new SlaveElement    (location, qgi, state, prototype));
+	if (link_type == QLatin1String("terminal"))
+		return (new TerminalElement (location, qgi, state, prototype));
+
 		//default if nothing match for link_type
-	return (new SimpleElement(location, qgi, state));
+	return (new SimpleElement(location, qgi, state, prototype));
+}
+
+/**
+	@brief ElementFactory::prototype
+	@param location : location of the definition
+	@param uuid : uuid of the definition
+	@return the prototype of the definition identified by @a location
+	and @a uuid.
+	If the prototype doesn't exist yet, it is built from @a location.
+	Return nullptr if the definition can't be built.
+*/
+const ElementPrototype *ElementFactory::prototype(const ElementsLocation &location,
+												  const QUuid &uuid)
+{
+		//A collection changed since the prototypes were built,
+		//a definition can be modified without a new uuid
+		//(replaced by another one, edited outside of QElectroTech...)
+	const int generation = ElementsLocation::cacheGeneration();
+	if (generation != m_cache_generation)
+	{
+		clearPrototypes();
+		m_cache_generation = generation;
+	}
+
+	const auto key = qMakePair(location.toString(), uuid);
+	if (const auto proto = m_prototypes.value(key)) {
+		return proto;
+	}
+
+	const QString link_type = linkType(location);
+	int state = 0;
+	Element *element = newElement(location, link_type, nullptr, &state);
+	if (state)
+	{
+		delete element;
+		return nullptr;
+	}
+
+	auto proto = new ElementPrototype(element, link_type);
+	m_prototypes.insert(key, proto);
+	return proto;
+}
+
+/**
+	@brief ElementFactory::linkType
+	@param location : location of the definition
+	@return the link type of the definition at @a location
+*/
+QString ElementFactory::linkType(const ElementsLocation &location)
+{
+	const auto doc = location.pugiXml();
+	return QString(doc.document_element().attribute("link_type").as_string());
 }
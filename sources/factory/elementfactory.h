@@ -18,17 +18,67 @@
 #ifndef ELEMENTFACTORY_H
 #define ELEMENTFACTORY_H
 
+#include <QDomDocument>
+#include <QHash>
 #include <QMutex>
+#include <QPair>
+#include <QString>
+#include <QUuid>
+#include <QVector>
 
 class Element;
 class ElementsLocation;
+class QETProject;
 class QGraphicsItem;
 
+/**
+	@brief The ElementPrototype class
+	A fully built element, used as template for every new instance
+	of the same element definition.
+	The prototype keep the state prepared from the definition
+	(size, hotspot, data, pictures, terminals...) and the xml
+	of the dynamic texts, ready to be loaded by the new instances.
+	The element of a prototype is never added to a diagram.
+	See ElementFactory::createElement and Element::buildFromPrototype.
+*/
+class ElementPrototype
+{
+	public:
+		ElementPrototype(Element *element, const QString &link_type);
+		~ElementPrototype();
+
+		const Element *element() const {return m_element;}
+		QString linkType() const {return m_link_type;}
+		QVector<QDomElement> dynamicTexts() const {return m_dynamic_texts;}
+
+	private:
+		ElementPrototype(const ElementPrototype &);
+		ElementPrototype operator= (const ElementPrototype &);
+
+		Element *m_element = nullptr;
+		QString m_link_type;
+		QDomDocument m_document;
+		QVector<QDomElement> m_dynamic_texts;
+};
+
 /**
 	@brief The ElementFactory class
 	this class is a pattern factory and also a singleton factory.
 	this class create new instance of herited class element like
 	simple element or report element.
+
+	The factory keep a prototype of each element definition
+	it has already built, identified by the location and the uuid
+	of the definition.
+	The next instances of the same definition are cloned from
+	the prototype instead of being built from the xml.
+	Because the element editor give a new uuid to the definition
+	at each save, a modified definition get a new prototype.
+	The prototypes are dropped when the cache of the ElementsLocation
+	is invalidated (a collection changed, see
+	ElementsLocation::invalidateCache) and the prototypes of
+	the embedded collection of a project are dropped when
+	the project is closed.
 */
 class ElementFactory
 {
@@ -65,10 +115,28 @@ class ElementFactory
 		ElementFactory() {}
 		ElementFactory (const ElementFactory &);
 		ElementFactory operator= (const ElementFactory &);
-		~ElementFactory() {}
+		~ElementFactory();
 
 	public:
 		Element *createElement (const ElementsLocation &, QGraphicsItem * = nullptr, int * = nullptr);
+		int prototypesCount() const;
+		QList<const ElementPrototype *> prototypes() const;
+		void clearPrototypes();
+		void clearPrototypes(QETProject *project);
+
+	private:
+		Element *newElement(const ElementsLocation &location,
+							const QString &link_type,
+							QGraphicsItem *qgi,
+							int *state,
+							const ElementPrototype *prototype = nullptr);
+		const ElementPrototype *prototype(const ElementsLocation &location,
+										  const QUuid &uuid);
+		static QString linkType(const ElementsLocation &location);
+
+	private:
+		QHash<QPair<QString, QUuid>, ElementPrototype *> m_prototypes;
+		int m_cache_generation = 0;
 };
 //ElementFactory ElementFactory::factory_ = 0;
 #endif // ELEMENTFACTORY_H
@@ -114,6 +114,49 @@ QPixmap ElementPictureFactory::pixmap(const ElementsLocation &location)
 }
 
 
+/**
+	@brief ElementPictureFactory::cacheStatistics
+	@return the number of entries and the estimated size in bytes
+	of each cache of the factory.
+	The size of a picture is the size of its recorded data,
+	the size of a pixmap is computed from its size and its depth.
+*/
+ElementPictureFactory::CacheStatistics ElementPictureFactory::cacheStatistics() const
+{
+	CacheStatistics stats;
+
+	stats.pictures = m_pictures_H.size();
+	for (const auto &picture : m_pictures_H) {
+		stats.pictures_bytes += picture.size();
+	}
+
+	stats.low_pictures = m_low_pictures_H.size();
+	for (const auto &picture : m_low_pictures_H) {
+		stats.low_pictures_bytes += picture.size();
+	}
+
+	stats.pixmaps = m_pixmap_H.size();
+	for (const auto &pixmap : m_pixmap_H) {
+		stats.pixmaps_bytes += qint64(pixmap.width()) * pixmap.height() * pixmap.depth() / 8;
+	}
+
+	stats.primitives = m_primitives_H.size();
+	for (const auto &prim : m_primitives_H)
+	{
+		stats.primitives_bytes += prim.m_lines.size() * sizeof(QLineF)
+				+ (prim.m_rectangles.size() + prim.m_circles.size()) * sizeof(QRectF)
+				+ prim.m_texts.size() * sizeof(QGraphicsSimpleTextItem);
+		for (const auto &polygon : prim.m_polygons) {
+			stats.primitives_bytes += polygon.size() * sizeof(QPointF);
+		}
+		for (const auto &arc : prim.m_arcs) {
+			stats.primitives_bytes += arc.size() * sizeof(qreal);
+		}
+	}
+
+	return stats;
+}
+
 /**
 	@brief ElementPictureFactory::getPrimitives
 	@param location
@@ -46,6 +46,22 @@ class ElementPictureFactory
 			QList<QVector<qreal>> m_arcs;
 			QList<QGraphicsSimpleTextItem*> m_texts;
 		};
+
+		/**
+			@brief The CacheStatistics struct
+			Size of the caches of the factory, see ElementPictureFactory::cacheStatistics
+		*/
+		struct CacheStatistics
+		{
+			int pictures = 0;
+			qint64 pictures_bytes = 0;
+			int low_pictures = 0;
+			qint64 low_pictures_bytes = 0;
+			int pixmaps = 0;
+			qint64 pixmaps_bytes = 0;
+			int primitives = 0;
+			qint64 primitives_bytes = 0;
+		};
 		
 		
 		/**
@@ -85,6 +101,7 @@ class ElementPictureFactory
 		void getPictures(const ElementsLocation &location, QPicture &picture, QPicture &low_picture);
 		QPixmap pixmap(const ElementsLocation &location);
 		ElementPictureFactory::primitives getPrimitives(const ElementsLocation &location);
+		CacheStatistics cacheStatistics() const;
 		
 	private:
 		ElementPictureFactory() {}
@@ -77,6 +77,29 @@ PropertiesEditorWidget *PropertiesEditorFactory::propertiesEditor(
 		QList<QGraphicsItem *> items,
 		PropertiesEditorWidget *editor,
 		QWidget *parent)
+{
+	QList<PropertiesEditorWidget *> recyclable;
+	if (editor) {
+		recyclable << editor;
+	}
+	return propertiesEditor(items, recyclable, parent);
+}
+
+/**
+	@brief propertiesEditor
+	@param items : The items to be edited
+	@param recyclable :
+	Editors no longer used. If one of them is of the class of
+	the properties editor to be created, this function set items
+	as edited items of this editor and return it, instead of
+	building a new editor.
+	@param parent : parent widget of the returned editor
+	@return : an editor or nullptr;
+*/
+PropertiesEditorWidget *PropertiesEditorFactory::propertiesEditor(
+		QList<QGraphicsItem *> items,
+		const QList<PropertiesEditorWidget *> &recyclable,
+		QWidget *parent)
 {
 	const int count_ = items.size();
 	if (count_ == 0) {
@@ -93,10 +116,16 @@ PropertiesEditorWidget *PropertiesEditorFactory::propertiesEditor(
 		}
 	}
 
-	QString class_name;
-	if (editor) {
-		class_name = editor->metaObject()->className();
-	}
+		//Return the recyclable editor of class meta_object, if any
+	auto recycled = [&recyclable](const QMetaObject &meta_object) -> PropertiesEditorWidget *
+	{
+		for (auto editor : recyclable) {
+			if (editor && editor->metaObject() == &meta_object) {
+				return editor;
+			}
+		}
+		return nullptr;
+	};
 
 	switch (type_)
 	{
@@ -109,10 +138,10 @@ PropertiesEditorWidget *PropertiesEditorFactory::propertiesEditor(
 			//auto created_editor = new ElementPropertiesWidget(elmt, parent);
 
 				//We already edit an element, just update the editor with a new element
-			if (class_name == ElementPropertiesWidget::staticMetaObject.className())
+			if (auto editor = recycled(ElementPropertiesWidget::staticMetaObject))
 			{
 				static_cast<ElementPropertiesWidget*>(editor)->setElement(elmt);
-				return  editor;
+				return editor;
 			}
 			return  new ElementPropertiesWidget(elmt, parent);
 		}
@@ -123,10 +152,10 @@ PropertiesEditorWidget *PropertiesEditorFactory::propertiesEditor(
 				text_list.append(static_cast<IndependentTextItem*>(qgi));
 			}
 
-			if (class_name == IndiTextPropertiesWidget::staticMetaObject.className())
+			if (auto editor = recycled(IndiTextPropertiesWidget::staticMetaObject))
 			{
 				static_cast<IndiTextPropertiesWidget*>(editor)->setText(text_list);
-				return  editor;
+				return editor;
 			}
 
 			return new IndiTextPropertiesWidget(text_list, parent);
@@ -136,7 +165,13 @@ PropertiesEditorWidget *PropertiesEditorFactory::propertiesEditor(
 			if (count_ > 1) {
 				return nullptr;
 			}
-			return new ImagePropertiesWidget(static_cast<DiagramImageItem*>(item), parent);
+			auto image = static_cast<DiagramImageItem*>(item);
+			if (auto editor = recycled(ImagePropertiesWidget::staticMetaObject))
+			{
+				static_cast<ImagePropertiesWidget*>(editor)->setImageItem(image);
+				return editor;
+			}
+			return new ImagePropertiesWidget(image, parent);
 		}
 		case QetShapeItem::Type: //1008
 		{
@@ -145,7 +180,7 @@ PropertiesEditorWidget *PropertiesEditorFactory::propertiesEditor(
 				shapes_list.append(static_cast<QetShapeItem*>(qgi));
 			}
 
-			if (class_name == ShapeGraphicsItemPropertiesWidget::staticMetaObject.className())
+			if (auto editor = recycled(ShapeGraphicsItemPropertiesWidget::staticMetaObject))
 			{
 				static_cast<ShapeGraphicsItemPropertiesWidget*>(editor)->setItems(shapes_list);
 				return editor;
@@ -162,7 +197,7 @@ PropertiesEditorWidget *PropertiesEditorFactory::propertiesEditor(
 			DynamicElementTextItem *deti = static_cast<DynamicElementTextItem *>(item); 
 				//For dynamic element text, we open the element editor to edit it
 				//If we already edit an element, just update the editor with a new element
-			if (class_name == ElementPropertiesWidget::staticMetaObject.className())
+			if (auto editor = recycled(ElementPropertiesWidget::staticMetaObject))
 			{
 				static_cast<ElementPropertiesWidget*>(editor)->setDynamicText(deti);
 				return editor;
@@ -179,9 +214,9 @@ PropertiesEditorWidget *PropertiesEditorFactory::propertiesEditor(
 			{
 					//For element text item group, we open the element editor to edit it
 					//If we already edit an element, just update the editor with a new element
-				if(class_name == ElementPropertiesWidget::staticMetaObject.className())
+				if (auto editor = recycled(ElementPropertiesWidget::staticMetaObject))
 				{
-					static_cast<ElementPropertiesWidget *>(editor)->setTextsGroup(group);
+					static_cast<ElementPropertiesWidget*>(editor)->setTextsGroup(group);
 					return editor;
 				}
 				return new ElementPropertiesWidget(group, parent);
@@ -195,7 +230,7 @@ PropertiesEditorWidget *PropertiesEditorFactory::propertiesEditor(
 			}
 
 			auto table = static_cast<QetGraphicsTableItem*>(item);
-			if (class_name == GraphicsTablePropertiesEditor::staticMetaObject.className())
+			if (auto editor = recycled(GraphicsTablePropertiesEditor::staticMetaObject))
 			{
 				static_cast<GraphicsTablePropertiesEditor*>(editor)->setTable(table);
 				return editor;
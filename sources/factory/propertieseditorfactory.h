@@ -29,6 +29,7 @@ namespace PropertiesEditorFactory
 {
 	PropertiesEditorWidget *propertiesEditor(QAbstractItemModel *model, PropertiesEditorWidget *editor = nullptr, QWidget *parent=nullptr);
 	PropertiesEditorWidget *propertiesEditor(QList<QGraphicsItem *> items, PropertiesEditorWidget *editor = nullptr, QWidget *parent = nullptr);
+	PropertiesEditorWidget *propertiesEditor(QList<QGraphicsItem *> items, const QList<PropertiesEditorWidget *> &recyclable, QWidget *parent = nullptr);
 }
 
 #endif // PROPERTIESEDITORFACTORY_H
@@ -0,0 +1,270 @@
+/*
+	Copyright 2006-2026 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech. If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "folioprefetcher.h"
+
+#include "diagram.h"
+#include "diagramview.h"
+#include "qetgraphicsitem/conductor.h"
+#include "qetgraphicsitem/element.h"
+
+#include <QElapsedTimer>
+#include <QImage>
+#include <QtMath>
+#include <QPainter>
+#include <QSettings>
+
+	/// Delay in ms between the display of a folio and the start of the warm up
+static const int START_DELAY = 300;
+	/// Height of the bands rendered before the render cost of a line is measured
+static const int FIRST_BAND_HEIGHT = 16;
+
+/**
+	@brief FolioPrefetcher::FolioPrefetcher
+	@param parent
+*/
+FolioPrefetcher::FolioPrefetcher(QObject *parent) :
+	QObject(parent)
+{
+	m_timer.setSingleShot(true);
+	connect(&m_timer, &QTimer::timeout, this, &FolioPrefetcher::warmUpSlice);
+}
+
+/**
+	@brief FolioPrefetcher::prefetch
+	Stop the current warm up and warm up the folios
+	the user will probably display after the folio at index @a current :
+	the folios next to it, nearest first, then the folios
+	of the cross references of its elements.
+	The warm up start when the application is idle, after a short delay
+	to not slow down a fast navigation between folios.
+	@param views : the views of the folios, in the order of the folios
+	@param current : index in @a views of the folio currently displayed
+*/
+void FolioPrefetcher::prefetch(const QList<DiagramView *> &views, int current)
+{
+	stop();
+
+	QSettings settings;
+	const int folios = settings.value(QStringLiteral("diagrameditor/prefetch-folios"), 2).toInt();
+	m_time_budget = qMax(1, settings.value(QStringLiteral("diagrameditor/prefetch-time-budget"), 10).toInt());
+	m_memory_budget = qMax(256, settings.value(QStringLiteral("diagrameditor/prefetch-memory-budget"), 16384).toInt());
+
+	if (folios <= 0 || current < 0 || current >= views.size()) {
+		return;
+	}
+
+		//Forget the folios removed from the project
+	QHash<Diagram *, DiagramView *> views_of_diagrams;
+	for (const auto &view : views) {
+		views_of_diagrams.insert(view->diagram(), view);
+	}
+	for (auto it = m_warm_diagrams.begin() ; it != m_warm_diagrams.end() ; )
+	{
+		if (views_of_diagrams.contains(it.key())) {
+			++it;
+		} else {
+			disconnect(it.value());
+			it = m_warm_diagrams.erase(it);
+		}
+	}
+
+	QList<DiagramView *> candidates;
+	for (int i = 1 ; i <= folios ; ++i)
+	{
+		if (current + i < views.size()) {
+			candidates << views.at(current + i);
+		}
+		if (current - i >= 0) {
+			candidates << views.at(current - i);
+		}
+	}
+
+		//The folios of the cross references, as many as the folios
+		//next to the current folio
+	DiagramView *current_view = views.at(current);
+	int xref_folios = 0;
+	for (const auto &element : current_view->diagram()->elements())
+	{
+		for (const auto &linked_element : element->linkedElements())
+		{
+			auto view = views_of_diagrams.value(linked_element->diagram());
+			if (view &&
+				view != current_view &&
+				!candidates.contains(view) &&
+				xref_folios < 2 * folios)
+			{
+				candidates << view;
+				++xref_folios;
+			}
+		}
+	}
+
+	for (const auto &view : qAsConst(candidates))
+	{
+		if (!m_warm_diagrams.contains(view->diagram())) {
+			m_queue << view;
+		}
+	}
+
+	if (!m_queue.isEmpty()) {
+		m_timer.start(START_DELAY);
+	}
+}
+
+/**
+	@brief FolioPrefetcher::stop
+	Stop the warm up, the folios already warmed up are kept.
+*/
+void FolioPrefetcher::stop()
+{
+	m_timer.stop();
+	m_queue.clear();
+	m_band_y = -1;
+}
+
+/**
+	@brief FolioPrefetcher::warmUpSlice
+	Do the steps of the warm up until the time budget is spent,
+	and schedule the next slice for the next time
+	the application is idle.
+*/
+void FolioPrefetcher::warmUpSlice()
+{
+	QElapsedTimer timer;
+	timer.start();
+
+	const qint64 budget_ns = qint64(m_time_budget) * 1000000;
+	qint64 elapsed_ns = 0;
+	while (!m_queue.isEmpty() && (elapsed_ns = timer.nsecsElapsed()) < budget_ns) {
+		warmUpStep(budget_ns - elapsed_ns);
+	}
+
+	if (!m_queue.isEmpty()) {
+		m_timer.start(0);
+	}
+}
+
+/**
+	@brief FolioPrefetcher::warmUpStep
+	Do one step of the warm up of the first folio of the queue :
+	the junctions of the conductors, then one band of the offscreen image.
+	@param remaining_ns : the time left in the current slice
+*/
+void FolioPrefetcher::warmUpStep(qint64 remaining_ns)
+{
+	DiagramView *view = m_queue.first();
+	if (!view || !view->diagram())
+	{
+		m_queue.removeFirst();
+		m_band_y = -1;
+		return;
+	}
+
+	if (m_band_y < 0)
+	{
+		warmUpConductors(view->diagram());
+		m_band_y = 0;
+		return;
+	}
+
+	if (!renderBand(view, remaining_ns))
+	{
+		setWarm(view->diagram());
+		m_queue.removeFirst();
+		m_band_y = -1;
+	}
+}
+
+/**
+	@brief FolioPrefetcher::warmUpConductors
+	Compute the junctions of the conductors of @a diagram,
+	which are cached by the conductors.
+	@param diagram
+*/
+void FolioPrefetcher::warmUpConductors(Diagram *diagram)
+{
+	for (const auto &conductor : diagram->conductors()) {
+		conductor->junctions();
+	}
+}
+
+/**
+	@brief FolioPrefetcher::renderBand
+	Render in an offscreen image the band starting at m_band_y of what
+	@a view displays, with the zoom of the view, so the caches are filled
+	with the same glyphs and pictures as the ones used when the view
+	will be painted.
+	The height of the band is limited by the memory budget and by the
+	number of lines which can be rendered in @a remaining_ns, according
+	to the render cost of a line measured on the previous bands.
+	@param view
+	@param remaining_ns : the time left in the current slice
+	@return true if there is other bands to render
+*/
+bool FolioPrefetcher::renderBand(DiagramView *view, qint64 remaining_ns)
+{
+	const QRect rect = view->viewport()->rect();
+	const int y = m_band_y;
+	if (rect.isEmpty() || y >= rect.height()) {
+		return false;
+	}
+
+	const qreal ratio = view->devicePixelRatioF();
+	const qint64 line_bytes = qMax<qint64>(1, qCeil(rect.width() * ratio) * 4 * ratio);
+	int band_height = int(qMin<qint64>(m_memory_budget * 1024 / line_bytes, rect.height()));
+	if (m_line_cost > 0) {
+		band_height = int(qMin<qreal>(band_height, remaining_ns / m_line_cost));
+	} else {
+		band_height = qMin(band_height, FIRST_BAND_HEIGHT);
+	}
+	const int height = qBound(1, band_height, rect.height() - y);
+
+	QElapsedTimer timer;
+	timer.start();
+
+	QImage image(QSize(qCeil(rect.width() * ratio), qCeil(height * ratio)),
+				 QImage::Format_ARGB32_Premultiplied);
+	image.setDevicePixelRatio(ratio);
+	QPainter painter(&image);
+	painter.setRenderHints(view->renderHints());
+	view->render(&painter,
+				 QRectF(0, 0, rect.width(), height),
+				 QRect(0, y, rect.width(), height));
+	painter.end();
+
+		//The cost depend on the content of the band, smooth it
+	const qreal line_cost = qreal(timer.nsecsElapsed()) / height;
+	m_line_cost = m_line_cost > 0 ? (m_line_cost + line_cost) / 2
+								   : line_cost;
+
+	m_band_y = y + height;
+	return m_band_y < rect.height();
+}
+
+/**
+	@brief FolioPrefetcher::setWarm
+	Remember that @a diagram is warmed up, until it change.
+	@param diagram
+*/
+void FolioPrefetcher::setWarm(Diagram *diagram)
+{
+	m_warm_diagrams.insert(diagram,
+						   connect(diagram, &QGraphicsScene::changed, this, [this, diagram]() {
+		disconnect(m_warm_diagrams.take(diagram));
+	}));
+}
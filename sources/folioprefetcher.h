@@ -0,0 +1,89 @@
+/*
+	Copyright 2006-2026 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech. If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef FOLIOPREFETCHER_H
+#define FOLIOPREFETCHER_H
+
+#include <QHash>
+#include <QObject>
+#include <QPointer>
+#include <QTimer>
+
+class Diagram;
+class DiagramView;
+
+/**
+	@brief The FolioPrefetcher class
+	Warm up, when the application is idle, the folios the user
+	will probably display next : the folios next to the current folio
+	and the folios of the cross references of the current folio.
+
+	Warming up a folio computes the junctions of its conductors
+	(see Conductor::junctions) and renders what its view displays
+	in an offscreen image, so the texts layouts, the glyphs and the
+	pictures used by the items are in the caches of Qt when the folio
+	is displayed for the first time.
+
+	The work is done by slices which don't last longer than
+	the time budget, and the offscreen image is rendered by bands
+	which don't use more memory than the memory budget.
+	The height of a band is also limited by the time left in the slice,
+	from the render cost of a line measured on the previous bands,
+	so a band of a dense folio doesn't exceed the time budget.
+	The budgets and the number of folios are read from the settings :
+	@li diagrameditor/prefetch-folios : the number of folios warmed up
+	before and after the current folio, 0 disable the prefetcher.
+	@li diagrameditor/prefetch-time-budget : the maximum duration
+	of a slice in ms.
+	@li diagrameditor/prefetch-memory-budget : the maximum size
+	of the offscreen image in Kio.
+*/
+class FolioPrefetcher : public QObject
+{
+	Q_OBJECT
+
+	public:
+		FolioPrefetcher(QObject *parent = nullptr);
+
+		void prefetch(const QList<DiagramView *> &views, int current);
+		void stop();
+
+	private slots:
+		void warmUpSlice();
+
+	private:
+		void warmUpStep(qint64 remaining_ns);
+		void warmUpConductors(Diagram *diagram);
+		bool renderBand(DiagramView *view, qint64 remaining_ns);
+		void setWarm(Diagram *diagram);
+
+	private:
+		QTimer m_timer;
+		QList<QPointer<DiagramView>> m_queue;
+			/// Top of the next band of the first view of m_queue to render, -1 if the conductors are not yet warmed up
+		int m_band_y = -1;
+			/// Measured render cost of a line of the offscreen image in ns, 0 if not yet measured
+		qreal m_line_cost = 0;
+			/// Maximum duration of a slice in ms
+		int m_time_budget = 10;
+			/// Maximum size of the offscreen image in Kio
+		qint64 m_memory_budget = 16384;
+			/// The folios already warmed up, forgotten as soon as they change
+		QHash<Diagram *, QMetaObject::Connection> m_warm_diagrams;
+};
+
+#endif // FOLIOPREFETCHER_H
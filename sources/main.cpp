@@ -22,6 +22,7 @@
 #include "utils/macosxopenevent.h"
 #include "utils/qetsettings.h"
 
+#include <QApplication>
 #include <QStyleFactory>
 #include <QtConcurrentRun>
 
@@ -194,6 +195,19 @@ QGuiApplication::setHighDpiScaleFactorRoundingPolicy(QetSettings::hdpiScaleFacto
 #endif
 
 
+	//The command line tools run in this process and return their own exit code,
+	//so they must not be forwarded to an already running instance.
+	QList<QString> arg_list;
+	for (int i = 1 ; i < argc ; ++i) {
+		arg_list << QString::fromLocal8Bit(argv[i]);
+	}
+	if (QETArguments(arg_list).commandLineToolRequested())
+	{
+		QApplication app(argc, argv);
+		QETApp qetapp; //Run the tool and exit
+		return EXIT_FAILURE;
+	}
+
 	SingleApplication app(argc, argv, true);
 #ifdef Q_OS_MACOS
 	//Handle the opening of QET when user double click on a .qet .elmt .tbt file
@@ -0,0 +1,231 @@
+/*
+	Copyright 2006-2026 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech. If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "projectchangebus.h"
+
+#include <QPair>
+#include <QTimer>
+
+#include <algorithm>
+
+/**
+	@brief ProjectChangeBus::Subscriptions::add
+	Add the subscription @a id of @a bus to this list.
+	If the subscriptions of the list belong to another bus,
+	they are removed first.
+	@param bus
+	@param id
+*/
+void ProjectChangeBus::Subscriptions::add(ProjectChangeBus *bus, int id)
+{
+	if (m_bus != bus)
+	{
+		clear();
+		m_bus = bus;
+	}
+	m_ids.append(id);
+}
+
+/**
+	@brief ProjectChangeBus::Subscriptions::clear
+	Remove every subscription of this list from the bus
+*/
+void ProjectChangeBus::Subscriptions::clear()
+{
+	if (m_bus) {
+		for (const auto &id : qAsConst(m_ids)) {
+			m_bus->unsubscribe(id);
+		}
+	}
+	m_ids.clear();
+}
+
+/**
+	@brief ProjectChangeBus::ProjectChangeBus
+	@param parent
+*/
+ProjectChangeBus::ProjectChangeBus(QObject *parent) :
+	QObject(parent)
+{}
+
+/**
+	@brief ProjectChangeBus::unsubscribe
+	Remove the subscription @a id
+	@param id
+*/
+void ProjectChangeBus::unsubscribe(int id)
+{
+	if (m_tearing_down) {
+		return;
+	}
+
+	const auto it = m_subscriptions.find(id);
+	if (it == m_subscriptions.end()) {
+		return;
+	}
+
+	auto index_it = m_index.find(it->key);
+	if (index_it != m_index.end())
+	{
+		index_it->remove(id);
+		if (index_it->isEmpty()) {
+			m_index.erase(index_it);
+		}
+	}
+	m_subscriptions.erase(it);
+}
+
+/**
+	@brief ProjectChangeBus::publish
+	Publish a change of the key (@a topic, @a uuid).
+	The subscribers are called at the next turn of the event loop,
+	or by flush().
+	@param topic
+	@param uuid
+*/
+void ProjectChangeBus::publish(ProjectChangeBus::Topic topic, const QUuid &uuid)
+{
+	if (m_tearing_down) {
+		return;
+	}
+
+	const Key key{topic, uuid};
+		//Nobody watch this key, nothing to queue
+	if (!m_index.contains(key) || m_pending_keys.contains(key)) {
+		return;
+	}
+
+	m_pending.append(key);
+	m_pending_keys.insert(key);
+	if (!m_flush_scheduled)
+	{
+		m_flush_scheduled = true;
+		QTimer::singleShot(0, this, &ProjectChangeBus::flush);
+	}
+}
+
+/**
+	@brief ProjectChangeBus::flush
+	Deliver now the pending changes.
+	Each receiver is called once per slot, whatever the number
+	of changed keys it watch.
+	The changes published by the subscribers during the delivery
+	are delivered in the next batch.
+*/
+void ProjectChangeBus::flush()
+{
+	m_flush_scheduled = false;
+	if (m_pending.isEmpty()) {
+		return;
+	}
+
+	const auto keys = m_pending;
+	m_pending.clear();
+	m_pending_keys.clear();
+
+	QVector<int> ids;
+	for (const auto &key : keys)
+	{
+		const auto key_ids = m_index.value(key);
+		for (const auto &id : key_ids) {
+			ids.append(id);
+		}
+	}
+		//The ids grow with the subscriptions,
+		//the subscribers are called in the order they subscribed
+	std::sort(ids.begin(), ids.end());
+
+	QSet<QPair<QObject *, QByteArray>> called;
+	for (const auto &id : qAsConst(ids))
+	{
+			//A previous subscriber can remove this subscription
+		const auto it = m_subscriptions.constFind(id);
+		if (it == m_subscriptions.constEnd()) {
+			continue;
+		}
+
+		if (it->receiver.isNull())
+		{
+			unsubscribe(id);
+			continue;
+		}
+
+		const auto pair = qMakePair(it->receiver.data(), it->slot_id);
+		if (called.contains(pair)) {
+			continue;
+		}
+		called.insert(pair);
+
+			//Copy the callback, the subscription can be removed by the call
+		const auto callback = it->callback;
+		callback();
+	}
+}
+
+/**
+	@brief ProjectChangeBus::beginTeardown
+	Drop every subscription and pending change, then ignore
+	the next calls of subscribe, unsubscribe and publish.
+	Called when the project is deleted.
+*/
+void ProjectChangeBus::beginTeardown()
+{
+	m_tearing_down = true;
+	m_subscriptions.clear();
+	m_index.clear();
+	m_pending.clear();
+	m_pending_keys.clear();
+}
+
+/**
+	@brief ProjectChangeBus::subscriptionsCount
+	@return the number of subscriptions
+*/
+int ProjectChangeBus::subscriptionsCount() const
+{
+	return m_subscriptions.size();
+}
+
+/**
+	@brief ProjectChangeBus::addSubscription
+	@param key : the key to watch
+	@param receiver : the object which own the subscription
+	@param slot_id : identify the slot of @a receiver,
+	used to call it only once per batch
+	@param callback : the function to call
+	@return the id of the subscription, 0 if the bus is being torn down
+*/
+int ProjectChangeBus::addSubscription(const ProjectChangeBus::Key &key,
+									  QObject *receiver,
+									  const QByteArray &slot_id,
+									  std::function<void ()> callback)
+{
+	if (m_tearing_down) {
+		return 0;
+	}
+
+	Subscription subscription;
+	subscription.key = key;
+	subscription.receiver = receiver;
+	subscription.slot_id = slot_id;
+	subscription.callback = std::move(callback);
+
+	const int id = m_next_id++;
+	m_subscriptions.insert(id, subscription);
+	m_index[key].insert(id);
+	return id;
+}
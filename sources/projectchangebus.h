@@ -0,0 +1,168 @@
+/*
+	Copyright 2006-2026 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech. If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef PROJECTCHANGEBUS_H
+#define PROJECTCHANGEBUS_H
+
+#include <QHash>
+#include <QObject>
+#include <QPointer>
+#include <QSet>
+#include <QUuid>
+#include <QVector>
+
+#include <functional>
+
+/**
+	@brief The ProjectChangeBus class
+	Deliver the changes of a project to the items which depend on them,
+	instead of connecting each item to the signals of every object it watch.
+
+	An item subscribe to a key : a topic and the uuid of the changed object
+	(element, folio) or a null uuid for the topics related to the whole project.
+	When a change is published, the key is queued and the subscribers
+	are called once, at the next turn of the event loop.
+	Several changes published in the same turn are delivered in a single batch,
+	and a subscriber which watch several of the changed keys
+	with the same slot is called only once.
+
+	The subscriptions are not QObject connections : a subscription
+	only cost an entry in two hash tables. A subscriber must remove
+	its subscriptions when it no longer need them, ProjectChangeBus::Subscriptions
+	do it automatically. The subscriptions of a deleted receiver are ignored
+	and removed at the next delivery.
+
+	When the project is deleted, beginTeardown() drop every subscription
+	at once, the items deleted after don't cost anything to the bus.
+*/
+class ProjectChangeBus : public QObject
+{
+	Q_OBJECT
+
+	public:
+		enum Topic {
+			ElementPosition,	///< uuid of the element
+			ElementInformation, ///< uuid of the element
+			FolioTitleBlock,	///< uuid of the folio, the folio field of the title block
+			FolioInformation,	///< uuid of the folio
+			FolioPosition,		///< uuid of the folio, the index or the total of the folio
+			XRefProperties,		///< null uuid
+			ReportProperties	///< null uuid
+		};
+		Q_ENUM(Topic)
+
+		/**
+			@brief The Key struct
+			What a subscriber watch
+		*/
+		struct Key
+		{
+			Topic topic = ElementPosition;
+			QUuid uuid;
+
+			bool operator== (const Key &other) const {
+				return topic == other.topic && uuid == other.uuid;
+			}
+
+			friend inline uint qHash(const Key &key, uint seed = 0) {
+				return qHash(key.uuid, seed) ^ uint(key.topic);
+			}
+		};
+
+		/**
+			@brief The Subscriptions class
+			A list of subscriptions to a bus, removed from the bus
+			when the list is cleared or destroyed.
+			Used by the items as a replacement of a list of QMetaObject::Connection.
+		*/
+		class Subscriptions
+		{
+			public:
+				Subscriptions() {}
+				~Subscriptions() {clear();}
+
+				/**
+					@brief subscribe
+					Subscribe @a slot of @a receiver to @a bus
+					and keep the subscription in this list.
+				*/
+				template <typename Receiver>
+				void subscribe(ProjectChangeBus *bus, Topic topic, const QUuid &uuid,
+							   Receiver *receiver, void (Receiver::*slot)()) {
+					add(bus, bus->subscribe(topic, uuid, receiver, slot));
+				}
+
+				void add(ProjectChangeBus *bus, int id);
+				void clear();
+				bool isEmpty() const {return m_ids.isEmpty();}
+
+			private:
+				Subscriptions(const Subscriptions &);
+				Subscriptions &operator= (const Subscriptions &);
+
+				QPointer<ProjectChangeBus> m_bus;
+				QVector<int> m_ids;
+		};
+
+		explicit ProjectChangeBus(QObject *parent = nullptr);
+
+		/**
+			@brief subscribe
+			Call @a slot of @a receiver when the key (@a topic, @a uuid) change.
+			@return the id of the subscription
+		*/
+		template <typename Receiver>
+		int subscribe(Topic topic, const QUuid &uuid,
+					  Receiver *receiver, void (Receiver::*slot)())
+		{
+			return addSubscription(Key{topic, uuid}, receiver,
+								   QByteArray(reinterpret_cast<const char *>(&slot), sizeof(slot)),
+								   [receiver, slot]() {(receiver->*slot)();});
+		}
+
+		void unsubscribe(int id);
+		void publish(Topic topic, const QUuid &uuid = QUuid());
+		void flush();
+		int subscriptionsCount() const;
+		void beginTeardown();
+
+	private:
+		int addSubscription(const Key &key,
+							QObject *receiver,
+							const QByteArray &slot_id,
+							std::function<void()> callback);
+
+	private:
+		struct Subscription
+		{
+			Key key;
+			QPointer<QObject> receiver;
+			QByteArray slot_id;
+			std::function<void()> callback;
+		};
+
+		QHash<int, Subscription> m_subscriptions;
+			///Ids of the subscriptions of each key, a set so removing one is O(1)
+		QHash<Key, QSet<int>> m_index;
+		QVector<Key> m_pending;
+		QSet<Key> m_pending_keys;
+		int m_next_id = 1;
+		bool m_flush_scheduled = false;
+		bool m_tearing_down = false;
+};
+
+#endif // PROJECTCHANGEBUS_H
@@ -0,0 +1,370 @@
+/*
+	Copyright 2006-2026 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech. If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "projectconsistencychecker.h"
+
+#include "ElementsCollection/xmlelementcollection.h"
+#include "TerminalStrip/realterminal.h"
+#include "TerminalStrip/terminalstrip.h"
+#include "diagram.h"
+#include "qetgraphicsitem/conductor.h"
+#include "qetgraphicsitem/element.h"
+#include "qetgraphicsitem/qetgraphicsitem.h"
+#include "qetproject.h"
+
+#include <QGraphicsView>
+#include <QtConcurrentMap>
+
+namespace
+{
+		/**
+			The items of a folio, collected in the gui thread
+			because QGraphicsScene::items() can update the index of the scene.
+		*/
+	struct FolioInput
+	{
+		Diagram *diagram = nullptr;
+		QList<Element *> elements;
+		QList<Conductor *> conductors;
+	};
+
+		/**
+			The index of a folio built by a worker thread.
+		*/
+	struct FolioIndex
+	{
+		QVector<ProjectConsistencyChecker::Issue> issues;
+		QVector<QPair<QString, Element *>> master_labels;
+		QSet<QString> used_locations;
+	};
+
+	QString folioName(Diagram *diagram)
+	{
+		return QObject::tr("Folio %1 (%2)")
+				.arg(diagram->folioIndex() + 1)
+				.arg(diagram->title());
+	}
+
+	ProjectConsistencyChecker::Issue makeIssue(
+			ProjectConsistencyChecker::Check check,
+			ProjectConsistencyChecker::Severity severity,
+			const QString &message,
+			Diagram *diagram = nullptr,
+			QGraphicsObject *item = nullptr)
+	{
+		ProjectConsistencyChecker::Issue issue;
+		issue.check = check;
+		issue.severity = severity;
+		issue.message = message;
+		issue.diagram = diagram;
+		issue.item = item;
+		return issue;
+	}
+
+		/**
+			Index one folio and do the checks which only need this folio.
+			Only read the items, never modify it, because this function
+			is called from a worker thread.
+		*/
+	FolioIndex indexFolio(const FolioInput &input, int checks)
+	{
+		FolioIndex index;
+		typedef ProjectConsistencyChecker pcc;
+
+		for (const auto &element : input.elements)
+		{
+			index.used_locations.insert(element->location().collectionPath());
+
+			const auto link_type = element->linkType();
+			const auto label = element->elementInformations()
+							   .value(QStringLiteral("label")).toString();
+
+			if ((checks & pcc::UnlinkedSlave) &&
+				link_type == Element::Slave &&
+				element->isFree())
+			{
+				index.issues.append(makeIssue(pcc::UnlinkedSlave, pcc::Warning,
+											  QObject::tr("L'élément esclave %1 n'est lié à aucun élément maître")
+											  .arg(label.isEmpty() ? element->name() : label),
+											  input.diagram, element));
+			}
+			else if ((checks & pcc::UnlinkedReport) &&
+					 (link_type & Element::AllReport) &&
+					 element->isFree())
+			{
+				index.issues.append(makeIssue(pcc::UnlinkedReport, pcc::Warning,
+											  QObject::tr("Le report de folio %1 n'est lié à aucun autre report")
+											  .arg(element->name()),
+											  input.diagram, element));
+			}
+			else if ((checks & pcc::DuplicateLabel) &&
+					 link_type == Element::Master &&
+					 !label.isEmpty())
+			{
+				index.master_labels.append(qMakePair(label, element));
+			}
+		}
+
+		if (checks & pcc::PotentialTextMismatch)
+		{
+			QSet<Conductor *> done;
+			for (const auto &conductor : input.conductors)
+			{
+				if (done.contains(conductor)) {
+					continue;
+				}
+
+				auto potential = conductor->relatedPotentialConductors(false);
+				potential.insert(conductor);
+
+				QSet<QString> texts;
+				for (const auto &c : qAsConst(potential)) {
+					done.insert(c);
+					texts.insert(c->properties().text);
+				}
+
+				if (texts.size() > 1)
+				{
+					auto texts_list = texts.values();
+					texts_list.sort();
+					index.issues.append(makeIssue(pcc::PotentialTextMismatch, pcc::Warning,
+												  QObject::tr("Les conducteurs d'un même potentiel ont des textes différents : %1")
+												  .arg(texts_list.join(QStringLiteral(", "))),
+												  input.diagram, conductor));
+				}
+			}
+		}
+
+		return index;
+	}
+
+		/**
+			Functor used by QtConcurrent to index the folios
+		*/
+	struct FolioIndexer
+	{
+		typedef FolioIndex result_type;
+		int checks = ProjectConsistencyChecker::AllChecks;
+
+		FolioIndex operator()(const FolioInput &input) const {
+			return indexFolio(input, checks);
+		}
+	};
+}
+
+/**
+	@brief ProjectConsistencyChecker::ProjectConsistencyChecker
+	@param project : project to check
+*/
+ProjectConsistencyChecker::ProjectConsistencyChecker(QETProject *project) :
+	m_project(project)
+{}
+
+/**
+	@brief ProjectConsistencyChecker::check
+	Check the project.
+	Must be called from the thread of the project (the gui thread),
+	the folios are indexed in parallel by worker threads, this function
+	block until every folio is indexed.
+	@param checks : the checks to do, an OR combination of
+	ProjectConsistencyChecker::Check
+	@return the issues found
+*/
+QVector<ProjectConsistencyChecker::Issue> ProjectConsistencyChecker::check(int checks) const
+{
+	QVector<Issue> issues;
+	if (!m_project) {
+		return issues;
+	}
+
+	const auto diagrams = m_project->diagrams();
+
+	QVector<FolioInput> inputs;
+	inputs.reserve(diagrams.size());
+	for (const auto &diagram : diagrams)
+	{
+		FolioInput input;
+		input.diagram = diagram;
+		for (const auto &item : diagram->items())
+		{
+			if (auto element = qgraphicsitem_cast<Element *>(item)) {
+				input.elements.append(element);
+			} else if (auto conductor = qgraphicsitem_cast<Conductor *>(item)) {
+				input.conductors.append(conductor);
+			}
+		}
+		inputs.append(input);
+	}
+
+	FolioIndexer indexer;
+	indexer.checks = checks;
+	const auto indexes = QtConcurrent::blockingMapped<QVector<FolioIndex>>(inputs, indexer);
+
+		//Merge the index of each folio
+	QHash<QString, QVector<Element *>> master_labels;
+	QSet<QString> used_locations;
+	QSet<Element *> project_elements;
+	for (int i = 0 ; i < indexes.size() ; ++i)
+	{
+		const auto &index = indexes.at(i);
+		issues += index.issues;
+		for (const auto &pair : index.master_labels) {
+			master_labels[pair.first].append(pair.second);
+		}
+		used_locations.unite(index.used_locations);
+		for (const auto &element : inputs.at(i).elements) {
+			project_elements.insert(element);
+		}
+	}
+
+	if (checks & DuplicateLabel)
+	{
+		for (auto it = master_labels.constBegin() ; it != master_labels.constEnd() ; ++it)
+		{
+			if (it.value().size() < 2) {
+				continue;
+			}
+			for (const auto &element : it.value())
+			{
+				issues.append(makeIssue(DuplicateLabel, Error,
+										QObject::tr("Le label %1 est utilisé par %2 éléments maîtres")
+										.arg(it.key())
+										.arg(it.value().size()),
+										element->diagram(), element));
+			}
+		}
+	}
+
+	if (checks & DanglingTerminalStripReference)
+	{
+		for (const auto &strip : m_project->terminalStrip())
+		{
+			for (const auto &real_t : strip->realTerminals())
+			{
+				const auto element = real_t->element();
+				if (!element || !project_elements.contains(element))
+				{
+					issues.append(makeIssue(DanglingTerminalStripReference, Error,
+											QObject::tr("Le bornier %1 référence une borne absente des folios du projet")
+											.arg(strip->name())));
+				}
+			}
+				//The terminals which were not found when the project was loaded
+			for (const auto &uuid : strip->unresolvedTerminals())
+			{
+				issues.append(makeIssue(DanglingTerminalStripReference, Error,
+										QObject::tr("Le bornier %1 référence une borne inconnue (%2)")
+										.arg(strip->name(), uuid.toString())));
+			}
+		}
+	}
+
+	if ((checks & UnusedEmbeddedElement) &&
+		m_project->embeddedElementCollection())
+	{
+		const auto locations = m_project->embeddedElementCollection()->elementsLocation();
+		for (const auto &location : locations)
+		{
+			if (location.isElement() &&
+				!used_locations.contains(location.collectionPath()))
+			{
+				auto issue = makeIssue(UnusedEmbeddedElement, Warning,
+									   QObject::tr("L'élément %1 de la collection du projet n'est pas utilisé")
+									   .arg(location.collectionPath()));
+				issue.location = location;
+				issues.append(issue);
+			}
+		}
+	}
+
+	return issues;
+}
+
+/**
+	@brief ProjectConsistencyChecker::checkName
+	@param check
+	@return the human name of @a check
+*/
+QString ProjectConsistencyChecker::checkName(ProjectConsistencyChecker::Check check)
+{
+	switch (check) {
+		case UnlinkedSlave:
+			return QObject::tr("Esclave non lié");
+		case UnlinkedReport:
+			return QObject::tr("Report non lié");
+		case DuplicateLabel:
+			return QObject::tr("Label dupliqué");
+		case DanglingTerminalStripReference:
+			return QObject::tr("Référence de bornier orpheline");
+		case PotentialTextMismatch:
+			return QObject::tr("Textes de potentiel différents");
+		case UnusedEmbeddedElement:
+			return QObject::tr("Élément inutilisé");
+		default:
+			return QString();
+	}
+}
+
+/**
+	@brief ProjectConsistencyChecker::issueToString
+	@param issue
+	@return @a issue as a single line of text, used by the command line report
+*/
+QString ProjectConsistencyChecker::issueToString(const ProjectConsistencyChecker::Issue &issue)
+{
+	QString str = issue.severity == Error ? QStringLiteral("[E] ")
+										  : QStringLiteral("[W] ");
+	str += checkName(issue.check);
+	if (issue.diagram) {
+		str += QStringLiteral(" - ") + folioName(issue.diagram);
+	}
+	str += QStringLiteral(" : ") + issue.message;
+	return str;
+}
+
+/**
+	@brief ProjectConsistencyChecker::showIssue
+	Show the folio and select the item related to @a issue
+	@param issue
+*/
+void ProjectConsistencyChecker::showIssue(const ProjectConsistencyChecker::Issue &issue)
+{
+	if (!issue.item)
+	{
+		if (issue.diagram) {
+			issue.diagram->showMe();
+		}
+		return;
+	}
+
+	if (auto qgi = qobject_cast<QetGraphicsItem *>(issue.item.data())) {
+		QetGraphicsItem::showItem(qgi);
+	}
+	else if (issue.diagram)
+	{
+		issue.diagram->showMe();
+		issue.diagram->clearSelection();
+		issue.item->setSelected(true);
+
+		for (const auto &view : issue.diagram->views())
+		{
+			QRectF fit = issue.item->sceneBoundingRect();
+			fit.adjust(-200, -200, 200, 200);
+			view->fitInView(fit, Qt::KeepAspectRatioByExpanding);
+		}
+	}
+}
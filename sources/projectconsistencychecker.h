@@ -0,0 +1,85 @@
+/*
+	Copyright 2006-2026 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech. If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef PROJECTCONSISTENCYCHECKER_H
+#define PROJECTCONSISTENCYCHECKER_H
+
+#include <QPointer>
+#include <QGraphicsObject>
+#include <QVector>
+
+#include "ElementsCollection/elementslocation.h"
+
+class QETProject;
+class Diagram;
+
+/**
+	@brief The ProjectConsistencyChecker class
+	Check the consistency of a project and report the found issues.
+	Every check is done in one pass over the project :
+	each folio is indexed in parallel (one worker thread per folio),
+	then the indexes of every folios are merged to do the project wide checks.
+	The checker don't need a gui, it can be used from the command line
+	(see option --check-project).
+*/
+class ProjectConsistencyChecker
+{
+	public:
+		enum Check {
+			UnlinkedSlave = 1,
+			UnlinkedReport = 2,
+			DuplicateLabel = 4,
+			DanglingTerminalStripReference = 8,
+			PotentialTextMismatch = 16,
+			UnusedEmbeddedElement = 32,
+			AllChecks = 63
+		};
+
+		enum Severity {
+			Warning,
+			Error
+		};
+
+		/**
+			@brief The Issue struct
+			An issue found by the checker.
+			item and diagram can be null if the issue
+			isn't related to an item of a folio.
+		*/
+		struct Issue
+		{
+			Check check = UnlinkedSlave;
+			Severity severity = Warning;
+			QString message;
+			QPointer<Diagram> diagram;
+			QPointer<QGraphicsObject> item;
+			ElementsLocation location;
+		};
+
+		ProjectConsistencyChecker(QETProject *project);
+
+		QVector<Issue> check(int checks = AllChecks) const;
+
+		static QString checkName(Check check);
+		static QString issueToString(const Issue &issue);
+		static void showIssue(const Issue &issue);
+
+	private:
+		QPointer<QETProject> m_project;
+};
+
+#endif // PROJECTCONSISTENCYCHECKER_H
@@ -0,0 +1,589 @@
+/*
+	Copyright 2006-2026 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech. If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "projectdiff.h"
+
+#include "TerminalStrip/GraphicsItem/terminalstripitem.h"
+#include "TerminalStrip/terminalstrip.h"
+#include "diagram.h"
+#include "qetgraphicsitem/ViewItem/qetgraphicstableitem.h"
+#include "qetgraphicsitem/conductor.h"
+#include "qetgraphicsitem/diagramimageitem.h"
+#include "qetgraphicsitem/element.h"
+#include "qetgraphicsitem/independenttextitem.h"
+#include "qetgraphicsitem/qetshapeitem.h"
+#include "qetgraphicsitem/terminal.h"
+#include "qetxml.h"
+
+#include <QCryptographicHash>
+#include <QFileInfo>
+#include <QHash>
+#include <QTextDocument>
+
+namespace
+{
+		/**
+			An item of a folio reduced to its key and its hash
+		*/
+	struct CanonicalItem
+	{
+		ProjectDiff::ItemKind kind = ProjectDiff::ElementKind;
+		QByteArray hash;
+		QString description;
+		int order = 0;
+	};
+
+		/**
+			A folio reduced to the canonical form of its items
+		*/
+	struct CanonicalFolio
+	{
+		int index = -1;
+		QString title;
+		QByteArray properties_hash;
+		QHash<QString, CanonicalItem> items;
+	};
+
+	const QHash<QString, ProjectDiff::ItemKind> &sectionKinds()
+	{
+		static const QHash<QString, ProjectDiff::ItemKind> kinds {
+			{QStringLiteral("elements"),             ProjectDiff::ElementKind},
+			{QStringLiteral("conductors"),           ProjectDiff::ConductorKind},
+			{QStringLiteral("inputs"),               ProjectDiff::TextKind},
+			{QStringLiteral("images"),               ProjectDiff::ImageKind},
+			{QStringLiteral("shapes"),               ProjectDiff::ShapeKind},
+			{QStringLiteral("tables"),               ProjectDiff::TableKind},
+			{QStringLiteral("terminal_strip_items"), ProjectDiff::TerminalStripKind}
+		};
+		return kinds;
+	}
+
+		/**
+			Return the hash of @a element independently of the order
+			of its attributes.
+			The children are hashed in their order, the order of the
+			segments of a conductor or of the points of a shape matter.
+			Only the children of "links_uuids" are sorted, the links of an
+			element are a set.
+			The attribute "id" of the terminals is ignored, it's only written
+			for backward compatibility and change at every save, and
+			the attributes equal to their elided default value are ignored,
+			see QETXML::elidedDefaults().
+		*/
+	QByteArray canonicalHash(const QDomElement &element)
+	{
+		QCryptographicHash hash(QCryptographicHash::Sha1);
+		hash.addData(element.tagName().toUtf8());
+
+		const auto attributes = element.attributes();
+		QStringList attributes_list;
+		attributes_list.reserve(attributes.count());
+		const bool is_terminal = element.tagName() == QLatin1String("terminal");
+		const auto &defaults = QETXML::elidedDefaults(element.tagName());
+		for (int i = 0 ; i < attributes.count() ; ++i)
+		{
+			const auto attribute = attributes.item(i).toAttr();
+			if (is_terminal && attribute.name() == QLatin1String("id")) {
+				continue;
+			}
+			const auto default_it = defaults.constFind(attribute.name());
+			if (default_it != defaults.constEnd() && default_it.value() == attribute.value()) {
+				continue;
+			}
+			attributes_list << attribute.name() + QLatin1Char('=') + attribute.value();
+		}
+		attributes_list.sort();
+		for (const auto &str : qAsConst(attributes_list))
+		{
+			hash.addData(str.toUtf8());
+			hash.addData("\0", 1);
+		}
+
+		QVector<QByteArray> children;
+		for (auto node = element.firstChild() ; !node.isNull() ; node = node.nextSibling())
+		{
+			if (node.isElement()) {
+				children << canonicalHash(node.toElement());
+			} else if (node.isText() || node.isCDATASection()) {
+				children << node.nodeValue().toUtf8();
+			}
+		}
+		if (element.tagName() == QLatin1String("links_uuids")) {
+			std::sort(children.begin(), children.end());
+		}
+		for (const auto &child : qAsConst(children)) {
+			hash.addData(child);
+		}
+
+		return hash.result();
+	}
+
+	QString elementDescription(const QDomElement &element)
+	{
+		for (const auto &info : QETXML::subChild(element,
+												 QStringLiteral("elementInformations"),
+												 QStringLiteral("elementInformation")))
+		{
+			if (info.attribute(QStringLiteral("name")) == QLatin1String("label")
+				&& !info.text().isEmpty()) {
+				return info.text();
+			}
+		}
+		return QFileInfo(element.attribute(QStringLiteral("type"))).completeBaseName();
+	}
+
+	QString conductorKey(const QDomElement &conductor)
+	{
+		QStringList ends {
+			conductor.attribute(QStringLiteral("element1")) + QLatin1Char('|')
+					+ conductor.attribute(QStringLiteral("terminal1")),
+			conductor.attribute(QStringLiteral("element2")) + QLatin1Char('|')
+					+ conductor.attribute(QStringLiteral("terminal2"))
+		};
+		ends.sort();
+		return ends.join(QLatin1Char('-'));
+	}
+
+	QString conductorDescription(const QDomElement &conductor)
+	{
+		auto end = [&conductor](const QString &i) {
+			QString label = conductor.attribute(QStringLiteral("element") + i + QStringLiteral("_label"));
+			if (label.isEmpty()) {
+				label = conductor.attribute(QStringLiteral("element") + i + QStringLiteral("_name"));
+			}
+			return label + QLatin1Char(':') + conductor.attribute(QStringLiteral("terminalname") + i);
+		};
+		return end(QStringLiteral("1")) + QStringLiteral(" - ") + end(QStringLiteral("2"));
+	}
+
+		/**
+			Insert @a item in @a folio with the key @a key,
+			if the key is already used (two identical texts for example)
+			a rank is appended to the key.
+		*/
+	void insertItem(CanonicalFolio &folio, const QString &key, const CanonicalItem &item)
+	{
+		QString unique_key = key + QStringLiteral("#0");
+		for (int rank = 1 ; folio.items.contains(unique_key) ; ++rank) {
+			unique_key = key + QLatin1Char('#') + QString::number(rank);
+		}
+		folio.items.insert(unique_key, item);
+	}
+
+	CanonicalFolio canonicalFolio(const QDomElement &diagram, int index)
+	{
+		CanonicalFolio folio;
+		folio.index = index;
+		folio.title = diagram.attribute(QStringLiteral("title"));
+
+		const auto &kinds = sectionKinds();
+		QCryptographicHash properties(QCryptographicHash::Sha1);
+		QVector<QByteArray> properties_children;
+
+		for (auto section = diagram.firstChildElement() ;
+			 !section.isNull() ;
+			 section = section.nextSiblingElement())
+		{
+			const auto kind_it = kinds.constFind(section.tagName());
+			if (kind_it == kinds.constEnd()) {
+				properties_children << canonicalHash(section);
+				continue;
+			}
+
+			for (auto dom_item = section.firstChildElement() ;
+				 !dom_item.isNull() ;
+				 dom_item = dom_item.nextSiblingElement())
+			{
+				CanonicalItem item;
+				item.kind = kind_it.value();
+				item.hash = canonicalHash(dom_item);
+				item.order = folio.items.size();
+
+				if (item.kind == ProjectDiff::ElementKind)
+				{
+					item.description = elementDescription(dom_item);
+					insertItem(folio, dom_item.attribute(QStringLiteral("uuid")), item);
+				}
+				else if (item.kind == ProjectDiff::ConductorKind)
+				{
+					item.description = conductorDescription(dom_item);
+					insertItem(folio, conductorKey(dom_item), item);
+				}
+				else if (item.kind == ProjectDiff::TableKind)
+				{
+					insertItem(folio, dom_item.attribute(QStringLiteral("uuid")), item);
+				}
+				else if (item.kind == ProjectDiff::TerminalStripKind)
+				{
+					insertItem(folio,
+							   dom_item.firstChildElement(QStringLiteral("terminal_strip"))
+							   .attribute(QStringLiteral("uuid")),
+							   item);
+				}
+				else
+				{
+					if (item.kind == ProjectDiff::TextKind) {
+						QTextDocument doc;
+						doc.setHtml(dom_item.attribute(QStringLiteral("text")));
+						item.description = doc.toPlainText().simplified().left(60);
+					} else if (item.kind == ProjectDiff::ShapeKind) {
+						item.description = dom_item.attribute(QStringLiteral("type"));
+					}
+					insertItem(folio, QString::fromLatin1(item.hash.toHex()), item);
+				}
+			}
+		}
+
+			//The properties of the folio : attributes of the root
+			//and every child which isn't a section of items.
+			//The attribute "order" is ignored, a moved folio
+			//is not a modified folio.
+		const auto attributes = diagram.attributes();
+		QStringList attributes_list;
+		for (int i = 0 ; i < attributes.count() ; ++i)
+		{
+			const auto attribute = attributes.item(i).toAttr();
+			if (attribute.name() != QLatin1String("order")) {
+				attributes_list << attribute.name() + QLatin1Char('=') + attribute.value();
+			}
+		}
+		attributes_list.sort();
+		for (const auto &str : qAsConst(attributes_list)) {
+			properties.addData(str.toUtf8());
+			properties.addData("\0", 1);
+		}
+		std::sort(properties_children.begin(), properties_children.end());
+		for (const auto &child : qAsConst(properties_children)) {
+			properties.addData(child);
+		}
+		folio.properties_hash = properties.result();
+
+		return folio;
+	}
+
+	QVector<CanonicalFolio> canonicalProject(const QDomDocument &project)
+	{
+		QVector<CanonicalFolio> folios;
+		const auto diagrams = QETXML::directChild(project.documentElement(),
+												  QStringLiteral("diagram"));
+		folios.reserve(diagrams.size());
+		for (int i = 0 ; i < diagrams.size() ; ++i) {
+			folios << canonicalFolio(diagrams.at(i), i);
+		}
+		return folios;
+	}
+
+		/**
+			Key used to match the folios of the two revisions :
+			the title and the rank of the folio among the folios
+			with the same title.
+		*/
+	QHash<QString, int> folioKeys(const QVector<CanonicalFolio> &folios)
+	{
+		QHash<QString, int> keys;
+		QHash<QString, int> ranks;
+		for (int i = 0 ; i < folios.size() ; ++i)
+		{
+			const auto &title = folios.at(i).title;
+			const int rank = ranks.value(title, 0);
+			ranks.insert(title, rank + 1);
+			keys.insert(title + QLatin1Char('#') + QString::number(rank), i);
+		}
+		return keys;
+	}
+
+	ProjectDiff::Change makeChange(ProjectDiff::ChangeType type,
+								   ProjectDiff::ItemKind kind,
+								   const CanonicalFolio *old_folio,
+								   const CanonicalFolio *new_folio,
+								   const QString &key = QString(),
+								   const QString &description = QString())
+	{
+		ProjectDiff::Change change;
+		change.type = type;
+		change.kind = kind;
+		change.old_folio = old_folio ? old_folio->index : -1;
+		change.new_folio = new_folio ? new_folio->index : -1;
+		change.folio_title = new_folio ? new_folio->title : old_folio->title;
+		change.key = key;
+		change.description = description;
+		return change;
+	}
+
+	void compareFolio(const CanonicalFolio &old_folio,
+					  const CanonicalFolio &new_folio,
+					  QVector<ProjectDiff::Change> &changes)
+	{
+		if (old_folio.properties_hash != new_folio.properties_hash) {
+			changes << makeChange(ProjectDiff::Modified, ProjectDiff::FolioPropertiesKind,
+								  &old_folio, &new_folio);
+		}
+
+			//The texts, images and shapes have no uuid, they are keyed
+			//by their hash. The unmatched items of the same kind are
+			//paired in their order in the folio, an edited item is
+			//reported as modified instead of removed and added.
+		QHash<int, QVector<QHash<QString, CanonicalItem>::const_iterator>> added, removed;
+
+		for (auto it = new_folio.items.constBegin() ; it != new_folio.items.constEnd() ; ++it)
+		{
+			const auto old_it = old_folio.items.constFind(it.key());
+			if (old_it == old_folio.items.constEnd()) {
+				added[it->kind] << it;
+			} else if (old_it->hash != it->hash) {
+				changes << makeChange(ProjectDiff::Modified, it->kind,
+									  &old_folio, &new_folio, it.key(), it->description);
+			}
+		}
+
+		for (auto it = old_folio.items.constBegin() ; it != old_folio.items.constEnd() ; ++it)
+		{
+			if (!new_folio.items.contains(it.key())) {
+				removed[it->kind] << it;
+			}
+		}
+
+		auto by_order = [](const QHash<QString, CanonicalItem>::const_iterator &a,
+						   const QHash<QString, CanonicalItem>::const_iterator &b) {
+			return a->order < b->order;
+		};
+		for (auto kind_it = added.begin() ; kind_it != added.end() ; ++kind_it)
+		{
+			auto &added_items = kind_it.value();
+			auto &removed_items = removed[kind_it.key()];
+			int paired = 0;
+			if (kind_it.key() == ProjectDiff::TextKind ||
+				kind_it.key() == ProjectDiff::ImageKind ||
+				kind_it.key() == ProjectDiff::ShapeKind)
+			{
+				std::sort(added_items.begin(), added_items.end(), by_order);
+				std::sort(removed_items.begin(), removed_items.end(), by_order);
+				paired = qMin(added_items.size(), removed_items.size());
+			}
+
+			for (int i = 0 ; i < added_items.size() ; ++i) {
+				const auto &it = added_items.at(i);
+				changes << makeChange(i < paired ? ProjectDiff::Modified : ProjectDiff::Added,
+									  it->kind, &old_folio, &new_folio, it.key(), it->description);
+			}
+			removed_items.erase(removed_items.begin(), removed_items.begin() + paired);
+		}
+
+		for (const auto &removed_items : qAsConst(removed)) {
+			for (const auto &it : removed_items) {
+				changes << makeChange(ProjectDiff::Removed, it->kind,
+									  &old_folio, &new_folio, it.key(), it->description);
+			}
+		}
+	}
+
+		/**
+			Return the canonical key of the item @a item (without the rank),
+			used to retrieve an item of a folio from a change.
+		*/
+	int graphicsItemType(ProjectDiff::ItemKind kind)
+	{
+		switch (kind) {
+			case ProjectDiff::ElementKind:       return Element::Type;
+			case ProjectDiff::ConductorKind:     return Conductor::Type;
+			case ProjectDiff::TextKind:          return IndependentTextItem::Type;
+			case ProjectDiff::ImageKind:         return DiagramImageItem::Type;
+			case ProjectDiff::ShapeKind:         return QetShapeItem::Type;
+			case ProjectDiff::TableKind:         return QetGraphicsTableItem::Type;
+			case ProjectDiff::TerminalStripKind: return TerminalStripItem::Type;
+			default:                             return -1;
+		}
+	}
+
+	QString liveKey(QGraphicsItem *item, QDomDocument &document)
+	{
+		switch (item->type())
+		{
+			case Element::Type:
+				return static_cast<Element *>(item)->uuid().toString();
+			case Conductor::Type: {
+				auto conductor = static_cast<Conductor *>(item);
+				QStringList ends {
+					conductor->terminal1->parentElement()->uuid().toString() + QLatin1Char('|')
+							+ conductor->terminal1->uuid().toString(),
+					conductor->terminal2->parentElement()->uuid().toString() + QLatin1Char('|')
+							+ conductor->terminal2->uuid().toString()
+				};
+				ends.sort();
+				return ends.join(QLatin1Char('-'));
+			}
+			case IndependentTextItem::Type:
+				return QString::fromLatin1(canonicalHash(static_cast<IndependentTextItem *>(item)->toXml(document)).toHex());
+			case DiagramImageItem::Type:
+				return QString::fromLatin1(canonicalHash(static_cast<DiagramImageItem *>(item)->toXml(document)).toHex());
+			case QetShapeItem::Type:
+				return QString::fromLatin1(canonicalHash(static_cast<QetShapeItem *>(item)->toXml(document)).toHex());
+			case QetGraphicsTableItem::Type:
+				return static_cast<QetGraphicsTableItem *>(item)->uuid().toString();
+			case TerminalStripItem::Type: {
+				const auto strip = static_cast<TerminalStripItem *>(item)->terminalStrip();
+				return strip ? strip->uuid().toString() : QString();
+			}
+			default:
+				return QString();
+		}
+	}
+}
+
+/**
+	@brief ProjectDiff::compare
+	Compare two revisions of a project
+	@param old_project : xml of the old revision
+	@param new_project : xml of the new revision
+	@return the changes from @a old_project to @a new_project,
+	sorted by folio of the new revision.
+*/
+QVector<ProjectDiff::Change> ProjectDiff::compare(const QDomDocument &old_project,
+												  const QDomDocument &new_project)
+{
+	QVector<Change> changes;
+
+	const auto old_folios = canonicalProject(old_project);
+	const auto new_folios = canonicalProject(new_project);
+	const auto old_keys = folioKeys(old_folios);
+	const auto new_keys = folioKeys(new_folios);
+
+	QVector<int> new_to_old(new_folios.size(), -1);
+	QVector<bool> old_matched(old_folios.size(), false);
+	for (auto it = new_keys.constBegin() ; it != new_keys.constEnd() ; ++it)
+	{
+		const int old_index = old_keys.value(it.key(), -1);
+		new_to_old[it.value()] = old_index;
+		if (old_index >= 0) {
+			old_matched[old_index] = true;
+		}
+	}
+
+		//The folios don't have a saved uuid, a folio which isn't matched
+		//by its title (renamed folio) is matched by its position
+	for (int i = 0 ; i < new_folios.size() && i < old_folios.size() ; ++i)
+	{
+		if (new_to_old.at(i) < 0 && !old_matched.at(i))
+		{
+			new_to_old[i] = i;
+			old_matched[i] = true;
+		}
+	}
+
+	for (int i = 0 ; i < new_folios.size() ; ++i)
+	{
+		const int old_index = new_to_old.at(i);
+		if (old_index < 0) {
+			changes << makeChange(Added, FolioKind, nullptr, &new_folios.at(i));
+			continue;
+		}
+
+		compareFolio(old_folios.at(old_index), new_folios.at(i), changes);
+	}
+
+	for (int i = 0 ; i < old_folios.size() ; ++i)
+	{
+		if (!old_matched.at(i)) {
+			changes << makeChange(Removed, FolioKind, &old_folios.at(i), nullptr);
+		}
+	}
+
+	return changes;
+}
+
+/**
+	@brief ProjectDiff::changeTypeName
+	@param type
+	@return the human name of @a type
+*/
+QString ProjectDiff::changeTypeName(ProjectDiff::ChangeType type)
+{
+	switch (type) {
+		case Added:
+			return QObject::tr("Ajouté");
+		case Removed:
+			return QObject::tr("Supprimé");
+		case Modified:
+			return QObject::tr("Modifié");
+	}
+	return QString();
+}
+
+/**
+	@brief ProjectDiff::itemKindName
+	@param kind
+	@return the human name of @a kind
+*/
+QString ProjectDiff::itemKindName(ProjectDiff::ItemKind kind)
+{
+	switch (kind) {
+		case FolioKind:
+			return QObject::tr("Folio");
+		case FolioPropertiesKind:
+			return QObject::tr("Propriétés du folio");
+		case ElementKind:
+			return QObject::tr("Élément");
+		case ConductorKind:
+			return QObject::tr("Conducteur");
+		case TextKind:
+			return QObject::tr("Texte");
+		case ImageKind:
+			return QObject::tr("Image");
+		case ShapeKind:
+			return QObject::tr("Forme");
+		case TableKind:
+			return QObject::tr("Tableau");
+		case TerminalStripKind:
+			return QObject::tr("Plan de bornes");
+	}
+	return QString();
+}
+
+/**
+	@brief ProjectDiff::findItem
+	Find in @a diagram the item related to @a change.
+	@a diagram must be the folio of the new revision of the change.
+	@param diagram
+	@param change
+	@return the item or nullptr if the change is not related to an item
+	of @a diagram (removed item, folio...)
+*/
+QGraphicsObject *ProjectDiff::findItem(Diagram *diagram, const ProjectDiff::Change &change)
+{
+	if (!diagram
+		|| change.type == Removed
+		|| change.kind == FolioKind
+		|| change.kind == FolioPropertiesKind) {
+		return nullptr;
+	}
+
+	const int separator = change.key.lastIndexOf(QLatin1Char('#'));
+	const QString key = change.key.left(separator);
+	int rank = change.key.mid(separator + 1).toInt();
+
+	const int type = graphicsItemType(change.kind);
+	QDomDocument document;
+	for (const auto &item : diagram->items())
+	{
+		if (item->type() == type
+			&& liveKey(item, document) == key
+			&& rank-- == 0) {
+			return item->toGraphicsObject();
+		}
+	}
+	return nullptr;
+}
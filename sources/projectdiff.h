@@ -0,0 +1,101 @@
+/*
+	Copyright 2006-2026 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech. If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef PROJECTDIFF_H
+#define PROJECTDIFF_H
+
+#include <QDomDocument>
+#include <QString>
+#include <QVector>
+
+class Diagram;
+class QGraphicsObject;
+
+/**
+	@brief The ProjectDiff class
+	Structural comparison of two revisions of a project.
+	The comparison is done on the xml of the projects and not on the text
+	of the files, because the order of the items and the formatting
+	of the xml change at every save.
+
+	Each folio is canonicalised : every item is reduced to a hash computed
+	from its tag, its attributes sorted by name and the hashes of its
+	children in their order, so the order of the attributes doesn't matter
+	but the order of the segments of a conductor does.
+	The attributes elided by the compact serialisation are ignored when
+	equal to their default value, a compact and a verbose save of the
+	same project are equal.
+	The items are then matched between the two revisions by a key :
+	@li element and table : the uuid of the item
+	@li conductor : the uuids of the two terminals
+	@li terminal strip : the uuid of the terminal strip
+	@li text, image and shape : the hash of the item, they have no uuid.
+	The unmatched items of one of these kinds are paired in their order
+	in the folio, an edited text is reported as modified.
+
+	The folios are matched by title (and by rank when several folios
+	have the same title), the remaining folios by their position.
+	Everything is stored in hash tables, the comparison is linear
+	in the number of items of the projects.
+*/
+class ProjectDiff
+{
+	public:
+		enum ChangeType {
+			Added,
+			Removed,
+			Modified
+		};
+
+		enum ItemKind {
+			FolioKind,
+			FolioPropertiesKind,
+			ElementKind,
+			ConductorKind,
+			TextKind,
+			ImageKind,
+			ShapeKind,
+			TableKind,
+			TerminalStripKind
+		};
+
+		/**
+			@brief The Change struct
+			A difference between the two revisions.
+			old_folio and new_folio are the index of the folio
+			in each revision, -1 if the folio doesn't exist in the revision.
+		*/
+		struct Change
+		{
+			ChangeType type = Modified;
+			ItemKind kind = ElementKind;
+			int old_folio = -1;
+			int new_folio = -1;
+			QString folio_title;
+			QString key;
+			QString description;
+		};
+
+		static QVector<Change> compare(const QDomDocument &old_project,
+									   const QDomDocument &new_project);
+
+		static QString changeTypeName(ChangeType type);
+		static QString itemKindName(ItemKind kind);
+		static QGraphicsObject *findItem(Diagram *diagram, const Change &change);
+};
+
+#endif // PROJECTDIFF_H
@@ -0,0 +1,134 @@
+/*
+	Copyright 2006-2026 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech. If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "projectfilereader.h"
+
+#include <QFile>
+#include <QtConcurrentRun>
+
+/**
+	@brief ProjectFileReader::ProjectFileReader
+	@param parent
+*/
+ProjectFileReader::ProjectFileReader(QObject *parent) :
+	QObject(parent)
+{}
+
+/**
+	@brief ProjectFileReader::~ProjectFileReader
+	Wait for the files still being read, the results are dropped.
+*/
+ProjectFileReader::~ProjectFileReader()
+{
+	for (const auto &watcher : qAsConst(m_watchers)) {
+		watcher->disconnect(this);
+		watcher->waitForFinished();
+	}
+}
+
+/**
+	@brief ProjectFileReader::read
+	Start to read @a files, each file is read by a worker thread
+	of the global thread pool.
+	The signal fileRead is emitted for each file, then the signal finished
+	is emitted when every file is read.
+	@param files : path of the project files to read
+*/
+void ProjectFileReader::read(const QStringList &files)
+{
+	for (const auto &file : files)
+	{
+		auto watcher = new QFutureWatcher<Result>(this);
+		connect(watcher, &QFutureWatcher<Result>::finished,
+				this, [this, watcher]() { watcherFinished(watcher); });
+		m_watchers.append(watcher);
+		watcher->setFuture(QtConcurrent::run(&ProjectFileReader::readFile, file));
+	}
+
+	if (files.isEmpty()) {
+		emit finished();
+	}
+}
+
+/**
+	@brief ProjectFileReader::count
+	@return the number of files to read
+*/
+int ProjectFileReader::count() const {
+	return m_watchers.size();
+}
+
+/**
+	@brief ProjectFileReader::readCount
+	@return the number of files already read
+*/
+int ProjectFileReader::readCount() const {
+	return m_read_count;
+}
+
+/**
+	@brief ProjectFileReader::readFile
+	Read the project file @a file_path and parse its xml.
+	This function is thread safe, it is called by the worker threads.
+	@param file_path
+	@return the parsed document
+*/
+ProjectFileReader::Result ProjectFileReader::readFile(const QString &file_path)
+{
+	Result result;
+	result.file_path = file_path;
+
+	QFile file(file_path);
+	if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+		result.state = QETProject::FileOpenFailed;
+		return result;
+	}
+
+	if (!result.document.setContent(&file)) {
+		result.document = QDomDocument();
+		result.state = QETProject::XmlParsingFailed;
+	}
+	return result;
+}
+
+/**
+	@brief ProjectFileReader::watcherFinished
+	Emit the result of the file read by @a watcher.
+	The receiver of fileRead can run an event loop (a message box when
+	the project is built), the results of the files finished meanwhile
+	are queued and emitted one after the other, never recursively.
+	@param watcher
+*/
+void ProjectFileReader::watcherFinished(QFutureWatcher<ProjectFileReader::Result> *watcher)
+{
+	m_pending.append(watcher->result());
+	if (m_emitting) {
+		return;
+	}
+
+	m_emitting = true;
+	while (!m_pending.isEmpty())
+	{
+		++m_read_count;
+		emit fileRead(m_pending.takeFirst());
+	}
+	m_emitting = false;
+
+	if (m_read_count == m_watchers.size()) {
+		emit finished();
+	}
+}
@@ -0,0 +1,79 @@
+/*
+	Copyright 2006-2026 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech. If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef PROJECTFILEREADER_H
+#define PROJECTFILEREADER_H
+
+#include "qetproject.h"
+
+#include <QDomDocument>
+#include <QFutureWatcher>
+#include <QObject>
+#include <QStringList>
+
+/**
+	@brief The ProjectFileReader class
+	Read and parse several project files in parallel.
+	Each file is read and its xml parsed by a worker thread,
+	the signal fileRead is emitted in the thread of the reader
+	as soon as a file is parsed, in the order of completion and not
+	in the order of the list, so the project can be built while the
+	others files are still parsed.
+	Building the project itself (QETProject) must stay in the gui thread.
+*/
+class ProjectFileReader : public QObject
+{
+	Q_OBJECT
+
+	public:
+		/**
+			@brief The Result struct
+			The content of a project file parsed by a worker thread.
+			state is QETProject::Ok, QETProject::FileOpenFailed or
+			QETProject::XmlParsingFailed
+		*/
+		struct Result
+		{
+			QString file_path;
+			QDomDocument document;
+			QETProject::ProjectState state = QETProject::Ok;
+		};
+
+		ProjectFileReader(QObject *parent = nullptr);
+		~ProjectFileReader() override;
+
+		void read(const QStringList &files);
+		int count() const;
+		int readCount() const;
+
+		static Result readFile(const QString &file_path);
+
+	signals:
+		void fileRead(const ProjectFileReader::Result &result);
+		void finished();
+
+	private:
+		void watcherFinished(QFutureWatcher<Result> *watcher);
+
+	private:
+		QList<QFutureWatcher<Result> *> m_watchers;
+		QList<Result> m_pending;
+		int m_read_count = 0;
+		bool m_emitting = false;
+};
+
+#endif // PROJECTFILEREADER_H
@@ -0,0 +1,727 @@
+/*
+	Copyright 2006-2026 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech. If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "projectgenerator.h"
+
+#include "ElementsCollection/xmlelementcollection.h"
+#include "NameList/nameslist.h"
+#include "TerminalStrip/terminalstrip.h"
+#include "dataBase/projectdatabase.h"
+#include "dataBase/ui/elementquerywidget.h"
+#include "diagram.h"
+#include "factory/elementfactory.h"
+#include "properties/elementdata.h"
+#include "qetgraphicsitem/ViewItem/projectdbmodel.h"
+#include "qetgraphicsitem/ViewItem/qetgraphicstableitem.h"
+#include "qetgraphicsitem/conductor.h"
+#include "qetgraphicsitem/diagramimageitem.h"
+#include "qetgraphicsitem/element.h"
+#include "qetgraphicsitem/terminal.h"
+#include "qetproject.h"
+#include "qetversion.h"
+
+#include <QDomDocument>
+#include <QImage>
+#include <QPainter>
+#include <QPixmap>
+#include <QtMath>
+#include <QUuid>
+
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+		/**
+			The number of elements on a row of the grid of a folio
+		*/
+	const int GRID_COLUMNS = 16;
+
+		/**
+			The size of a cell of the grid of a folio
+		*/
+	const qreal GRID_CELL_WIDTH = 60;
+	const qreal GRID_CELL_HEIGHT = 120;
+
+		/**
+			Shuffle @a vector with @a random (Fisher-Yates).
+			Unlike std::shuffle, which algorithm is left to the implementation,
+			the result only depend of the seed of @a random.
+		*/
+	template <typename T>
+	void shuffle(QVector<T> &vector, QRandomGenerator &random)
+	{
+		for (int i = vector.size() - 1 ; i > 0 ; --i) {
+			std::swap(vector[i], vector[int(random.bounded(i + 1))]);
+		}
+	}
+
+		/**
+			The keys of ProjectGenerator::Parameters::fromString
+		*/
+	const QStringList PARAMETER_KEYS {
+		QStringLiteral("seed"),
+		QStringLiteral("folios"),
+		QStringLiteral("elements"),
+		QStringLiteral("fan_out"),
+		QStringLiteral("potential"),
+		QStringLiteral("masters"),
+		QStringLiteral("slaves"),
+		QStringLiteral("reports"),
+		QStringLiteral("strips"),
+		QStringLiteral("strip_terminals"),
+		QStringLiteral("tables"),
+		QStringLiteral("images")
+	};
+}
+
+/**
+	@brief ProjectGenerator::Parameters::fromString
+	Build parameters from a string in the form "key=value,key=value",
+	the keys not given keep their default value.
+	Keys : seed, folios, elements, fan_out, potential, masters, slaves,
+	reports, strips, strip_terminals, tables, images.
+	@param str
+	@param error : if not null, set to a description of the error,
+	or to an empty string if @a str is valid.
+	@return the parameters
+*/
+ProjectGenerator::Parameters ProjectGenerator::Parameters::fromString(const QString &str,
+								QString *error)
+{
+	Parameters parameters;
+	if (error) {
+		error->clear();
+	}
+
+	const auto pairs = str.split(QLatin1Char(','));
+	for (const auto &pair : pairs)
+	{
+		if (pair.trimmed().isEmpty()) {
+			continue;
+		}
+
+		const auto key = pair.section(QLatin1Char('='), 0, 0).trimmed();
+		bool ok = false;
+		const auto value = pair.section(QLatin1Char('='), 1).trimmed().toUInt(&ok);
+
+		if (!ok || !PARAMETER_KEYS.contains(key))
+		{
+			if (error) {
+				*error = QObject::tr("Paramètre du générateur invalide : %1").arg(pair);
+			}
+			return Parameters();
+		}
+
+		const int int_value = int(qMin(value, quint32(std::numeric_limits<int>::max())));
+		if      (key == QLatin1String("seed"))            parameters.seed = value;
+		else if (key == QLatin1String("folios"))          parameters.folios = int_value;
+		else if (key == QLatin1String("elements"))        parameters.elements = int_value;
+		else if (key == QLatin1String("fan_out"))         parameters.fan_out = int_value;
+		else if (key == QLatin1String("potential"))       parameters.potential = int_value;
+		else if (key == QLatin1String("masters"))         parameters.masters = int_value;
+		else if (key == QLatin1String("slaves"))          parameters.slaves = int_value;
+		else if (key == QLatin1String("reports"))         parameters.reports = int_value;
+		else if (key == QLatin1String("strips"))          parameters.strips = int_value;
+		else if (key == QLatin1String("strip_terminals")) parameters.strip_terminals = int_value;
+		else if (key == QLatin1String("tables"))          parameters.tables = int_value;
+		else if (key == QLatin1String("images"))          parameters.images = int_value;
+	}
+
+	return parameters;
+}
+
+/**
+	@brief ProjectGenerator::Parameters::toString
+	@return the parameters in the form read by fromString
+*/
+QString ProjectGenerator::Parameters::toString() const
+{
+	return QStringLiteral("seed=%1,folios=%2,elements=%3,fan_out=%4,potential=%5,"
+						  "masters=%6,slaves=%7,reports=%8,strips=%9,"
+						  "strip_terminals=%10,tables=%11,images=%12")
+			.arg(seed).arg(folios).arg(elements).arg(fan_out).arg(potential)
+			.arg(masters).arg(slaves).arg(reports).arg(strips)
+			.arg(strip_terminals).arg(tables).arg(images);
+}
+
+/**
+	@brief ProjectGenerator::ProjectGenerator
+	@param parameters : the size and the shape of the generated projects
+*/
+ProjectGenerator::ProjectGenerator(const Parameters &parameters) :
+	m_parameters(parameters)
+{}
+
+/**
+	@brief ProjectGenerator::generate
+	Fill @a project with the folios described by the parameters
+	of this generator. The folios are added after the existing folios
+	of @a project, a new project should be used to get a reproducible result.
+	@param project
+	@return true on success, else false and errorString() describe the error
+*/
+bool ProjectGenerator::generate(QETProject *project)
+{
+	m_error.clear();
+	m_random.seed(m_parameters.seed);
+	m_locations.clear();
+	m_next_position.clear();
+	m_folios_count = m_elements_count = m_conductors_count = 0;
+
+	if (!project || project->isReadOnly())
+	{
+		m_error = QObject::tr("Le projet n'est pas modifiable");
+		return false;
+	}
+	if (!addDefinitions(project)) {
+		return false;
+	}
+
+	const int folios = qMax(1, m_parameters.folios);
+	QVector<Diagram *> diagrams;
+	QVector<QVector<Element *>> folio_elements(folios);
+	QVector<QVector<Element *>> next_reports(folios);
+	QVector<QVector<Element *>> previous_reports(folios);
+	QVector<Element *> masters;
+	QVector<Element *> slaves;
+	int number = 0;
+
+		//Folios and elements
+	for (int f = 0 ; f < folios ; ++f)
+	{
+		Diagram *diagram = project->addNewDiagram();
+		if (!diagram)
+		{
+			m_error = QObject::tr("Impossible d'ajouter un folio au projet");
+			return false;
+		}
+		auto titleblock = diagram->border_and_titleblock.exportTitleBlock();
+		titleblock.title = QObject::tr("Folio généré %1").arg(f + 1);
+		diagram->border_and_titleblock.importTitleBlock(titleblock);
+		diagrams << diagram;
+		++m_folios_count;
+
+		auto &elements = folio_elements[f];
+		for (int i = 0 ; i < m_parameters.masters ; ++i)
+		{
+			auto master = addElement(diagram, Master, ++number);
+			elements << master;
+			masters << master;
+		}
+		for (int i = 0 ; i < m_parameters.masters * m_parameters.slaves ; ++i)
+		{
+			auto slave = addElement(diagram, Slave, ++number);
+			elements << slave;
+			slaves << slave;
+		}
+		for (int i = 0 ; i < m_parameters.reports ; ++i)
+		{
+			if (f < folios - 1) {
+				next_reports[f] << addElement(diagram, NextReport, ++number);
+				elements << next_reports[f].last();
+			}
+			if (f > 0) {
+				previous_reports[f] << addElement(diagram, PreviousReport, ++number);
+				elements << previous_reports[f].last();
+			}
+		}
+		while (elements.size() < m_parameters.elements) {
+			elements << addElement(diagram, Simple, ++number);
+		}
+		elements.removeAll(nullptr);
+	}
+
+		//Terminal strips, their terminals are spread over the folios
+	for (int s = 0 ; s < m_parameters.strips ; ++s)
+	{
+		auto strip = project->newTerminalStrip(QStringLiteral("=A1"),
+											   QStringLiteral("+L%1").arg(s % 4 + 1),
+											   QStringLiteral("X%1").arg(s + 1));
+		for (int t = 0 ; t < m_parameters.strip_terminals ; ++t)
+		{
+			const int f = (s * m_parameters.strip_terminals + t) % folios;
+			if (auto terminal = addElement(diagrams.at(f), TerminalKind, t + 1))
+			{
+				strip->addTerminal(terminal);
+				folio_elements[f] << terminal;
+			}
+		}
+	}
+
+		//Links : each master get the same number of slaves,
+		//the slaves are spread over the folios
+		//and placed on another folio than their master when possible
+	QVector<Element *> master_slots;
+	master_slots.reserve(slaves.size());
+	for (const auto &master : qAsConst(masters)) {
+		if (master) {
+			for (int i = 0 ; i < m_parameters.slaves ; ++i) {
+				master_slots << master;
+			}
+		}
+	}
+	shuffle(master_slots, m_random);
+	const int links = qMin(slaves.size(), master_slots.size());
+	auto valid = [&](int slave, int master) {
+		return !slaves.at(slave)
+				|| slaves.at(slave)->diagram() != master_slots.at(master)->diagram();
+	};
+	for (int i = 0 ; i < links ; ++i)
+	{
+		if (valid(i, i)) {
+			continue;
+		}
+		for (int j = 0 ; j < links ; ++j)
+		{
+			if (j != i && valid(i, j) && valid(j, i))
+			{
+				std::swap(master_slots[i], master_slots[j]);
+				break;
+			}
+		}
+	}
+	for (int i = 0 ; i < links ; ++i) {
+		if (slaves.at(i)) {
+			slaves.at(i)->linkToElement(master_slots.at(i));
+		}
+	}
+
+	for (int f = 0 ; f < folios - 1 ; ++f)
+	{
+		const auto &next = next_reports.at(f);
+		const auto &previous = previous_reports.at(f + 1);
+		for (int i = 0 ; i < next.size() && i < previous.size() ; ++i) {
+			if (next.at(i) && previous.at(i)) {
+				next.at(i)->linkToElement(previous.at(i));
+			}
+		}
+	}
+
+		//Conductors and images
+	for (int f = 0 ; f < folios ; ++f)
+	{
+		fitFolio(diagrams.at(f));
+		addPotentials(diagrams.at(f), folio_elements.at(f));
+		addImages(diagrams.at(f));
+	}
+
+		//Tables, each on its own folio
+	if (m_parameters.tables > 0) {
+		project->dataBase()->updateDB();
+	}
+	for (int t = 0 ; t < m_parameters.tables ; ++t)
+	{
+		if (auto diagram = project->addNewDiagram())
+		{
+			++m_folios_count;
+			addTable(diagram);
+		}
+	}
+
+	return true;
+}
+
+/**
+	@brief ProjectGenerator::errorString
+	@return the description of the last error
+*/
+QString ProjectGenerator::errorString() const
+{
+	return m_error;
+}
+
+/**
+	@brief ProjectGenerator::foliosCount
+	@return the number of folios added by the last call of generate()
+*/
+int ProjectGenerator::foliosCount() const
+{
+	return m_folios_count;
+}
+
+/**
+	@brief ProjectGenerator::elementsCount
+	@return the number of elements added by the last call of generate()
+*/
+int ProjectGenerator::elementsCount() const
+{
+	return m_elements_count;
+}
+
+/**
+	@brief ProjectGenerator::conductorsCount
+	@return the number of conductors added by the last call of generate()
+*/
+int ProjectGenerator::conductorsCount() const
+{
+	return m_conductors_count;
+}
+
+/**
+	@brief ProjectGenerator::addDefinitions
+	Add the definitions of the generated elements to the embedded
+	collection of @a project, in the directory import/generated
+	@param project
+	@return true on success
+*/
+bool ProjectGenerator::addDefinitions(QETProject *project)
+{
+	auto collection = project->embeddedElementCollection();
+	const QString dir_path = QStringLiteral("import/generated");
+
+	if (!collection->exist(dir_path))
+	{
+		NamesList names;
+		names.addName(QStringLiteral("fr"), QStringLiteral("Éléments générés"));
+		names.addName(QStringLiteral("en"), QStringLiteral("Generated elements"));
+		if (!collection->createDir(QStringLiteral("import"), QStringLiteral("generated"), names))
+		{
+			m_error = QObject::tr("Impossible de créer la catégorie des éléments générés");
+			return false;
+		}
+	}
+
+	const QHash<int, QString> files {
+		{Simple,         QStringLiteral("simple")},
+		{Master,         QStringLiteral("master")},
+		{Slave,          QStringLiteral("slave")},
+		{NextReport,     QStringLiteral("next_report")},
+		{PreviousReport, QStringLiteral("previous_report")},
+		{TerminalKind,   QStringLiteral("terminal")}
+	};
+
+	QDomDocument document;
+	for (auto it = files.constBegin() ; it != files.constEnd() ; ++it)
+	{
+		const QString path = dir_path + QLatin1Char('/') + it.value() + QStringLiteral(".elmt");
+		if (!collection->exist(path) &&
+			!collection->addElementDefinition(dir_path, it.value(),
+											  definition(document, Kind(it.key()))))
+		{
+			m_error = QObject::tr("Impossible d'ajouter l'élément %1 au projet").arg(path);
+			return false;
+		}
+		m_locations.insert(it.key(), ElementsLocation(QStringLiteral("embed://") + path, project));
+	}
+
+	return true;
+}
+
+/**
+	@brief ProjectGenerator::definition
+	@param document
+	@param kind
+	@return the xml definition of the element of kind @a kind
+*/
+QDomElement ProjectGenerator::definition(QDomDocument &document, ProjectGenerator::Kind kind) const
+{
+	QString link_type;
+	QString fr_name;
+	QString en_name;
+	switch (kind)
+	{
+		case Simple:
+			link_type = QStringLiteral("simple");
+			fr_name = QStringLiteral("Élément simple"); en_name = QStringLiteral("Simple element");
+			break;
+		case Master:
+			link_type = QStringLiteral("master");
+			fr_name = QStringLiteral("Bobine"); en_name = QStringLiteral("Coil");
+			break;
+		case Slave:
+			link_type = QStringLiteral("slave");
+			fr_name = QStringLiteral("Contact"); en_name = QStringLiteral("Contact");
+			break;
+		case NextReport:
+			link_type = QStringLiteral("next_report");
+			fr_name = QStringLiteral("Folio suivant"); en_name = QStringLiteral("Next folio");
+			break;
+		case PreviousReport:
+			link_type = QStringLiteral("previous_report");
+			fr_name = QStringLiteral("Folio précédent"); en_name = QStringLiteral("Previous folio");
+			break;
+		case TerminalKind:
+			link_type = QStringLiteral("terminal");
+			fr_name = QStringLiteral("Borne"); en_name = QStringLiteral("Terminal");
+			break;
+	}
+
+	const bool is_report = kind == NextReport || kind == PreviousReport;
+
+	QDomElement definition = document.createElement(QStringLiteral("definition"));
+	definition.setAttribute(QStringLiteral("type"), QStringLiteral("element"));
+	definition.setAttribute(QStringLiteral("link_type"), link_type);
+	definition.setAttribute(QStringLiteral("width"), 20);
+	definition.setAttribute(QStringLiteral("height"), is_report ? 20 : 40);
+	definition.setAttribute(QStringLiteral("hotspot_x"), 10);
+	definition.setAttribute(QStringLiteral("hotspot_y"), is_report ? 10 : 20);
+	QetVersion::toXmlAttribute(definition);
+
+	QDomElement uuid = document.createElement(QStringLiteral("uuid"));
+		//Fixed uuid, the definitions are the same for every generated project
+	uuid.setAttribute(QStringLiteral("uuid"),
+					  QUuid(0x9e4f2a10 + uint(kind), 0x5d1c, 0x4b7a, 0x8e, 0x31, 0x6a, 0x0c, 0xd2, 0x47, 0x95, 0xb8)
+					  .toString());
+	definition.appendChild(uuid);
+
+	NamesList names;
+	names.addName(QStringLiteral("fr"), fr_name);
+	names.addName(QStringLiteral("en"), en_name);
+	definition.appendChild(names.toXml(document));
+
+	if (kind == Master || kind == Slave)
+	{
+		QDomElement kind_informations = document.createElement(QStringLiteral("kindInformations"));
+		auto addKind = [&](const QString &name, const QString &value) {
+			QDomElement info = document.createElement(QStringLiteral("kindInformation"));
+			info.setAttribute(QStringLiteral("name"), name);
+			info.setAttribute(QStringLiteral("show"), 1);
+			info.appendChild(document.createTextNode(value));
+			kind_informations.appendChild(info);
+		};
+		if (kind == Master) {
+			addKind(QStringLiteral("type"), QStringLiteral("coil"));
+		} else {
+			addKind(QStringLiteral("type"), QStringLiteral("simple"));
+			addKind(QStringLiteral("state"), QStringLiteral("NO"));
+			addKind(QStringLiteral("number"), QStringLiteral("1"));
+		}
+		definition.appendChild(kind_informations);
+	}
+
+	QDomElement description = document.createElement(QStringLiteral("description"));
+	QDomElement rect = document.createElement(QStringLiteral("rect"));
+	rect.setAttribute(QStringLiteral("x"), -8);
+	rect.setAttribute(QStringLiteral("y"), is_report ? -8 : -16);
+	rect.setAttribute(QStringLiteral("width"), 16);
+	rect.setAttribute(QStringLiteral("height"), is_report ? 16 : 32);
+	rect.setAttribute(QStringLiteral("style"), QStringLiteral("line-style:normal;line-weight:normal;filling:none;color:black"));
+	rect.setAttribute(QStringLiteral("antialias"), QStringLiteral("false"));
+	description.appendChild(rect);
+
+	auto addTerminal = [&](int y, const QString &orientation) {
+		QDomElement terminal = document.createElement(QStringLiteral("terminal"));
+		terminal.setAttribute(QStringLiteral("x"), 0);
+		terminal.setAttribute(QStringLiteral("y"), y);
+		terminal.setAttribute(QStringLiteral("orientation"), orientation);
+		description.appendChild(terminal);
+	};
+	if (kind == NextReport) {
+		addTerminal(-10, QStringLiteral("n"));
+	} else if (kind == PreviousReport) {
+		addTerminal(10, QStringLiteral("s"));
+	} else {
+		addTerminal(-20, QStringLiteral("n"));
+		addTerminal(20, QStringLiteral("s"));
+	}
+
+	definition.appendChild(description);
+	return definition;
+}
+
+/**
+	@brief ProjectGenerator::addElement
+	Create an element of kind @a kind and add it to @a diagram,
+	at the next free place of the grid of @a diagram.
+	@param diagram
+	@param kind
+	@param number : number used in the label of the element
+	@return the new element, or nullptr if the element can't be created
+*/
+Element *ProjectGenerator::addElement(Diagram *diagram, ProjectGenerator::Kind kind, int number)
+{
+	int state = 0;
+	Element *element = ElementFactory::Instance()->createElement(m_locations.value(kind), nullptr, &state);
+	if (!element) {
+		return nullptr;
+	}
+	if (state)
+	{
+		delete element;
+		return nullptr;
+	}
+
+	diagram->addItem(element);
+	element->setPos(gridPosition(m_next_position[diagram]++));
+
+	QString label;
+	switch (kind)
+	{
+		case Simple:       label = QStringLiteral("E%1").arg(number); break;
+		case Master:       label = QStringLiteral("K%1").arg(number); break;
+		case TerminalKind: label = QStringLiteral("%1").arg(number); break;
+		default: break;
+	}
+	if (!label.isEmpty())
+	{
+		DiagramContext informations = element->elementInformations();
+		informations.addValue(QStringLiteral("label"), label);
+		informations.addValue(QStringLiteral("function"), QObject::tr("Fonction %1").arg(m_random.bounded(100)));
+		informations.addValue(QStringLiteral("manufacturer"), QStringLiteral("Manufacturer %1").arg(m_random.bounded(20)));
+		element->setElementInformations(informations);
+	}
+
+	++m_elements_count;
+	return element;
+}
+
+/**
+	@brief ProjectGenerator::gridPosition
+	@param index
+	@return the position of the @a index th element of a folio,
+	the elements which don't fit in the folio continue below it
+	until fitFolio enlarge the folio.
+*/
+QPointF ProjectGenerator::gridPosition(int index) const
+{
+	return QPointF(80 + (index % GRID_COLUMNS) * GRID_CELL_WIDTH,
+				   100 + (index / GRID_COLUMNS) * GRID_CELL_HEIGHT);
+}
+
+/**
+	@brief ProjectGenerator::fitFolio
+	Add rows and columns to the border of @a diagram
+	until it contain all the elements placed by addElement.
+	@param diagram
+*/
+void ProjectGenerator::fitFolio(Diagram *diagram)
+{
+	const int count = m_next_position.value(diagram);
+	if (!count) {
+		return;
+	}
+
+	auto &border = diagram->border_and_titleblock;
+	const QRectF inside = border.insideBorderRect();
+	const qreal bottom = gridPosition(count - 1).y() + GRID_CELL_HEIGHT;
+	const qreal right = gridPosition(qMin(count, GRID_COLUMNS) - 1).x() + GRID_CELL_WIDTH;
+
+	if (bottom > inside.bottom() && border.rowsHeight() > 0) {
+		border.setRowsCount(border.rowsCount()
+							+ qCeil((bottom - inside.bottom()) / border.rowsHeight()));
+	}
+	if (right > inside.right() && border.columnsWidth() > 0) {
+		border.setColumnsCount(border.columnsCount()
+							   + qCeil((right - inside.right()) / border.columnsWidth()));
+	}
+	diagram->adjustSceneRect();
+}
+
+/**
+	@brief ProjectGenerator::addPotentials
+	Connect the terminals of @a elements by potentials of
+	Parameters::potential terminals. The terminals are shuffled
+	so the conductors cross the folio. In a potential each terminal
+	is the origin of at most Parameters::fan_out conductors.
+	@param diagram
+	@param elements : the elements of @a diagram
+*/
+void ProjectGenerator::addPotentials(Diagram *diagram, const QVector<Element *> &elements)
+{
+	const int potential = qMax(2, m_parameters.potential);
+	const int fan_out = qMax(1, m_parameters.fan_out);
+
+	QVector<Terminal *> terminals;
+	for (const auto &element : elements) {
+		for (const auto &terminal : element->terminals()) {
+			terminals << terminal;
+		}
+	}
+	shuffle(terminals, m_random);
+
+	for (int first = 0 ; first + 1 < terminals.size() ; first += potential)
+	{
+		const int size = qMin(potential, terminals.size() - first);
+			//Tree : the terminal j is connected to the terminal (j-1)/fan_out
+		for (int j = 1 ; j < size ; ++j) {
+			addConductor(diagram,
+						 terminals.at(first + (j - 1) / fan_out),
+						 terminals.at(first + j));
+		}
+	}
+}
+
+/**
+	@brief ProjectGenerator::addConductor
+	Add a conductor between @a t1 and @a t2 to @a diagram
+	@param diagram
+	@param t1
+	@param t2
+	@return true if the conductor was added
+*/
+bool ProjectGenerator::addConductor(Diagram *diagram, Terminal *t1, Terminal *t2)
+{
+	if (!t1->canBeLinkedTo(t2)) {
+		return false;
+	}
+
+	auto conductor = new Conductor(t1, t2);
+	if (!conductor->isValid())
+	{
+		delete conductor;
+		return false;
+	}
+
+	diagram->addItem(conductor);
+	conductor->setProperties(diagram->defaultConductorProperties);
+	++m_conductors_count;
+	return true;
+}
+
+/**
+	@brief ProjectGenerator::addImages
+	Add Parameters::images images to the top of @a diagram
+	@param diagram
+*/
+void ProjectGenerator::addImages(Diagram *diagram)
+{
+	for (int i = 0 ; i < m_parameters.images ; ++i)
+	{
+		QImage image(64, 64, QImage::Format_RGB32);
+		image.fill(QColor::fromHsv(m_random.bounded(360), 128, 230));
+		QPainter painter(&image);
+		painter.drawEllipse(8, 8, 48, 48);
+		painter.end();
+
+		auto item = new DiagramImageItem(QPixmap::fromImage(image));
+		diagram->addItem(item);
+		item->setPos(80 + i * 80, 20);
+	}
+}
+
+/**
+	@brief ProjectGenerator::addTable
+	Add a nomenclature table of the simple elements to @a diagram
+	@param diagram
+*/
+void ProjectGenerator::addTable(Diagram *diagram)
+{
+	auto project = diagram->project();
+	auto model = new ProjectDBModel(project, project);
+	model->setIdentifier(ElementQueryWidget::modelIdentifier());
+	model->setQuery(QStringLiteral("SELECT label, function, manufacturer FROM element_nomenclature_view"
+								   " WHERE element_type = '%1' ORDER BY label")
+					.arg(ElementData::typeToString(ElementData::Simple)));
+
+	auto table = new QetGraphicsTableItem();
+	table->setTableName(QObject::tr("Nomenclature"));
+	table->setModel(model);
+	diagram->addItem(table);
+	table->setPos(50, 50);
+	QetGraphicsTableItem::adjustTableToFolio(table);
+}
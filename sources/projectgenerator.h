@@ -0,0 +1,128 @@
+/*
+	Copyright 2006-2026 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech. If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef PROJECTGENERATOR_H
+#define PROJECTGENERATOR_H
+
+#include "ElementsCollection/elementslocation.h"
+
+#include <QHash>
+#include <QRandomGenerator>
+#include <QString>
+#include <QVector>
+
+class Diagram;
+class Element;
+class QDomDocument;
+class QDomElement;
+class QETProject;
+class Terminal;
+
+/**
+	@brief The ProjectGenerator class
+	Fill a project with synthetic folios, used to measure the performances
+	of the load, the save, the rendering and the edition on large projects.
+
+	The generator only use the API used by the editor : the folios are added
+	with QETProject::addNewDiagram, the elements are created by ElementFactory
+	from definitions added to the embedded collection of the project,
+	the conductors, the links between elements and the terminal strips
+	are created like the user do it.
+
+	The generated project only depends of the parameters :
+	for a given seed, the folios, the elements, their positions,
+	the conductors and the links are always the same
+	(only the uuids of the items change).
+*/
+class ProjectGenerator
+{
+	public:
+		/**
+			@brief The Parameters struct
+			The size and the shape of the generated project.
+		*/
+		struct Parameters
+		{
+			quint32 seed = 1;
+				/// Number of folios
+			int folios = 10;
+				/// Number of elements on each folio, masters, slaves and reports included
+			int elements = 40;
+				/// Maximum number of conductors which start from a terminal
+			int fan_out = 2;
+				/// Number of terminals in each potential of a folio
+			int potential = 3;
+				/// Number of master elements on each folio
+			int masters = 2;
+				/// Number of slaves linked to each master, placed on other folios when the project has several
+			int slaves = 2;
+				/// Number of report pairs which go from each folio to the next one
+			int reports = 2;
+				/// Number of terminal strips of the project
+			int strips = 2;
+				/// Number of terminals of each terminal strip
+			int strip_terminals = 20;
+				/// Number of folios with a nomenclature table, added at the end of the project
+			int tables = 1;
+				/// Number of images on each folio
+			int images = 0;
+
+			static Parameters fromString(const QString &str, QString *error = nullptr);
+			QString toString() const;
+		};
+
+		ProjectGenerator(const Parameters &parameters = Parameters());
+
+		bool generate(QETProject *project);
+		QString errorString() const;
+
+		int foliosCount() const;
+		int elementsCount() const;
+		int conductorsCount() const;
+
+	private:
+		enum Kind {
+			Simple,
+			Master,
+			Slave,
+			NextReport,
+			PreviousReport,
+			TerminalKind
+		};
+
+		bool addDefinitions(QETProject *project);
+		QDomElement definition(QDomDocument &document, Kind kind) const;
+		Element *addElement(Diagram *diagram, Kind kind, int number);
+		QPointF gridPosition(int index) const;
+		void fitFolio(Diagram *diagram);
+		void addPotentials(Diagram *diagram, const QVector<Element *> &elements);
+		bool addConductor(Diagram *diagram, Terminal *t1, Terminal *t2);
+		void addImages(Diagram *diagram);
+		void addTable(Diagram *diagram);
+
+	private:
+		Parameters m_parameters;
+		QRandomGenerator m_random;
+		QString m_error;
+		QHash<int, ElementsLocation> m_locations;
+		QHash<Diagram *, int> m_next_position;
+		int m_folios_count = 0;
+		int m_elements_count = 0;
+		int m_conductors_count = 0;
+};
+
+#endif // PROJECTGENERATOR_H
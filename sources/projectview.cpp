@@ -1024,6 +1024,9 @@ void ProjectView::tabChanged(int tab_id)
 	if (DiagramView *dv = m_diagram_ids[m_previous_tab_index])
 		dv->diagram()->clearEventInterface();
 	m_previous_tab_index = tab_id;
+
+		//Warm up the folios which will probably be displayed next
+	m_prefetcher.prefetch(m_diagram_ids.values(), tab_id);
 }
 
 /**
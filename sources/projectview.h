@@ -18,6 +18,7 @@
 #ifndef PROJECT_VIEW_H
 #define PROJECT_VIEW_H
 
+#include "folioprefetcher.h"
 #include "qetresult.h"
 #include "titleblock/templatelocation.h"
 
@@ -184,6 +185,7 @@ class ProjectView : public QWidget
 		QMap<int, DiagramView *> m_diagram_ids;
 		int m_previous_tab_index = -1;
 		QList<DiagramView *> m_diagram_view_list;
+		FolioPrefetcher m_prefetcher;
 };
 
 
@@ -664,9 +664,11 @@ bool QET::compareCanonicalFilePaths(const QString &first, const QString &second)
 	@param filepath Path to the file to be written
 	@param error_message If non-zero, will contain an error message explaining
 	what happened when this function returns false.
+	@param indent number of spaces per level of indentation,
+	-1 to write the document without any whitespace (compact project file)
 	@return false if an error occurred, true otherwise
 */
-bool QET::writeXmlFile(QDomDocument &xml_doc, const QString &filepath, QString *error_message)
+bool QET::writeXmlFile(QDomDocument &xml_doc, const QString &filepath, QString *error_message, int indent)
 {
 	QSaveFile file(filepath);
 
@@ -693,7 +695,7 @@ bool QET::writeXmlFile(QDomDocument &xml_doc, const QString &filepath, QString *
 	out.setEncoding(QStringConverter::Utf8);
 #endif
 	out.setGenerateByteOrderMark(false);
-	out << xml_doc.toString(4);
+	out << xml_doc.toString(indent);
 	if  (!file.commit())
 	{
 		if (error_message) {
@@ -798,7 +800,7 @@ QActionGroup *QET::depthActionGroup(QObject *parent)
 	return action_group;
 }
 
-bool QET::writeToFile(QDomDocument &xml_doc, QFile *file, QString *error_message)
+bool QET::writeToFile(QDomDocument &xml_doc, QFile *file, QString *error_message, int indent)
 {
 	bool opened_here = file->isOpen() ? false : true;
 
@@ -831,7 +833,11 @@ bool QET::writeToFile(QDomDocument &xml_doc, QFile *file, QString *error_message
 	out.setEncoding(QStringConverter::Utf8);
 #endif
 	out.setGenerateByteOrderMark(false);
-	out << xml_doc.toString(4);
+	out << xml_doc.toString(indent);
+	out.flush();
+		//The previous content of the file can be longer,
+		//e.g. when the compact serialisation was enabled since the last write
+	file->resize(file->pos());
 	if (opened_here) {
 		file->close();
 	}
@@ -181,8 +181,8 @@ namespace QET {
 	qreal round(qreal, qreal);
 	qreal correctAngle(const qreal &, const bool &positive = false);
 	bool compareCanonicalFilePaths(const QString &, const QString &);
-	bool writeXmlFile(QDomDocument &xml_doc, const QString &filepath, QString * error_message= nullptr);
-	bool writeToFile (QDomDocument &xml_doc, QFile *file, QString *error_message = nullptr);
+	bool writeXmlFile(QDomDocument &xml_doc, const QString &filepath, QString * error_message= nullptr, int indent = 4);
+	bool writeToFile (QDomDocument &xml_doc, QFile *file, QString *error_message = nullptr, int indent = 4);
 	bool eachStrIsEqual (const QStringList &qsl);
 	QActionGroup *depthActionGroup(QObject *parent = nullptr);
 }
@@ -23,6 +23,9 @@
 #include "elementscollectioncache.h"
 #include "factory/elementfactory.h"
 #include "factory/elementpicturefactory.h"
+#include "projectconsistencychecker.h"
+#include "projectgenerator.h"
+#include "qetmemoryaccounting.h"
 #include "projectview.h"
 #include "qetdiagrameditor.h"
 #include "qeticons.h"
@@ -35,6 +38,7 @@
 #include "titleblocktemplate.h"
 #include "ui/aboutqetdialog.h"
 #include "ui/configpage/generalconfigurationpage.h"
+#include "utils/startupscheduler.h"
 #include "machine_info.h"
 #include "TerminalStrip/ui/terminalstripeditorwindow.h"
 #include "qetversion.h"
@@ -43,7 +47,9 @@
 #include <iostream>
 #define QUOTE(x) STRINGIFY(x)
 #define STRINGIFY(x) #x
+#include <QElapsedTimer>
 #include <QFontDatabase>
+#include <QJsonDocument>
 #include <QProcessEnvironment>
 #include <QRegularExpression>
 #ifdef BUILD_WITHOUT_KF5
@@ -101,6 +107,7 @@ QString system_language = QString();
 	@brief QETApp::QETApp
 */
 QETApp::QETApp() :
+	m_qsti(nullptr),
 	m_splash_screen(nullptr),
 	non_interactive_execution_(false)
 {
@@ -109,13 +116,34 @@ QETApp::QETApp() :
 	if (non_interactive_execution_) {
 		std::exit(EXIT_SUCCESS);
 	}
-	initConfiguration();
-	initLanguage();
-	QET::Icons::initIcons();
-	initFonts();
-	initStyle();
-	initSplashScreen();
-	initSystemTray();
+	if (qet_arguments_.checkProjectRequested()) {
+		initConfiguration();
+		std::exit(checkProjects(qet_arguments_.projectFiles()));
+	}
+	if (qet_arguments_.memoryReportRequested()) {
+		initConfiguration();
+		std::exit(printMemoryReport(qet_arguments_.projectFiles()));
+	}
+	if (qet_arguments_.generateProjectRequested()) {
+		initConfiguration();
+		std::exit(generateProject(qet_arguments_.generateProjectFile(),
+					  qet_arguments_.generatorParameters()));
+	}
+	m_startup_scheduler = new StartupScheduler(this);
+	if (qet_arguments_.startupTimingsRequested())
+	{
+		connect(m_startup_scheduler, &StartupScheduler::finished, this, [this]() {
+			std::cout << qPrintable(m_startup_scheduler->report()) << std::flush;
+		});
+	}
+
+		//Critical path : only what the first window needs
+	m_startup_scheduler->run(QStringLiteral("configuration"), [this]() { initConfiguration(); });
+	m_startup_scheduler->run(QStringLiteral("language"), [this]() { initLanguage(); });
+	m_startup_scheduler->run(QStringLiteral("icons"), []() { QET::Icons::initIcons(); });
+	m_startup_scheduler->run(QStringLiteral("fonts"), [this]() { initFonts(); });
+	m_startup_scheduler->run(QStringLiteral("style"), [this]() { initStyle(); });
+	m_startup_scheduler->run(QStringLiteral("splash screen"), [this]() { initSplashScreen(); });
 
 	connect(&signal_map, SIGNAL(mapped(QWidget *)),
 		this, SLOT(invertMainWindowVisibility(QWidget *)));
@@ -123,34 +151,39 @@ QETApp::QETApp() :
 	connect(qApp, &QApplication::lastWindowClosed,
 		this, &QETApp::checkRemainingWindows);
 
-	setSplashScreenStep(
-		tr("Chargement... Initialisation du cache des collections d'éléments",
-		   "splash screen caption"));
-	if (!collections_cache_) {
-	QString cache_path = QETApp::dataDir() + "/elements_cache.sqlite";
-
-		collections_cache_ = new ElementsCollectionCache(cache_path, this);
-		collections_cache_->setLocale(langFromSetting());
-	}
-
 	if (qet_arguments_.files().isEmpty())
 	{
 		setSplashScreenStep(tr("Chargement... Éditeur de schéma",
 					   "splash screen caption"));
-		new QETDiagramEditor();
+		m_startup_scheduler->run(QStringLiteral("diagram editor"), []() { new QETDiagramEditor(); });
 	} else
 	{
 		setSplashScreenStep(tr("Chargement... Ouverture des fichiers",
 					   "splash screen caption"));
-		openFiles(qet_arguments_);
+		m_startup_scheduler->run(QStringLiteral("open files"), [this]() { openFiles(qet_arguments_); });
 	}
 
-	buildSystemTrayMenu();
 	if (m_splash_screen) {
 		m_splash_screen -> hide();
 	}
 
-	checkBackupFiles();
+		//Deferred : run from the event loop once the editor is displayed
+	m_startup_scheduler->defer(QStringLiteral("system tray"), [this]()
+	{
+		initSystemTray();
+		buildSystemTrayMenu();
+	});
+		//The cache is also created on demand by collectionCache()
+		//if the elements panel needs it before.
+	m_startup_scheduler->defer(QStringLiteral("elements collection cache"), []() { collectionCache(); });
+	m_startup_scheduler->defer(QStringLiteral("title block collections"), []()
+	{
+		commonTitleBlockTemplatesCollection();
+		companyTitleBlockTemplatesCollection();
+		customTitleBlockTemplatesCollection();
+	});
+	m_startup_scheduler->defer(QStringLiteral("backup files"), [this]() { checkBackupFiles(); });
+	m_startup_scheduler->setInteractive();
 }
 
 /**
@@ -424,9 +457,28 @@ void QETApp::newElementEditor()
 */
 ElementsCollectionCache *QETApp::collectionCache()
 {
+		//Opening the cache is deferred at startup,
+		//create it if it is needed before.
+	if (!collections_cache_ && m_qetapp)
+	{
+		QString cache_path = QETApp::dataDir() + "/elements_cache.sqlite";
+
+		collections_cache_ = new ElementsCollectionCache(cache_path, m_qetapp);
+		collections_cache_->setLocale(langFromSetting());
+	}
 	return(collections_cache_);
 }
 
+/**
+	@brief QETApp::startupScheduler
+	@return the scheduler of the startup of the application,
+	used to measure it or to defer a task until the application is interactive.
+*/
+StartupScheduler *QETApp::startupScheduler()
+{
+	return m_qetapp ? m_qetapp->m_startup_scheduler : nullptr;
+}
+
 /**
 	@brief QETApp::commonTitleBlockTemplatesCollection
 	@return the common title block templates collection,
@@ -721,6 +773,8 @@ void QETApp::resetCollectionsPath()
 	m_custom_element_dir.clear();
 	m_custom_element_dir_is_set = false;
 
+	ElementsLocation::clearResolvedPaths();
+
 	m_user_company_tbt_dir.clear();
 
 	m_user_custom_tbt_dir.clear();
@@ -1739,9 +1793,7 @@ void QETApp::openProjectFiles(const QStringList &files_list) {
 
 		// opens the files in the editor thus chosen
 		// ouvre les fichiers dans l'editeur ainsi choisi
-		foreach(QString file, files_list) {
-			de_open -> openAndAddProject(file);
-		}
+		de_open -> openAndAddProjects(files_list);
 	} else {
 		// create a new editor that will open the files
 		// cree un nouvel editeur qui ouvrira les fichiers
@@ -2235,8 +2287,6 @@ void QETApp::initConfiguration()
 */
 void QETApp::initSystemTray()
 {
-	setSplashScreenStep(tr("Chargement... icône du systray",
-				   "splash screen caption"));
 	// initialization of the icon menus in the systray
 	// initialisation des menus de l'icone dans le systray
 	menu_systray = new QMenu(tr("QElectroTech", "systray menu title"));
@@ -2584,7 +2634,13 @@ void QETApp::printHelp()
 		"Options disponibles : \n"
 		"  --help                        Afficher l'aide sur les options\n"
 		"  -v, --version                 Afficher la version\n"
-		"  --license                     Afficher la licence\n")
+		"  --license                     Afficher la licence\n"
+		"  --check-project               Vérifier la cohérence des projets et quitter\n"
+		"  --memory-report               Afficher l'utilisation mémoire des projets (JSON) et quitter\n"
+		"  --startup-timings             Afficher la durée de chaque étape du démarrage\n"
+		"  --generate-project=FICHIER    Générer un projet synthétique et quitter\n"
+		"  --generator-parameters=PARAM  Paramètres du générateur, par exemple\n"
+		"                                folios=1000,elements=200,seed=1\n")
 #ifdef QET_ALLOW_OVERRIDE_CED_OPTION
 		+ tr("  --common-elements-dir=DIR     Definir le dossier de la collection d'elements\n")
 #endif
@@ -2612,6 +2668,138 @@ void QETApp::printVersion()
 	std::cout << qPrintable(QetVersion::displayedVersion()) << std::endl;
 }
 
+/**
+	@brief QETApp::checkProjects
+	Check the consistency of each project of @a files
+	and print the found issues on standard output.
+	@param files : the project files to check
+	@return EXIT_SUCCESS if no error was found, else EXIT_FAILURE
+	@see ProjectConsistencyChecker
+*/
+int QETApp::checkProjects(const QStringList &files)
+{
+	int exit_code = EXIT_SUCCESS;
+
+	for (const auto &file : files)
+	{
+		std::cout << qPrintable(file) << std::endl;
+
+		QElapsedTimer timer;
+		timer.start();
+		QETProject project(file);
+		if (project.state() != QETProject::Ok)
+		{
+			std::cout << qPrintable(tr("  Impossible d'ouvrir le projet")) << std::endl;
+			exit_code = EXIT_FAILURE;
+			continue;
+		}
+		const qint64 load_time = timer.restart();
+
+		const auto issues = ProjectConsistencyChecker(&project).check();
+		for (const auto &issue : issues)
+		{
+			std::cout << "  " << qPrintable(ProjectConsistencyChecker::issueToString(issue)) << std::endl;
+			if (issue.severity == ProjectConsistencyChecker::Error) {
+				exit_code = EXIT_FAILURE;
+			}
+		}
+
+		std::cout << qPrintable(tr("  %1 problème(s) trouvé(s), chargement %2 ms, vérification %3 ms")
+								.arg(issues.size())
+								.arg(load_time)
+								.arg(timer.elapsed()))
+				  << std::endl;
+	}
+
+	return exit_code;
+}
+
+/**
+	@brief QETApp::printMemoryReport
+	Open each project of @a files and print on standard output
+	the report of the memory used by the projects, in json.
+	@param files : the project files
+	@return EXIT_SUCCESS if every project was opened, else EXIT_FAILURE
+	@see QetMemoryAccounting
+*/
+int QETApp::printMemoryReport(const QStringList &files)
+{
+	int exit_code = EXIT_SUCCESS;
+	QList<QETProject *> projects;
+
+	for (const auto &file : files)
+	{
+		auto project = new QETProject(file);
+		if (project->state() != QETProject::Ok)
+		{
+			std::cerr << qPrintable(tr("Impossible d'ouvrir le projet %1").arg(file)) << std::endl;
+			exit_code = EXIT_FAILURE;
+			delete project;
+			continue;
+		}
+		projects << project;
+	}
+
+	std::cout << QJsonDocument(QetMemoryAccounting::toJson(projects)).toJson().constData()
+			  << std::endl;
+
+	qDeleteAll(projects);
+	return exit_code;
+}
+
+/**
+	@brief QETApp::generateProject
+	Generate a synthetic project and save it to @a file,
+	used to measure the performances on large projects.
+	@param file : the file of the generated project
+	@param parameters : the parameters of the generator,
+	see ProjectGenerator::Parameters::fromString
+	@return EXIT_SUCCESS if the project was generated and saved,
+	else EXIT_FAILURE
+	@see ProjectGenerator
+*/
+int QETApp::generateProject(const QString &file, const QString &parameters)
+{
+	QString error;
+	const auto params = ProjectGenerator::Parameters::fromString(parameters, &error);
+	if (!error.isEmpty())
+	{
+		std::cerr << qPrintable(error) << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	QElapsedTimer timer;
+	timer.start();
+
+	QETProject project;
+	ProjectGenerator generator(params);
+	if (!generator.generate(&project))
+	{
+		std::cerr << qPrintable(generator.errorString()) << std::endl;
+		return EXIT_FAILURE;
+	}
+	const qint64 generation_time = timer.restart();
+
+	project.setFilePath(file);
+	const auto result = project.write();
+	if (!result.isOk())
+	{
+		std::cerr << qPrintable(result.errorMessage()) << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::cout << qPrintable(tr("%1 : %2 folio(s), %3 élément(s), %4 conducteur(s), génération %5 ms, enregistrement %6 ms")
+							.arg(file)
+							.arg(generator.foliosCount())
+							.arg(generator.elementsCount())
+							.arg(generator.conductorsCount())
+							.arg(generation_time)
+							.arg(timer.elapsed()))
+			  << std::endl;
+
+	return EXIT_SUCCESS;
+}
+
 /**
 	@brief QETApp::printLicense
 	Display license on standard output
@@ -47,6 +47,7 @@ class QETProject;
 class QETTitleBlockTemplateEditor;
 class QTextOrientationSpinBoxWidget;
 class RecentFiles;
+class StartupScheduler;
 
 /**
 	@brief The QETApp class
@@ -72,8 +73,12 @@ class QETApp : public QObject
 		static void printHelp();
 		static void printVersion();
 		static void printLicense();
+		static int checkProjects(const QStringList &files);
+		static int printMemoryReport(const QStringList &files);
+		static int generateProject(const QString &file, const QString &parameters);
 		
 		static ElementsCollectionCache *collectionCache();
+		static StartupScheduler *startupScheduler();
 		
 		static TitleBlockTemplatesFilesCollection *commonTitleBlockTemplatesCollection();
 		static TitleBlockTemplatesFilesCollection *companyTitleBlockTemplatesCollection();
@@ -220,6 +225,7 @@ class QETApp : public QObject
 		 */
 		bool non_interactive_execution_;
 		QPalette initial_palette_;   ///< System color palette
+		StartupScheduler *m_startup_scheduler = nullptr; ///< Phases of the startup
 		
 		static TitleBlockTemplatesFilesCollection *m_common_tbt_collection;
 		static TitleBlockTemplatesFilesCollection *m_company_tbt_collection;
@@ -26,7 +26,10 @@ QETArguments::QETArguments(QObject *parent) :
 	QObject(parent),
 	print_help_(false),
 	print_license_(false),
-	print_version_(false)
+	print_version_(false),
+	check_project_(false),
+	memory_report_(false),
+	startup_timings_(false)
 {
 }
 
@@ -39,7 +42,10 @@ QETArguments::QETArguments(const QList<QString> &args, QObject *parent) :
 	QObject(parent),
 	print_help_(false),
 	print_license_(false),
-	print_version_(false)
+	print_version_(false),
+	check_project_(false),
+	memory_report_(false),
+	startup_timings_(false)
 {
 	parseArguments(args);
 }
@@ -70,7 +76,12 @@ common_tbt_dir_(qet_arguments.common_tbt_dir_),
 	lang_dir_(qet_arguments.lang_dir_),
 	print_help_(qet_arguments.print_help_),
 	print_license_(qet_arguments.print_license_),
-	print_version_(qet_arguments.print_version_)
+	print_version_(qet_arguments.print_version_),
+	check_project_(qet_arguments.check_project_),
+	memory_report_(qet_arguments.memory_report_),
+	startup_timings_(qet_arguments.startup_timings_),
+	generate_project_file_(qet_arguments.generate_project_file_),
+	generator_parameters_(qet_arguments.generator_parameters_)
 {
 }
 
@@ -100,6 +111,11 @@ QETArguments &QETArguments::operator=(const QETArguments &qet_arguments) {
 	print_help_      = qet_arguments.print_help_;
 	print_license_   = qet_arguments.print_license_;
 	print_version_   = qet_arguments.print_version_;
+	check_project_   = qet_arguments.check_project_;
+	memory_report_   = qet_arguments.memory_report_;
+	startup_timings_ = qet_arguments.startup_timings_;
+	generate_project_file_ = qet_arguments.generate_project_file_;
+	generator_parameters_  = qet_arguments.generator_parameters_;
 	return(*this);
 }
 
@@ -199,6 +215,8 @@ void QETArguments::clear()
 #ifdef QET_ALLOW_OVERRIDE_DD_OPTION
 	data_dir_.clear();
 #endif
+	generate_project_file_.clear();
+	generator_parameters_.clear();
 }
 
 /**
@@ -254,6 +272,11 @@ void QETArguments::handleFileArgument(const QString &file) {
 	  * --version
 	  * -v
 	  * --license
+	  * --check-project
+	  * --memory-report
+	  * --startup-timings
+	  * --generate-project=
+	  * --generator-parameters=
 */
 void QETArguments::handleOptionArgument(const QString &option) {
 	if (option == QString("--help")) {
@@ -268,6 +291,18 @@ void QETArguments::handleOptionArgument(const QString &option) {
 		print_license_ = true;
 		options_ << option;
 		return;
+	} else if (option == QString("--check-project")) {
+		check_project_ = true;
+		options_ << option;
+		return;
+	} else if (option == QString("--memory-report")) {
+		memory_report_ = true;
+		options_ << option;
+		return;
+	} else if (option == QString("--startup-timings")) {
+		startup_timings_ = true;
+		options_ << option;
+		return;
 	}
 	
 #ifdef QET_ALLOW_OVERRIDE_CED_OPTION
@@ -299,6 +334,18 @@ void QETArguments::handleOptionArgument(const QString &option) {
 	}
 #endif
 	
+	QString gp_arg("--generate-project=");
+	if (option.startsWith(gp_arg)) {
+		generate_project_file_ = option.mid(gp_arg.length());
+		return;
+	}
+	
+	QString gpp_arg("--generator-parameters=");
+	if (option.startsWith(gpp_arg)) {
+		generator_parameters_ = option.mid(gpp_arg.length());
+		return;
+	}
+	
 	QString ld_arg("--lang-dir=");
 	if (option.startsWith(ld_arg)) {
 		lang_dir_ = option.mid(ld_arg.length());
@@ -430,3 +477,72 @@ bool QETArguments::printVersionRequested() const
 {
 	return(print_version_);
 }
+
+/**
+	@return true if the arguments ask to check the consistency of the
+	project files and quit, false otherwise
+*/
+bool QETArguments::checkProjectRequested() const
+{
+	return(check_project_);
+}
+
+/**
+	@return true if the arguments ask to print the memory report
+	of the project files and quit, false otherwise
+*/
+bool QETArguments::memoryReportRequested() const
+{
+	return(memory_report_);
+}
+
+/**
+	@return true if the arguments ask a command line tool
+	(--check-project, --memory-report or --generate-project=)
+	which runs without gui and quit with its own exit code.
+	These tools must not be forwarded to a running instance of QElectroTech.
+*/
+bool QETArguments::commandLineToolRequested() const
+{
+	return(checkProjectRequested() ||
+		   memoryReportRequested() ||
+		   generateProjectRequested());
+}
+
+/**
+	@return true if the arguments ask to print the duration of each
+	phase of the startup, false otherwise
+*/
+bool QETArguments::startupTimingsRequested() const
+{
+	return(startup_timings_);
+}
+
+/**
+	@return true if the arguments ask to generate a synthetic project
+	and quit, false otherwise
+	@see ProjectGenerator
+*/
+bool QETArguments::generateProjectRequested() const
+{
+	return(!generate_project_file_.isEmpty());
+}
+
+/**
+	@return the file where the generated project must be saved,
+	or an empty string if no project must be generated
+*/
+QString QETArguments::generateProjectFile() const
+{
+	return(generate_project_file_);
+}
+
+/**
+	@return the parameters of the project generator given
+	by the user, in the form "key=value,key=value"
+	@see ProjectGenerator::Parameters::fromString
+*/
+QString QETArguments::generatorParameters() const
+{
+	return(generator_parameters_);
+}
@@ -63,6 +63,13 @@ class QETArguments : public QObject {
 	virtual bool printHelpRequested() const;
 	virtual bool printLicenseRequested() const;
 	virtual bool printVersionRequested() const;
+	virtual bool checkProjectRequested() const;
+	virtual bool memoryReportRequested() const;
+	virtual bool startupTimingsRequested() const;
+	virtual bool generateProjectRequested() const;
+	virtual QString generateProjectFile() const;
+	virtual QString generatorParameters() const;
+	virtual bool commandLineToolRequested() const;
 	virtual QList<QString> options() const;
 	virtual QList<QString> unknownOptions() const;
 	
@@ -95,5 +102,10 @@ class QETArguments : public QObject {
 	bool print_help_;
 	bool print_license_;
 	bool print_version_;
+	bool check_project_;
+	bool memory_report_;
+	bool startup_timings_;
+	QString generate_project_file_;
+	QString generator_parameters_;
 };
 #endif
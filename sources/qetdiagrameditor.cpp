@@ -29,6 +29,7 @@
 #include "elementspanelwidget.h"
 #include "factory/qetgraphicstablefactory.h"
 #include "print/projectprintwindow.h"
+#include "projectfilereader.h"
 #include "qetgraphicsitem/ViewItem/qetgraphicstableitem.h"
 #include "qetgraphicsitem/conductortextitem.h"
 #include "qetgraphicsitem/dynamicelementtextitem.h"
@@ -38,6 +39,9 @@
 #include "ui/bomexportdialog.h"
 #include "ui/diagrampropertieseditordockwidget.h"
 #include "ui/dialogwaiting.h"
+#include "ui/memoryreportdialog.h"
+#include "ui/projectconsistencydialog.h"
+#include "ui/projectdiffdialog.h"
 #include "undocommand/addelementtextcommand.h"
 #include "undocommand/rotateselectioncommand.h"
 #include "undocommand/rotatetextscommand.h"
@@ -130,13 +134,10 @@ QETDiagramEditor::QETDiagramEditor(const QStringList &files, QWidget *parent) :
 	show();
 
 		//If valid file path is given as arguments
-	uint opened_projects = 0;
 	if (files.count())
 	{
 			//So we open this files
-		foreach(QString file, files)
-			if (openAndAddProject(file))
-				++ opened_projects;
+		openAndAddProjects(files);
 	}
 
 	slot_updateActions();
@@ -419,6 +420,41 @@ void QETDiagramEditor::setUpActions()
 		}
 	});
 
+		//Check the consistency of the current project
+	m_check_project = new QAction(QET::Icons::DialogInformation, tr("Vérifier la cohérence du projet"), this);
+	connect(m_check_project, &QAction::triggered, [this]() {
+		if (QETProject *project = this->currentProject()) {
+			ProjectConsistencyDialog dialog(project, this);
+			dialog.exec();
+		}
+	});
+
+		//Compare the current project with a project file
+	m_compare_project = new QAction(QET::Icons::DocumentOpen, tr("Comparer avec un fichier projet..."), this);
+	connect(m_compare_project, &QAction::triggered, [this]() {
+		if (QETProject *project = this->currentProject())
+		{
+			QString filepath = QFileDialog::getOpenFileName(
+				this,
+				tr("Comparer avec un fichier projet"),
+				project->filePath().isEmpty() ? open_dialog_dir.absolutePath()
+											  : QFileInfo(project->filePath()).absolutePath(),
+				tr("Projets QElectroTech (*.qet);;Fichiers XML (*.xml);;Tous les fichiers (*)")
+			);
+			if (!filepath.isEmpty()) {
+				ProjectDiffDialog dialog(project, filepath, this);
+				dialog.exec();
+			}
+		}
+	});
+
+		//Show the memory used by the projects
+	m_memory_report = new QAction(QET::Icons::DialogInformation, tr("Utilisation de la mémoire"), this);
+	connect(m_memory_report, &QAction::triggered, [this]() {
+		MemoryReportDialog dialog(this);
+		dialog.exec();
+	});
+
 		//Export nomenclature to CSV
 	m_csv_export = new QAction(QET::Icons::DocumentSpreadsheet, tr("Exporter au format CSV"), this);
 	connect(m_csv_export, &QAction::triggered, [this]() {
@@ -828,6 +864,9 @@ void QETDiagramEditor::setUpMenu()
 	menu_project -> addAction(m_project_add_diagram);
 	menu_project -> addAction(m_remove_diagram_from_project);
 	menu_project -> addAction(m_clean_project);
+	menu_project -> addAction(m_check_project);
+	menu_project -> addAction(m_compare_project);
+	menu_project -> addAction(m_memory_report);
 	menu_project -> addSeparator();
 	menu_project -> addAction(m_add_summary);
 	menu_project -> addAction(m_add_nomenclature);
@@ -1056,8 +1095,6 @@ bool QETDiagramEditor::openAndAddProject(
 {
 	if (filepath.isEmpty()) return(false);
 
-	QFileInfo filepath_info(filepath);
-
 	//Check if project is not open in another editor
 	if (QETDiagramEditor *diagram_editor = QETApp::diagramEditorForFile(filepath))
 	{
@@ -1078,6 +1115,133 @@ bool QETDiagramEditor::openAndAddProject(
 		}
 	}
 
+	if (!checkProjectFile(filepath, interactive)) {
+		return(false);
+	}
+
+	//Create the project
+	DialogWaiting::instance(this);
+
+	QETProject *project = new QETProject(filepath);
+	const bool opened = addOpenedProject(project, filepath, interactive);
+	DialogWaiting::dropInstance();
+	return opened;
+}
+
+/**
+	@brief QETDiagramEditor::openAndAddProjects
+	Open several projects files and add it to this editor.
+	The files are read and parsed in parallel by worker threads, each project
+	is then built in the gui thread as soon as its file is parsed.
+	This function return before the projects are opened.
+	@param files : the path of the files to open
+*/
+void QETDiagramEditor::openAndAddProjects(const QStringList &files)
+{
+	QStringList files_to_read;
+	QSet<QString> canonical_paths;
+	for (const auto &filepath : files)
+	{
+		if (filepath.isEmpty()) {
+			continue;
+		}
+
+			//Files already opened or which can't be opened are handled
+			//by openAndAddProject, which show the appropriate message
+		if (QETApp::diagramEditorForFile(filepath) ||
+			!QFileInfo(filepath).isReadable())
+		{
+			openAndAddProject(filepath);
+			continue;
+		}
+
+		const auto canonical_path = QFileInfo(filepath).canonicalFilePath();
+		if (!canonical_paths.contains(canonical_path)) {
+			canonical_paths.insert(canonical_path);
+			files_to_read << filepath;
+		}
+	}
+
+		//Nothing to win for a single file
+	if (files_to_read.size() < 2)
+	{
+		for (const auto &filepath : qAsConst(files_to_read)) {
+			openAndAddProject(filepath);
+		}
+		return;
+	}
+
+	auto reader = new ProjectFileReader(this);
+	const int count = files_to_read.size();
+
+	auto dialog = DialogWaiting::instance(this);
+	dialog->setModal(true);
+	dialog->show();
+	dialog->setTitle(tr("<p align=\"center\">"
+						"<b>Ouverture des projets en cours...</b><br/>"
+						"Lecture de %1 fichiers"
+						"</p>").arg(count));
+	dialog->setProgressBarRange(0, count);
+	dialog->setProgressBar(0);
+
+	connect(reader, &ProjectFileReader::fileRead, this,
+			[this, reader, count](const ProjectFileReader::Result &result)
+	{
+		auto dialog = DialogWaiting::instance(this);
+		dialog->setModal(true);
+		dialog->show();
+		dialog->setTitle(tr("<p align=\"center\">"
+							"<b>Ouverture des projets en cours...</b><br/>"
+							"Projet %1 sur %2"
+							"</p>").arg(reader->readCount()).arg(count));
+		dialog->setDetail(QFileInfo(result.file_path).fileName());
+
+			//The file may have been opened during the parsing
+		if (QETApp::diagramEditorForFile(result.file_path)) {
+			return;
+		}
+
+			//Let openAndAddProject report the error to the user
+		if (result.state != QETProject::Ok) {
+			openAndAddProject(result.file_path);
+			return;
+		}
+
+		if (!checkProjectFile(result.file_path, true)) {
+			return;
+		}
+
+		QDomDocument document = result.document;
+		addOpenedProject(new QETProject(result.file_path, document),
+						 result.file_path,
+						 true);
+
+			//Building the project change the progress bar of the dialog
+		dialog->setProgressBarRange(0, count);
+		dialog->setProgressBar(reader->readCount());
+	});
+
+	connect(reader, &ProjectFileReader::finished, this, [this, reader]()
+	{
+		DialogWaiting::dropInstance();
+		reader->deleteLater();
+		slot_updateActions();
+	});
+
+	reader->read(files_to_read);
+}
+
+/**
+	@brief QETDiagramEditor::checkProjectFile
+	Check if the project file @a filepath exists and can be read.
+	@param filepath
+	@param interactive : true to display messages to the user
+	@return false if the file can't be opened
+*/
+bool QETDiagramEditor::checkProjectFile(const QString &filepath, bool interactive)
+{
+	QFileInfo filepath_info(filepath);
+
 	// check the file exists
 	if (!filepath_info.exists())
 	{
@@ -1124,10 +1288,20 @@ bool QETDiagramEditor::openAndAddProject(
 		}
 	}
 
-	//Create the project
-	DialogWaiting::instance(this);
+	return(true);
+}
 
-	QETProject *project = new QETProject(filepath);
+/**
+	@brief QETDiagramEditor::addOpenedProject
+	Add the @a project opened from @a filepath to this editor,
+	or delete it if the opening failed.
+	@param project
+	@param filepath
+	@param interactive : true to display messages to the user
+	@return true if the project is added
+*/
+bool QETDiagramEditor::addOpenedProject(QETProject *project, const QString &filepath, bool interactive)
+{
 	if (project -> state() != QETProject::Ok)
 	{
 		if (interactive && project -> state() != QETProject::FileOpenDiscard)
@@ -1145,13 +1319,11 @@ bool QETDiagramEditor::openAndAddProject(
 			);
 		}
 		delete project;
-		DialogWaiting::dropInstance();
 		return(false);
 	}
 
 	QETApp::projectsRecentFiles() -> fileWasOpened(filepath);
 	addProject(project);
-	DialogWaiting::dropInstance();
 	return true;
 }
 
@@ -1562,6 +1734,8 @@ void QETDiagramEditor::slot_updateActions()
 	m_project_add_diagram         -> setEnabled(editable_project);
 	m_remove_diagram_from_project -> setEnabled(editable_project);
 	m_clean_project               -> setEnabled(editable_project);
+	m_check_project               -> setEnabled(opened_project);
+	m_compare_project             -> setEnabled(opened_project);
 	m_add_summary                 -> setEnabled(editable_project);
 	m_add_nomenclature            -> setEnabled(editable_project);
 	m_csv_export                  -> setEnabled(editable_project);
@@ -2098,7 +2272,15 @@ void QETDiagramEditor::projectWasClosed(ProjectView *project_view)
 	//set nullptr to "m_selection_properties_editor->setDiagram()" fixes this crash
 	m_selection_properties_editor->setDiagram(nullptr);
 	project_view -> deleteLater();
-	project -> deleteLater();
+
+		//Release the folios of the project one by one
+		//in the next turns of the event loop, instead of all at once.
+	QSettings settings;
+	if (project && settings.value(QStringLiteral("diagrameditor/deferred-project-release"), true).toBool()) {
+		project -> releaseLater();
+	} else if (project) {
+		project -> deleteLater();
+	}
 }
 
 /**
@@ -106,6 +106,26 @@ void GraphicsTablePropertiesEditor::setTable(QetGraphicsTableItem *table)
 	updateUi();
 }
 
+/**
+	@brief GraphicsTablePropertiesEditor::releaseEditedItems
+	Release the edited table, this widget doesn't edit anything
+	until the next call of setTable.
+*/
+void GraphicsTablePropertiesEditor::releaseEditedItems()
+{
+	for (auto c : m_connect_list) {
+		disconnect(c);
+	}
+	m_connect_list.clear();
+	if (m_current_model_editor)
+	{
+		ui->m_content_layout->removeWidget(m_current_model_editor);
+		m_current_model_editor->deleteLater();
+		m_current_model_editor = nullptr;
+	}
+	m_table_item = nullptr;
+}
+
 /**
 	@brief GraphicsTablePropertiesEditor::apply
 	Apply the current edition
@@ -45,6 +45,7 @@ class GraphicsTablePropertiesEditor : public PropertiesEditorWidget
 		~GraphicsTablePropertiesEditor() override;
 
 		void setTable(QetGraphicsTableItem *table);
+		void releaseEditedItems() override;
 		virtual void apply() override;
 		QUndoCommand * associatedUndo() const override;
 		virtual bool setLiveEdit(bool live_edit) override;
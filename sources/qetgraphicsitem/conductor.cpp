@@ -26,11 +26,13 @@
 #include "../diagramcommands.h"
 #include "../qetdiagrameditor.h"
 #include "../qetgraphicsitem/terminal.h"
+#include "../qetxml.h"
 #include "../ui/conductorpropertiesdialog.h"
 #include "conductortextitem.h"
 #include "element.h"
 #include "../QetGraphicsItemModeler/qetgraphicshandleritem.h"
 #include "../utils/qetutils.h"
+#include "../utils/qetlevelofdetail.h"
 
 #include <QMultiHash>
 #include <QtDebug>
@@ -499,7 +501,6 @@ QPointF Conductor::extendTerminal(const QPointF &terminal, Qet::Orientation term
 */
 void Conductor::paint(QPainter *painter, const QStyleOptionGraphicsItem *options, QWidget *qw)
 {
-	Q_UNUSED(qw);
 	painter -> save();
 	painter -> setRenderHint(QPainter::Antialiasing, false);
 
@@ -531,9 +532,12 @@ void Conductor::paint(QPainter *painter, const QStyleOptionGraphicsItem *options
 	final_conductor_pen.setStyle(m_properties.style);
 	final_conductor_pen.setJoinStyle(Qt::SvgMiterJoin); // better rendering with dot
 
-		//Use a cosmetic line, below a certain zoom
-	if (options && options->levelOfDetailFromTransform(painter->worldTransform()) < 0.5)
-	{
+		//Below a certain zoom, use a cosmetic line and only draw the path,
+		//the second color, single line symbols and junctions are too small
+		//to be seen. Never when exported or printed.
+	const bool reduced_ = QetLevelOfDetail::conductorDetail(painter, options, qw)
+						  == QetLevelOfDetail::Reduced;
+	if (reduced_) {
 		final_conductor_pen.setCosmetic(true);
 	}
 
@@ -541,6 +545,12 @@ void Conductor::paint(QPainter *painter, const QStyleOptionGraphicsItem *options
 
 		//Draw the conductor
 	painter -> drawPath(path());
+
+	if (reduced_) {
+		painter -> restore();
+		return;
+	}
+
 		//Draw the second color
 	if(m_properties.m_bicolor)
 	{
@@ -725,6 +735,9 @@ QVariant Conductor::itemChange(GraphicsItemChange change, const QVariant &value)
 	else if (change == QGraphicsItem::ItemPositionHasChanged && isSelected()) {
 		adjustHandlerPos();
 	}
+	else if (change == QGraphicsItem::ItemScenePositionHasChanged) {
+		invalidateJunctions();
+	}
 
 	return(QGraphicsObject::itemChange(change, value));
 }
@@ -905,8 +918,7 @@ void Conductor::removeHandler()
 */
 QRectF Conductor::boundingRect() const
 {
-	QRectF br = shape().boundingRect();
-	return br.adjusted(-10, -10, 10, 10);
+	return m_bounding_rect;
 }
 
 /**
@@ -916,25 +928,148 @@ QRectF Conductor::boundingRect() const
 */
 QPainterPath Conductor::shape() const
 {
-	QPainterPathStroker pps;
-	pps.setWidth(m_mouse_over? 5 : 1);
-	pps.setJoinStyle(conductor_pen.joinStyle());
-
-	QPainterPath shape_(pps.createStroke(path()));
-
+	QPainterPath &shape_ = m_mouse_over ? m_hovered_shape : m_shape;
+	if (shape_.isEmpty() && !m_path.isEmpty())
+	{
+		QPainterPathStroker pps;
+		pps.setWidth(m_mouse_over? HOVERED_SHAPE_WIDTH : SHAPE_WIDTH);
+		pps.setJoinStyle(conductor_pen.joinStyle());
+		shape_ = pps.createStroke(m_path);
+	}
 	return shape_;
 }
 
+/**
+	@brief Conductor::contains
+	Reimplemented from QGraphicsItem, to not use the shape.
+	@param point : point in item coordinates
+	@return true if @a point is on the shape of the conductor
+*/
+bool Conductor::contains(const QPointF &point) const
+{
+	return isNearPath(point,
+					  (m_mouse_over? HOVERED_SHAPE_WIDTH : SHAPE_WIDTH)/2);
+}
+
 /**
 	@brief Conductor::nearShape
 	@return : An area in which it is considered a point is near this conductor.
+	To know if a point is near, use isNear() which doesn't build the area.
 */
 QPainterPath Conductor::nearShape() const
 {
-	QPainterPathStroker pps;
-	pps.setWidth(1300);
-	pps.setJoinStyle(conductor_pen.joinStyle());
-	return pps.createStroke(path());
+	if (m_near_shape.isEmpty() && !m_path.isEmpty())
+	{
+		QPainterPathStroker pps;
+		pps.setWidth(NEAR_SHAPE_WIDTH);
+		pps.setJoinStyle(conductor_pen.joinStyle());
+		m_near_shape = pps.createStroke(m_path);
+	}
+	return m_near_shape;
+}
+
+/**
+	@brief Conductor::isNear
+	@param point : point in item coordinates
+	@return true if @a point is in the area returned by nearShape()
+*/
+bool Conductor::isNear(const QPointF &point) const
+{
+	return isNearPath(point, NEAR_SHAPE_WIDTH/2);
+}
+
+/**
+	@brief Conductor::isNearPath
+	The path of a conductor is made of horizontal and vertical lines,
+	stroked with a square cap and a miter join the area around each line
+	is a rectangle, so the test is done line by line without stroking the path.
+	@param point : point in item coordinates
+	@param distance : half width of the area around the path
+	@return true if @a point is at @a distance or less of the path
+*/
+bool Conductor::isNearPath(const QPointF &point, qreal distance) const
+{
+	for (const auto &line : m_path_lines)
+	{
+		if (line.dx() == 0 || line.dy() == 0)
+		{
+			const QRectF area = QRectF(line.p1(), line.p2())
+								.normalized()
+								.adjusted(-distance, -distance, distance, distance);
+			if (area.contains(point)) {
+				return true;
+			}
+		}
+		else if (QLineF(point, nearestPointOnLine(point, line)).length() <= distance) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+	@brief Conductor::movePointNear
+	@param point : point in item coordinates
+	@return @a point if it is near this conductor (see isNear()),
+	else the nearest point of the area returned by nearShape().
+*/
+QPointF Conductor::movePointNear(const QPointF &point) const
+{
+	const qreal distance = NEAR_SHAPE_WIDTH/2;
+	QPointF nearest = point;
+	qreal min_length = -1;
+
+	for (const auto &line : m_path_lines)
+	{
+		QPointF moved;
+		if (line.dx() == 0 || line.dy() == 0)
+		{
+			const QRectF area = QRectF(line.p1(), line.p2())
+								.normalized()
+								.adjusted(-distance, -distance, distance, distance);
+			moved = QPointF(qBound(area.left(), point.x(), area.right()),
+							qBound(area.top(), point.y(), area.bottom()));
+		}
+		else
+		{
+			const QPointF on_line = nearestPointOnLine(point, line);
+			QLineF to_point(on_line, point);
+			if (to_point.length() > distance) {
+				to_point.setLength(distance);
+			}
+			moved = to_point.p2();
+		}
+
+		const qreal length = QLineF(moved, point).length();
+		if (min_length < 0 || length < min_length)
+		{
+			min_length = length;
+			nearest = moved;
+		}
+	}
+	return nearest;
+}
+
+/**
+	@brief Conductor::nearestPointOnLine
+	@param point
+	@param line
+	@return the point of @a line (the segment, not the infinite line)
+	nearest to @a point
+*/
+QPointF Conductor::nearestPointOnLine(const QPointF &point, const QLineF &line)
+{
+	const qreal dx = line.dx();
+	const qreal dy = line.dy();
+	const qreal length_2 = dx*dx + dy*dy;
+	if (qFuzzyIsNull(length_2)) {
+		return line.p1();
+	}
+
+	const qreal t = qBound(0.0,
+						   ((point.x() - line.x1())*dx + (point.y() - line.y1())*dy) / length_2,
+						   1.0);
+	return QPointF(line.x1() + t*dx, line.y1() + t*dy);
 }
 
 /**
@@ -1042,9 +1177,10 @@ QDomElement Conductor::toXml(QDomDocument &dom_document,
 				 int> &table_adr_id) const
 {
 	QDomElement dom_element = dom_document.createElement("conductor");
+	const QString tag_name = dom_element.tagName();
 
-	dom_element.setAttribute("x", QString::number(pos().x()));
-	dom_element.setAttribute("y", QString::number(pos().y()));
+	QETXML::setElidableAttribute(dom_element, tag_name, "x", QString::number(pos().x()));
+	QETXML::setElidableAttribute(dom_element, tag_name, "y", QString::number(pos().y()));
 	
 	// Terminal is uniquely identified by the uuid of the terminal and the element
 	if (terminal1->uuid().isNull()) {
@@ -1078,7 +1214,7 @@ QDomElement Conductor::toXml(QDomDocument &dom_document,
 		dom_element.setAttribute("terminal2", terminal2->uuid().toString());
 		dom_element.setAttribute("terminalname2", terminal2->name());
 	}
-	dom_element.setAttribute("freezeLabel", m_freeze_label? "true" : "false");
+	QETXML::setElidableAttribute(dom_element, tag_name, "freezeLabel", m_freeze_label? "true" : "false");
 
 	// on n'exporte les segments du conducteur que si ceux-ci ont
 	// ete modifies par l'utilisateur
@@ -1361,9 +1497,8 @@ void Conductor::calculateTextItemPosition()
 			//Text field was moved by user:
 			//we check if text field is yet  near the conductor
 		QPointF text_item_pos = m_text_item -> pos();
-		QPainterPath near_shape = nearShape();
-		if (!near_shape.contains(text_item_pos)) {
-			m_text_item -> setPos(movePointIntoPolygon(text_item_pos, near_shape));
+		if (!isNear(text_item_pos)) {
+			m_text_item -> setPos(movePointNear(text_item_pos));
 		}
 	}
 	else
@@ -1528,6 +1663,25 @@ void Conductor::setPath(const QPainterPath &path)
 
 	prepareGeometryChange();
 	m_path = path;
+
+		//Rebuild the geometry used by the hit tests,
+		//the shapes are built again only when asked
+	m_path_lines.clear();
+	for (const auto &polygon : m_path.toSubpathPolygons())
+	{
+		for (int i = 1 ; i < polygon.size() ; ++i) {
+			m_path_lines << QLineF(polygon.at(i-1), polygon.at(i));
+		}
+	}
+	m_shape = QPainterPath();
+	m_hovered_shape = QPainterPath();
+	m_near_shape = QPainterPath();
+	invalidateJunctions();
+
+		//The margin contain the widest shape (hovered) with its miter join
+	const qreal margin = HOVERED_SHAPE_WIDTH + 10;
+	m_bounding_rect = m_path.boundingRect().adjusted(-margin, -margin, margin, margin);
+
 	update();
 }
 
@@ -1820,9 +1974,49 @@ bool isContained(const QPointF &a, const QPointF &b, const QPointF &c) {
 }
 
 /**
+	@brief Conductor::junctions
+	The junctions are computed at the first call
+	and kept until invalidateJunctions() is called.
 	@return la liste des positions des jonctions avec d'autres conducteurs
 */
 QList<QPointF> Conductor::junctions() const
+{
+	if (!m_junctions_valid)
+	{
+		m_junctions = computeJunctions();
+		m_junctions_valid = true;
+	}
+	return(m_junctions);
+}
+
+/**
+	@brief Conductor::invalidateJunctions
+	Invalidate the junctions of this conductor and of the conductors
+	which share its terminals, because the junctions of a conductor
+	depend on the path of these conductors.
+	Called when the path or the position of this conductor change,
+	and when a conductor is added or removed from a terminal.
+*/
+void Conductor::invalidateJunctions()
+{
+	m_junctions_valid = false;
+	if (!terminal1 || !terminal2) {
+		return;
+	}
+		//Nothing will be drawn anymore
+	if (diagram() && diagram()->isTearingDown()) {
+		return;
+	}
+	for (const auto &conductor : relatedConductors(this)) {
+		conductor->m_junctions_valid = false;
+	}
+}
+
+/**
+	@brief Conductor::computeJunctions
+	@return the position of the junctions with the other conductors
+*/
+QList<QPointF> Conductor::computeJunctions() const
 {
 	QList<QPointF> junctions_list;
 
@@ -2001,75 +2195,6 @@ void Conductor::deleteSegments()
 	}
 }
 
-/**
- * @brief Conductor::movePointIntoPolygon
- * @param point : A point located outside the polygon
- * @param polygon : The polygon in which we want to move the point
- * @return the position of the point, once brought back into the polygon,
- * or more exactly on the edge of the polygon
- */
-QPointF Conductor::movePointIntoPolygon(const QPointF &point, const QPainterPath &polygon)
-{
-		// decomposes the polygon into lines and points
-	const QList<QPolygonF> polygons = polygon.simplified().toSubpathPolygons();
-	QList<QLineF> lines;
-	QList<QPointF> points;
-
-	for (QPolygonF polygon : polygons)
-	{
-		if (polygon.count() <= 1)
-			continue;
-
-			// lines and points are counted
-		for (int i = 1 ; i < polygon.count() ; ++ i) {
-			lines << QLineF(polygon.at(i - 1), polygon.at(i));
-			points << polygon.at(i -1);
-		}
-	}
-
-		// we make orthogonal projections of the point on the different
-		// segments of the polygon, sorting them by increasing length
-	QMap<qreal, QPointF> intersections;
-	for (QLineF line : lines)
-	{
-		QPointF intersection_point;
-		if (QET::orthogonalProjection(point, line, &intersection_point)) {
-			intersections.insert(QLineF(intersection_point, point).length(), intersection_point);
-		}
-	}
-
-	if (intersections.count())
-	{
-			// the shortest length for an orthogonal project is determined
-		QPointF the_point = intersections[intersections.keys().first()];
-		return(the_point);
-	}
-	else
-	{
-			// determines the corner of the polygon closest to the outer point
-		qreal minimum_length = -1;
-		int point_index = -1;
-		for (int i = 0 ; i < points.count() ; ++ i)
-		{
-			qreal length = qAbs(QLineF(points.at(i), point).length());
-			if (minimum_length < 0 || length < minimum_length) {
-				minimum_length = length;
-				point_index    = i;
-			}
-		}
-			// we now know the closest corner of the text
-
-
-		if (point_index == -1 ||
-			point_index+1 > points.size()) {
-			return QPointF(0,0);
-		}
-
-			// no orthogonal projection gave anything, we put the text on one of the corners of the polygon
-		return(points.at(point_index));
-	}
-}
-
 /**
 	@brief longestConductorInPotential
 	@param conductor : a conductor in the potential to search
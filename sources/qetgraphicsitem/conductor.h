@@ -90,7 +90,10 @@ class Conductor : public QGraphicsObject
 				QWidget *) override;
 		QRectF boundingRect() const override;
 		QPainterPath shape() const override;
+		bool contains(const QPointF &point) const override;
 		virtual QPainterPath nearShape() const;
+		bool isNear(const QPointF &point) const;
+		QPointF movePointNear(const QPointF &point) const;
 		qreal length() const;
 		ConductorSegment *middleSegment();
 		QPointF posForText(Qt::Orientations &flag);
@@ -138,6 +141,7 @@ class Conductor : public QGraphicsObject
 		void setSequenceNum(const autonum::sequentialNumbers& sn);
 
 		QList<QPointF> junctions() const;
+		void invalidateJunctions();
 
 	private:
 		void setUpConnectionForFormula(
@@ -211,8 +215,24 @@ class Conductor : public QGraphicsObject
 		static QBrush conductor_brush;
 		static bool pen_and_brush_initialized;
 		QPainterPath m_path;
+			/// Geometry of m_path used by the hit tests, updated by setPath()
+		QVector<QLineF> m_path_lines;
+		QRectF m_bounding_rect;
+		mutable QPainterPath
+		m_shape,
+		m_hovered_shape,
+		m_near_shape;
+		static constexpr qreal SHAPE_WIDTH = 1;
+		static constexpr qreal HOVERED_SHAPE_WIDTH = 5;
+		static constexpr qreal NEAR_SHAPE_WIDTH = 1300;
+			/// Junctions with the related conductors, see junctions()
+		mutable QList<QPointF> m_junctions;
+		mutable bool m_junctions_valid = false;
 	
 	private:
+		bool isNearPath(const QPointF &point, qreal distance) const;
+		QList<QPointF> computeJunctions() const;
+		static QPointF nearestPointOnLine(const QPointF &point, const QLineF &line);
 		void segmentsToPath();
 		void saveProfile(bool = true);
 		void generateConductorPath(const QPointF &, Qet::Orientation, const QPointF &, Qet::Orientation);
@@ -229,7 +249,6 @@ class Conductor : public QGraphicsObject
 		QHash<ConductorSegmentProfile *, qreal> shareOffsetBetweenSegments(const qreal &offset, const QList<ConductorSegmentProfile *> &, const qreal & = 0.01) const;
 		static QPointF extendTerminal(const QPointF &, Qet::Orientation, qreal = 10);
 		static Qt::Corner movementType(const QPointF &, const QPointF &);
-		static QPointF movePointIntoPolygon(const QPointF &, const QPainterPath &);
 };
 
 Conductor * longestConductorInPotential (Conductor *conductor, bool all_diagram = false);
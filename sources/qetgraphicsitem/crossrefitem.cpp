@@ -25,6 +25,7 @@
 #include "element.h"
 #include "elementtextitemgroup.h"
 #include "qgraphicsitemutility.h"
+#include "../utils/qetlevelofdetail.h"
 
 //define the height of the header.
 static int header = 5;
@@ -82,7 +83,8 @@ void CrossRefItem::init()
 	}
 	
 	QETProject *project = m_element->diagram()->project();
-	connect(project, &QETProject::XRefPropertiesChanged, this, &CrossRefItem::updateProperties);
+	m_properties_subscription.subscribe(project->changeBus(), ProjectChangeBus::XRefProperties, QUuid(),
+										this, &CrossRefItem::updateProperties);
 	
 	m_properties = m_element->diagram()->project()->defaultXRefProperties(m_element->kindInformations()["type"].toString());
 	setAcceptHoverEvents(true);
@@ -102,6 +104,7 @@ void CrossRefItem::setUpConnection()
 		disconnect(c);
 	
 	m_update_connection.clear();
+	m_update_subscriptions.clear();
 	QETProject *project = m_element->diagram()->project();
 	bool set=false;
 		
@@ -118,13 +121,6 @@ void CrossRefItem::setUpConnection()
 
 	if(set)
 	{
-		m_update_connection
-				<< connect(project,
-					       &QETProject::projectDiagramsOrderChanged,
-					       this, &CrossRefItem::updateLabel);
-		m_update_connection << connect(project,
-					       &QETProject::diagramRemoved,
-					       this, &CrossRefItem::updateLabel);
 		m_update_connection << connect(m_element,
 					       &Element::linkedElementChanged,
 					       this, &CrossRefItem::linkedChanged);
@@ -134,8 +130,9 @@ void CrossRefItem::setUpConnection()
 		if (diagram_ &&
 			formula_.contains("%F"))
 		{
-			m_update_connection << connect(diagram_ , &Diagram::diagramInformationChanged,
-										   this, &CrossRefItem::updateLabel);
+			m_update_subscriptions.subscribe(project->changeBus(),
+											 ProjectChangeBus::FolioInformation, diagram_->uuid(),
+											 this, &CrossRefItem::updateLabel);
 		}
 		linkedChanged();
 		updateLabel();
@@ -308,8 +305,11 @@ void CrossRefItem::paint(
 		const QStyleOptionGraphicsItem *option,
 		QWidget *widget)
 {
-	Q_UNUSED(option)
-	Q_UNUSED(widget)
+		//The cross ref is drawn with a font of size 5 (see updateLabel),
+		//don't play the drawing when it is unreadable.
+	if (!QetLevelOfDetail::textIsReadable(painter, option, widget, 5.0)) {
+		return;
+	}
 	m_drawing.play(painter);
 }
 
@@ -407,24 +407,25 @@ void CrossRefItem::hoverLeaveEvent(QGraphicsSceneHoverEvent *event)
 */
 void CrossRefItem::linkedChanged()
 {
-	for(const QMetaObject::Connection& c : m_slave_connection)
-		disconnect(c);
+	m_slave_subscriptions.clear();
 
-	m_slave_connection.clear();
-
-	if(!isVisible())
+	if(!isVisible() || !m_element->diagram())
 		return;
 	
+	ProjectChangeBus *bus = m_element->diagram()->project()->changeBus();
+	m_slave_subscriptions.subscribe(bus,
+									ProjectChangeBus::FolioPosition, m_element->diagram()->uuid(),
+									this, &CrossRefItem::updateLabel);
 	for(Element *elmt : m_element->linkedElements())
 	{
-		m_slave_connection << connect(elmt,
-					      &Element::xChanged,
-					      this,
-					      &CrossRefItem::updateLabel);
-		m_slave_connection << connect(elmt,
-					      &Element::yChanged,
-					      this,
-					      &CrossRefItem::updateLabel);
+		m_slave_subscriptions.subscribe(bus,
+										ProjectChangeBus::ElementPosition, elmt->uuid(),
+										this, &CrossRefItem::updateLabel);
+		if (elmt->diagram()) {
+			m_slave_subscriptions.subscribe(bus,
+											ProjectChangeBus::FolioPosition, elmt->diagram()->uuid(),
+											this, &CrossRefItem::updateLabel);
+		}
 	}
 
 	updateLabel();
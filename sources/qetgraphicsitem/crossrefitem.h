@@ -18,6 +18,7 @@
 #ifndef CROSSREFITEM_H
 #define CROSSREFITEM_H
 
+#include "../projectchangebus.h"
 #include "../properties/xrefproperties.h"
 
 #include <QGraphicsObject>
@@ -125,8 +126,11 @@ class CrossRefItem : public QGraphicsObject
 		Element *m_hovered_contact = nullptr;
 		DynamicElementTextItem *m_text = nullptr;
 		ElementTextItemGroup *m_group = nullptr;
-		QList <QMetaObject::Connection> m_slave_connection;
 		QList <QMetaObject::Connection> m_update_connection;
+		ProjectChangeBus::Subscriptions
+		m_properties_subscription,
+		m_slave_subscriptions,
+		m_update_subscriptions;
 };
 
 #endif // CROSSREFITEM_H
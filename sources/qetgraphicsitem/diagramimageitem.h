@@ -54,6 +54,7 @@ class DiagramImageItem : public QetGraphicsItem {
 	virtual QDomElement toXml(QDomDocument &) const;
 	void editProperty() override;
 	void setPixmap(const QPixmap &pixmap);
+	QPixmap pixmap() const {return pixmap_;}
 	QRectF boundingRect() const override;
 	QString name() const override;
 	
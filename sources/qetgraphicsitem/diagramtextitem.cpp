@@ -21,6 +21,7 @@
 #include "../diagramcommands.h"
 #include "../qetapp.h"
 #include "../richtext/richtexteditor_p.h"
+#include "../utils/qetlevelofdetail.h"
 
 /**
 	@brief DiagramTextItem::DiagramTextItem
@@ -244,6 +245,12 @@ bool DiagramTextItem::isHtml() const
 */
 void DiagramTextItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
+		//Don't draw a text too small to be read, except if it is edited
+	if (!hasFocus() &&
+		!QetLevelOfDetail::textIsReadable(painter, option, widget, font())) {
+		return;
+	}
+
 	painter -> setRenderHint(QPainter::Antialiasing, false);
 	QGraphicsTextItem::paint(painter, option, widget);
 
@@ -23,9 +23,11 @@
 #include "../qetgraphicsitem/conductor.h"
 #include "../qetgraphicsitem/terminal.h"
 #include "../qetinformation.h"
+#include "../qetxml.h"
 #include "crossrefitem.h"
 #include "element.h"
 #include "elementtextitemgroup.h"
+#include "../utils/qetlevelofdetail.h"
 
 #include <QDomDocument>
 #include <QDomElement>
@@ -89,15 +91,16 @@ DynamicElementTextItem::DynamicElementTextItem()
 QDomElement DynamicElementTextItem::toXml(QDomDocument &dom_doc) const
 {
 	QDomElement root_element = dom_doc.createElement(xmlTagName());
+	const QString tag_name = xmlTagName();
 	
-	root_element.setAttribute("x", QString::number(pos().x()));
-	root_element.setAttribute("y", QString::number(pos().y()));
-	root_element.setAttribute("rotation", QString::number(QET::correctAngle(rotation())));
+	QETXML::setElidableAttribute(root_element, tag_name, "x", QString::number(pos().x()));
+	QETXML::setElidableAttribute(root_element, tag_name, "y", QString::number(pos().y()));
+	QETXML::setElidableAttribute(root_element, tag_name, "rotation", QString::number(QET::correctAngle(rotation())));
 	root_element.setAttribute("uuid", m_uuid.toString());
-	root_element.setAttribute("frame", m_frame? "true" : "false");
-	root_element.setAttribute("text_width", QString::number(m_text_width));
+	QETXML::setElidableAttribute(root_element, tag_name, "frame", m_frame? "true" : "false");
+	QETXML::setElidableAttribute(root_element, tag_name, "text_width", QString::number(m_text_width));
 	root_element.setAttribute("font", font().toString());
-	root_element.setAttribute("keep_visual_rotation", m_keep_visual_rotation ? "true" : "false");
+	QETXML::setElidableAttribute(root_element, tag_name, "keep_visual_rotation", m_keep_visual_rotation ? "true" : "false");
 	
 	QMetaEnum me = textFromMetaEnum();
 	root_element.setAttribute("text_from", me.valueToKey(m_text_from));
@@ -423,7 +426,7 @@ void DynamicElementTextItem::setInfoName(const QString &info_name)
 		if(old_info_name != info_name)
 		{
 			if(old_info_name == "label") {
-				removeConnectionForReportFormula(m_report_formula);
+				removeConnectionForReportFormula();
 			}
 			if(info_name == "label")
 			{
@@ -481,7 +484,7 @@ void DynamicElementTextItem::setCompositeText(const QString &text)
 			 * in every case I remove connection and set it after ;)
 			 */
 		if(old_composite_text.contains("%{label}"))
-			removeConnectionForReportFormula(m_report_formula);
+			removeConnectionForReportFormula();
 		if(m_composite_text.contains("%{label}"))
 			setConnectionForReportFormula(m_report_formula);
 		
@@ -683,6 +686,20 @@ void DynamicElementTextItem::paint(QPainter *painter, const QStyleOptionGraphics
 	
 	if (m_frame)
 	{
+			//The text is too small to be read, only draw a cheap frame
+		if (!hasFocus() &&
+			!QetLevelOfDetail::textIsReadable(painter, option, widget, font()))
+		{
+			painter->save();
+			QPen pen(color());
+			pen.setCosmetic(true);
+			painter->setPen(pen);
+			painter->setBrush(Qt::NoBrush);
+			painter->drawRect(frameRect());
+			painter->restore();
+			return;
+		}
+
 		painter->save();
 		painter->setFont(QETApp::dynamicTextsItemFont(font().pointSize()));
 		
@@ -732,7 +749,9 @@ QVariant DynamicElementTextItem::itemChange(QGraphicsItem::GraphicsItemChange ch
 			if (m_parent_element.data()->diagram() && m_parent_element.data()->diagram()->project())
 			{
 				m_report_formula = m_parent_element.data()->diagram()->project()->defaultReportProperties();
-				m_report_formula_con = connect(m_parent_element.data()->diagram()->project(), &QETProject::reportPropertiesChanged, this, &DynamicElementTextItem::reportFormulaChanged);
+				m_report_formula_subscription.subscribe(m_parent_element.data()->diagram()->project()->changeBus(),
+														ProjectChangeBus::ReportProperties, QUuid(),
+														this, &DynamicElementTextItem::reportFormulaChanged);
 			}
 			
 				//Add connection to keep up to date the status of the element linked to the parent folio report of this text.
@@ -754,7 +773,9 @@ QVariant DynamicElementTextItem::itemChange(QGraphicsItem::GraphicsItemChange ch
 		{
 			connect(m_parent_element.data(), &Element::linkedElementChanged, this, &DynamicElementTextItem::updateXref);
 			if(m_parent_element.data()->diagram())
-				connect(m_parent_element.data()->diagram()->project(), &QETProject::XRefPropertiesChanged, this, &DynamicElementTextItem::updateXref);
+				m_xref_properties_subscription.subscribe(m_parent_element.data()->diagram()->project()->changeBus(),
+														 ProjectChangeBus::XRefProperties, QUuid(),
+														 this, &DynamicElementTextItem::updateXref);
 			if(!m_parent_element.data()->linkedElements().isEmpty())
 				updateXref();
 		}
@@ -876,13 +897,15 @@ void DynamicElementTextItem::reportChanged()
 		 * If the text are added at load of a .qet file, the text is not yet added to a diagram then the connection is not made.
 		 * We make it now, because when the linked report changed, that mean this text is in a diagram
 		 */
-	if(!m_report_formula_con)
+	if(m_report_formula_subscription.isEmpty())
 	{
 			//Get the report formula, and add connection to keep up to date the formula.
 		if (parentElement()->diagram() && parentElement()->diagram()->project())
 		{
 			m_report_formula = parentElement()->diagram()->project()->defaultReportProperties();
-			m_report_formula_con = connect(parentElement()->diagram()->project(), &QETProject::reportPropertiesChanged, this, &DynamicElementTextItem::reportFormulaChanged);
+			m_report_formula_subscription.subscribe(parentElement()->diagram()->project()->changeBus(),
+													ProjectChangeBus::ReportProperties, QUuid(),
+													this, &DynamicElementTextItem::reportFormulaChanged);
 		}
 	}
 	
@@ -893,7 +916,7 @@ void DynamicElementTextItem::reportChanged()
 		text_have_label = true;
 	
 	if(text_have_label)
-		removeConnectionForReportFormula(m_report_formula);
+		removeConnectionForReportFormula();
 	
 	m_other_report.clear();
 	if(!m_parent_element.data()->linkedElements().isEmpty())
@@ -929,51 +952,29 @@ void DynamicElementTextItem::setConnectionForReportFormula(const QString &formul
 	Element *other_elmt = m_other_report.data();
 	QString string = formula;
 	Diagram *other_diagram = m_other_report.data()->diagram();
+	if (!other_diagram || !other_diagram->project())
+		return;
+	
+	ProjectChangeBus *bus = other_diagram->project()->changeBus();
 	
 		//Because the variable %F is a reference to another text which can contain variables,
 		//we must replace %F by the real text, to check if the real text contains the variable %id
-	if (other_diagram && string.contains("%F"))
+	if (string.contains("%F"))
 	{
 		m_F_str = other_diagram->border_and_titleblock.folio();
 		string.replace("%F", other_diagram->border_and_titleblock.folio());
-		connect(&other_diagram->border_and_titleblock, &BorderTitleBlock::titleBlockFolioChanged, this, &DynamicElementTextItem::updateReportFormulaConnection);
+		m_report_formula_subscriptions.subscribe(bus, ProjectChangeBus::FolioTitleBlock, other_diagram->uuid(), this, &DynamicElementTextItem::updateReportFormulaConnection);
 	}
 	
-	if (other_diagram && (string.contains("%f") || string.contains("%id")))
-	{
-		connect(other_diagram->project(), &QETProject::projectDiagramsOrderChanged, this, &DynamicElementTextItem::updateReportText);
-		connect(other_diagram->project(), &QETProject::diagramRemoved, this, &DynamicElementTextItem::updateReportText);
-	}
-	if (string.contains("%l"))
-		connect(other_elmt, &Element::yChanged, this, &DynamicElementTextItem::updateReportText);
-	if (string.contains("%c"))
-		connect(other_elmt, &Element::xChanged, this, &DynamicElementTextItem::updateReportText);
+	if (string.contains("%f") || string.contains("%id"))
+		m_report_formula_subscriptions.subscribe(bus, ProjectChangeBus::FolioPosition, other_diagram->uuid(), this, &DynamicElementTextItem::updateReportText);
+	if (string.contains("%l") || string.contains("%c"))
+		m_report_formula_subscriptions.subscribe(bus, ProjectChangeBus::ElementPosition, other_elmt->uuid(), this, &DynamicElementTextItem::updateReportText);
 }
 
-void DynamicElementTextItem::removeConnectionForReportFormula(const QString &formula)
+void DynamicElementTextItem::removeConnectionForReportFormula()
 {
-	if(m_other_report.isNull() || formula.isEmpty())
-		return;
-	
-	Element *other_element = m_other_report.data();
-	QString string = formula;
-	Diagram *other_diagram = m_other_report.data()->diagram();
-	
-		//Because the variable %F is a reference to another text which can contain variables,
-		//we must replace %F with the real text, to check if the real text contains the variable %id
-	if (other_diagram && string.contains("%F"))
-	{
-		string.replace("%F", m_F_str);
-		disconnect(&other_diagram->border_and_titleblock, &BorderTitleBlock::titleBlockFolioChanged, this, &DynamicElementTextItem::updateReportFormulaConnection);
-	}
-	
-	if (other_diagram && (string.contains("%f") || string.contains("%id")))
-		disconnect(other_diagram->project(), &QETProject::projectDiagramsOrderChanged, this, &DynamicElementTextItem::updateReportText);
-	if (string.contains("%l"))
-		disconnect(other_element, &Element::yChanged, this, &DynamicElementTextItem::updateReportText);
-	if (string.contains("%c"))
-		disconnect(other_element, &Element::xChanged, this, &DynamicElementTextItem::updateReportText);
-	
+	m_report_formula_subscriptions.clear();
 }
 
 /**
@@ -998,31 +999,27 @@ void DynamicElementTextItem::setupFormulaConnection()
 		if (element->isFreezeLabel())
 			return;
 		
-		if (diagram && formula.contains("%F"))
+		if (!diagram || !diagram->project())
+			return;
+		ProjectChangeBus *bus = diagram->project()->changeBus();
+		
+		if (formula.contains("%F"))
 		{
 			m_F_str = diagram->border_and_titleblock.folio();
 			formula.replace("%F", m_F_str);
-			m_formula_connection << connect(&diagram->border_and_titleblock, &BorderTitleBlock::titleBlockFolioChanged, this, &DynamicElementTextItem::updateLabel);
+			m_formula_subscriptions.subscribe(bus, ProjectChangeBus::FolioTitleBlock, diagram->uuid(), this, &DynamicElementTextItem::updateLabel);
 		}
 		
-		if (diagram && (formula.contains("%f") || formula.contains("%id")))
-		{
-			m_formula_connection << connect(diagram->project(), &QETProject::projectDiagramsOrderChanged, this, &DynamicElementTextItem::updateLabel);
-			m_formula_connection << connect(diagram->project(), &QETProject::diagramRemoved, this, &DynamicElementTextItem::updateLabel);
-		}
-		if (formula.contains("%l"))
-			m_formula_connection << connect(element, &Element::yChanged, this, &DynamicElementTextItem::updateLabel);
-		if (formula.contains("%c"))
-			m_formula_connection << connect(element, &Element::xChanged, this, &DynamicElementTextItem::updateLabel);
-			
+		if (formula.contains("%f") || formula.contains("%id"))
+			m_formula_subscriptions.subscribe(bus, ProjectChangeBus::FolioPosition, diagram->uuid(), this, &DynamicElementTextItem::updateLabel);
+		if (formula.contains("%l") || formula.contains("%c"))
+			m_formula_subscriptions.subscribe(bus, ProjectChangeBus::ElementPosition, element->uuid(), this, &DynamicElementTextItem::updateLabel);
 	}
 }
 
 void DynamicElementTextItem::clearFormulaConnection()
 {
-	for (const QMetaObject::Connection& con : m_formula_connection)
-		disconnect(con);
-	m_formula_connection.clear();
+	m_formula_subscriptions.clear();
 }
 
 void DynamicElementTextItem::updateReportFormulaConnection()
@@ -1030,7 +1027,7 @@ void DynamicElementTextItem::updateReportFormulaConnection()
 	if(!(m_parent_element.data()->linkType() & Element::AllReport))
 		return;
 	
-	removeConnectionForReportFormula(m_report_formula);
+	removeConnectionForReportFormula();
 	setConnectionForReportFormula(m_report_formula);
 	updateReportText();
 }
@@ -1353,13 +1350,14 @@ void DynamicElementTextItem::updateXref()
 					m_slave_Xref_item->setFont(QETApp::diagramTextsFont(5));
 					m_slave_Xref_item->installSceneEventFilter(this);
 					
-					m_update_slave_Xref_connection << connect(m_master_element.data(), &Element::xChanged,                       this, &DynamicElementTextItem::updateXref);
-					m_update_slave_Xref_connection << connect(m_master_element.data(), &Element::yChanged,                       this, &DynamicElementTextItem::updateXref);
-					m_update_slave_Xref_connection << connect(m_master_element.data(), &Element::elementInfoChange,              this, &DynamicElementTextItem::updateXref);
-					m_update_slave_Xref_connection << connect(diagram(), &Diagram::diagramInformationChanged,                    this, &DynamicElementTextItem::updateXref);
-					m_update_slave_Xref_connection << connect(diagram()->project(),    &QETProject::projectDiagramsOrderChanged, this, &DynamicElementTextItem::updateXref);
-					m_update_slave_Xref_connection << connect(diagram()->project(),    &QETProject::diagramRemoved,              this, &DynamicElementTextItem::updateXref);
-					m_update_slave_Xref_connection << connect(diagram()->project(),    &QETProject::XRefPropertiesChanged,       this, &DynamicElementTextItem::updateXref);
+					ProjectChangeBus *bus = diagram()->project()->changeBus();
+					const QUuid master_uuid = m_master_element.data()->uuid();
+					const QUuid master_folio_uuid = m_master_element.data()->diagram()->uuid();
+					m_update_slave_Xref_subscriptions.subscribe(bus, ProjectChangeBus::ElementPosition,    master_uuid,       this, &DynamicElementTextItem::updateXref);
+					m_update_slave_Xref_subscriptions.subscribe(bus, ProjectChangeBus::ElementInformation, master_uuid,       this, &DynamicElementTextItem::updateXref);
+					m_update_slave_Xref_subscriptions.subscribe(bus, ProjectChangeBus::FolioInformation,   diagram()->uuid(), this, &DynamicElementTextItem::updateXref);
+					m_update_slave_Xref_subscriptions.subscribe(bus, ProjectChangeBus::FolioPosition,      master_folio_uuid, this, &DynamicElementTextItem::updateXref);
+					m_update_slave_Xref_subscriptions.subscribe(bus, ProjectChangeBus::XRefProperties,     QUuid(),           this, &DynamicElementTextItem::updateXref);
 				}
 				else
 					m_slave_Xref_item->setPlainText(xref_label);
@@ -1380,7 +1378,7 @@ void DynamicElementTextItem::updateXref()
 	{
 		delete m_slave_Xref_item;
 		m_slave_Xref_item = nullptr;
-		m_update_slave_Xref_connection.clear();
+		m_update_slave_Xref_subscriptions.clear();
 	}
 }
 
@@ -127,7 +127,7 @@ class DynamicElementTextItem : public DiagramTextItem
 		void reportChanged();
 		void reportFormulaChanged();
 		void setConnectionForReportFormula(const QString &formula);
-		void removeConnectionForReportFormula(const QString &formula);
+		void removeConnectionForReportFormula();
 		void setupFormulaConnection();
 		void clearFormulaConnection();
 		void updateReportFormulaConnection();
@@ -156,10 +156,12 @@ class DynamicElementTextItem : public DiagramTextItem
 		m_F_str;
 		DynamicElementTextItem::TextFrom m_text_from = UserText;
 		QUuid m_uuid;
-		QMetaObject::Connection m_report_formula_con;
-		QList<QMetaObject::Connection>
-		m_formula_connection,
-		m_update_slave_Xref_connection;
+		ProjectChangeBus::Subscriptions
+		m_report_formula_subscription,
+		m_report_formula_subscriptions,
+		m_xref_properties_subscription,
+		m_formula_subscriptions,
+		m_update_slave_Xref_subscriptions;
 		QColor m_user_color;
 		bool
 		m_frame = false,
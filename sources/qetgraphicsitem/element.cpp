@@ -24,6 +24,7 @@
 #include "../diagramcontext.h"
 #include "../diagramposition.h"
 #include "../elementprovider.h"
+#include "../factory/elementfactory.h"
 #include "../factory/elementpicturefactory.h"
 #include "../properties/terminaldata.h"
 #include "../qetgraphicsitem/conductor.h"
@@ -36,6 +37,7 @@
 #include "../qetxml.h"
 #include "../qetversion.h"
 #include "qgraphicsitemutility.h"
+#include "../utils/qetlevelofdetail.h"
 
 #include <QDomElement>
 #include <utility>
@@ -82,12 +84,15 @@ class ElementXmlRetroCompatibility
 	@param parent : parent graphics item
 	@param state : state of the instantiation
 	@param link_type
+	@param prototype : if not null, this element is cloned from the prototype
+	instead of being built from the xml of the definition
 */
 Element::Element(
 		const ElementsLocation &location,
 		QGraphicsItem *parent,
 		int *state,
-		kind link_type) :
+		kind link_type,
+		const ElementPrototype *prototype) :
 	QetGraphicsItem(parent),
 	m_link_type (link_type),
 	m_location (location)
@@ -100,8 +105,12 @@ Element::Element(
 			return;
 		}
 	}
-	int elmt_state;
-	buildFromXml(location.xml(), &elmt_state);
+	int elmt_state = 0;
+	if (prototype) {
+		buildFromPrototype(*prototype);
+	} else {
+		buildFromXml(location.xml(), &elmt_state);
+	}
 	if (state) {
 		*state = elmt_state;
 	}
@@ -127,6 +136,14 @@ Element::Element(
 				t->updateConductor();
 		}
 	});
+		//The items which depend on the position of this element
+		//watch it through the change bus of the project
+	connect(this, &Element::xChanged, this, [this]() {
+		publishChange(ProjectChangeBus::ElementPosition);
+	});
+	connect(this, &Element::yChanged, this, [this]() {
+		publishChange(ProjectChangeBus::ElementPosition);
+	});
 }
 
 /**
@@ -210,12 +227,33 @@ void Element::displayHelpLine(bool b)
 void Element::paint(
 		QPainter *painter,
 		const QStyleOptionGraphicsItem *options,
-		QWidget *)
+		QWidget *widget)
 {
 	if (m_must_highlight) {
 		drawHighlight(painter, options);
 	}
 
+	const auto detail_ = QetLevelOfDetail::elementDetail(painter, options, widget);
+
+		//At very low zoom, the picture is unreadable, only draw the outline
+		//of the element.
+	if (detail_ == QetLevelOfDetail::Outline)
+	{
+		painter->save();
+		QPen pen(Qt::darkGray);
+		pen.setCosmetic(true);
+		painter->setPen(pen);
+		painter->setBrush(Qt::NoBrush);
+		painter->setRenderHint(QPainter::Antialiasing, false);
+		painter->drawRect(boundingRect());
+		painter->restore();
+
+		if (isSelected() || m_mouse_over) {
+			QGIUtility::drawBoundingRectSelection(this, painter);
+		}
+		return;
+	}
+
 		//Set default pen and brush to QPainter to avoid a strange bug when
 		//the Qt theme is a "dark" theme.
 		//Some parts of an element are gray or white instead of black.
@@ -226,7 +264,7 @@ void Element::paint(
 	QBrush brush;
 	painter->setPen(pen);
 	painter->setBrush(brush);
-	if (options && options->levelOfDetailFromTransform(painter->worldTransform()) < 0.5)
+	if (detail_ == QetLevelOfDetail::Reduced)
 	{
 		painter->drawPicture(0, 0, m_low_zoom_picture);
 	} else {
@@ -519,6 +557,47 @@ bool Element::buildFromXml(const QDomElement &xml_def_elmt, int *state)
 	}
 }
 
+/**
+	@brief Element::buildFromPrototype
+	Copy the state prepared by @a prototype into this element :
+	size, hotspot, data, pictures, terminals and dynamic texts.
+	The terminals and dynamic texts are new items owned by this element,
+	the dynamic texts get a new uuid.
+	Nothing is read from the definition of the element.
+	@param prototype
+*/
+void Element::buildFromPrototype(const ElementPrototype &prototype)
+{
+	m_state = QET::GIBuildingFromXml;
+
+	const Element *elmt = prototype.element();
+	setSize(elmt->dimensions.width(), elmt->dimensions.height());
+	setHotspot(elmt->hotspot_coord);
+
+	m_data = elmt->m_data;
+	setToolTip(name());
+	m_kind_informations = elmt->m_kind_informations;
+
+		//QPicture is implicitly shared, the pictures aren't copied
+	const_cast<QPicture&>(m_picture) = elmt->m_picture;
+	const_cast<QPicture&>(m_low_zoom_picture) = elmt->m_low_zoom_picture;
+
+		//The terminals of the prototype are already sorted
+	for (const auto &terminal : elmt->m_terminals) {
+		m_terminals << new Terminal(new TerminalData(*terminal->d), this);
+	}
+
+	for (const auto &dom : prototype.dynamicTexts())
+	{
+		DynamicElementTextItem *deti = new DynamicElementTextItem(this);
+		deti->fromXml(dom);
+		deti->m_uuid = QUuid::createUuid();
+		addDynamicTextItem(deti);
+	}
+
+	m_state = QET::GIOK;
+}
+
 /**
 	@brief Element::parseElement
 	Parse the element of the xml description of this element
@@ -868,11 +947,15 @@ QDomElement Element::toXml(
 		// uuid
 	element.setAttribute(QStringLiteral("uuid"), uuid().toString());
 
+		//With the compact serialisation, the attributes equal to
+		//the default value of fromXml are not written, see QETXML::elidedDefaults
+	const QString tag_name = element.tagName();
+
 		// prefix
-	element.setAttribute(QStringLiteral("prefix"), m_prefix);
+	QETXML::setElidableAttribute(element, tag_name, QStringLiteral("prefix"), m_prefix);
 
 		//frozen label
-	element.setAttribute(QStringLiteral("freezeLabel"), m_freeze_label? QStringLiteral("true") : QStringLiteral("false"));
+	QETXML::setElidableAttribute(element, tag_name, QStringLiteral("freezeLabel"), m_freeze_label? QStringLiteral("true") : QStringLiteral("false"));
 
 		// sequential num
 	QDomElement seq = m_autoNum_seq.toXml(document);
@@ -883,7 +966,7 @@ QDomElement Element::toXml(
 	element.setAttribute(QStringLiteral("x"), QString::number(pos().x()));
 	element.setAttribute(QStringLiteral("y"), QString::number(pos().y()));
 	element.setAttribute(QStringLiteral("z"), QString::number(this->zValue()));
-	element.setAttribute(QStringLiteral("orientation"), QString::number(orientation()));
+	QETXML::setElidableAttribute(element, tag_name, QStringLiteral("orientation"), QString::number(orientation()));
 
 	/* get the first id to use for the bounds of this element
 	 * recupere le premier id a utiliser pour les bornes de cet element */
@@ -1264,6 +1347,18 @@ void Element::initLink(QETProject *prj)
 	tmp_uuids_link.clear();
 }
 
+/**
+	@brief Element::detachLinks
+	Forget the linked elements without unlinking them :
+	the linked elements are not informed and nothing is updated.
+	Only used when the whole project is deleted (see Diagram::beginTeardown),
+	the linked elements are deleted too.
+*/
+void Element::detachLinks()
+{
+	connected_elements.clear();
+}
+
 /**
  * @brief Element::linkTypeToString
  * \deprecated use instead ElementData::typeToString
@@ -1293,6 +1388,40 @@ QString Element::linkTypeToString() const
 	}
 }
 
+/**
+	@brief Element::newUuid
+	Create a new uuid for this element.
+	The change bus is keyed by uuid, so the subscriptions made with the
+	previous uuid (by the texts of this element or of the linked elements)
+	are renewed.
+*/
+void Element::newUuid()
+{
+	m_uuid = QUuid::createUuid();
+
+	for (DynamicElementTextItem *deti : dynamicTextItems())
+		deti->setupFormulaConnection();
+	for (ElementTextItemGroup *group : textGroups())
+		for (DynamicElementTextItem *deti : group->texts())
+			deti->setupFormulaConnection();
+	for (Element *elmt : linkedElements())
+		emit elmt->linkedElementChanged();
+}
+
+/**
+	@brief Element::publishChange
+	Publish a change of this element on the change bus of the project
+	@param topic
+*/
+void Element::publishChange(ProjectChangeBus::Topic topic)
+{
+	if (auto d = diagram()) {
+		if (auto project = d->project()) {
+			project->changeBus()->publish(topic, m_uuid);
+		}
+	}
+}
+
 /**
 	@brief Element::setElementInformations
 	Set new information for this element.
@@ -1313,6 +1442,7 @@ void Element::setElementInformations(DiagramContext dc)
 		m_data.m_informations.addValue(QStringLiteral("label"), actual_label); //Update the label if there is a formula
 	}
 	emit elementInfoChange(old_info, m_data.m_informations);
+	publishChange(ProjectChangeBus::ElementInformation);
 }
 
 /**
@@ -1341,6 +1471,7 @@ void Element::setElementData(ElementData data)
 			diagram()->project()->dataBase()->elementInfoChanged(this);
 		}
 		emit elementInfoChange(old_info, m_data.m_informations);
+		publishChange(ProjectChangeBus::ElementInformation);
 	}
 }
 
@@ -1479,6 +1610,7 @@ void Element::setUpFormula(bool code_letter)
 			DiagramContext dc = m_data.m_informations;
 			m_data.m_informations.addValue(QStringLiteral("label"), actualLabel());
 			emit elementInfoChange(dc, m_data.m_informations);
+			publishChange(ProjectChangeBus::ElementInformation);
 		}
 	}
 }
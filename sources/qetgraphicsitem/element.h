@@ -22,6 +22,7 @@
 #include "../NameList/nameslist.h"
 #include "../autoNum/assignvariables.h"
 #include "../diagramcontext.h"
+#include "../projectchangebus.h"
 #include "../qet.h"
 #include "qetgraphicsitem.h"
 #include "../properties/elementdata.h"
@@ -35,6 +36,7 @@ class Terminal;
 class Conductor;
 class DynamicElementTextItem;
 class ElementTextItemGroup;
+class ElementPrototype;
 
 /**
 	This is the base class for electrical elements.
@@ -64,7 +66,8 @@ class Element : public QetGraphicsItem
 		Element(const ElementsLocation &location,
 			QGraphicsItem * = nullptr,
 			int *state = nullptr,
-			Element::kind link_type = Element::Simple);
+			Element::kind link_type = Element::Simple,
+			const ElementPrototype *prototype = nullptr);
 		~Element() override;
 	private:
 		Element(const Element &);
@@ -174,6 +177,7 @@ class Element : public QetGraphicsItem
 		bool isFree() const;
 		virtual void linkToElement(Element *) {}
 		virtual void unlinkAllElements() {}
+		void detachLinks();
 		virtual void unlinkElement(Element *) {}
 		virtual void initLink(QETProject *);
 		QList<Element *> linkedElements ();
@@ -191,7 +195,7 @@ class Element : public QetGraphicsItem
 		 */
 		QString linkTypeToString() const;
 
-		void newUuid() {m_uuid = QUuid::createUuid();} 	//create new uuid for this element
+		void newUuid();
 
 	protected:
 		void drawAxes(QPainter *, const QStyleOptionGraphicsItem *);
@@ -202,11 +206,13 @@ class Element : public QetGraphicsItem
 				QPainter *,
 				const QStyleOptionGraphicsItem *);
 		bool buildFromXml(const QDomElement &, int * = nullptr);
+		void buildFromPrototype(const ElementPrototype &prototype);
 		bool parseElement(const QDomElement &dom);
 		bool parseInput(const QDomElement &dom_element);
 		DynamicElementTextItem *parseDynamicText(
 				const QDomElement &dom_element);
 		Terminal *parseTerminal(const QDomElement &dom_element);
+		void publishChange(ProjectChangeBus::Topic topic);
 
 		//Reimplemented from QGraphicsItem
 	public:
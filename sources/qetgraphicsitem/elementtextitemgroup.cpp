@@ -29,6 +29,7 @@
 
 #include <QGraphicsSceneMouseEvent>
 #include <QPainter>
+#include <QTimer>
 #include <utility>
 
 /**
@@ -81,19 +82,19 @@ void ElementTextItemGroup::addToGroup(QGraphicsItem *item)
 		
 		DynamicElementTextItem *deti = qgraphicsitem_cast<DynamicElementTextItem *>(item);
 		connect(deti, &DynamicElementTextItem::fontChanged,
-			this, &ElementTextItemGroup::updateAlignment);
+			this, &ElementTextItemGroup::requestAlignmentUpdate);
 		connect(deti, &DynamicElementTextItem::textChanged,
-			this, &ElementTextItemGroup::updateAlignment);
+			this, &ElementTextItemGroup::requestAlignmentUpdate);
 		connect(deti, &DynamicElementTextItem::textFromChanged,
-			this, &ElementTextItemGroup::updateAlignment);
+			this, &ElementTextItemGroup::requestAlignmentUpdate);
 		connect(deti, &DynamicElementTextItem::infoNameChanged,
-			this, &ElementTextItemGroup::updateAlignment);
+			this, &ElementTextItemGroup::requestAlignmentUpdate);
 		connect(deti, &DynamicElementTextItem::compositeTextChanged,
-			this, &ElementTextItemGroup::updateAlignment);
+			this, &ElementTextItemGroup::requestAlignmentUpdate);
 		connect(deti, &DynamicElementTextItem::plainTextChanged,
-			this, &ElementTextItemGroup::updateAlignment);
+			this, &ElementTextItemGroup::requestAlignmentUpdate);
 		connect(deti, &DynamicElementTextItem::textWidthChanged,
-			this, &ElementTextItemGroup::updateAlignment);
+			this, &ElementTextItemGroup::requestAlignmentUpdate);
 		
 		connect(deti, &DynamicElementTextItem::textFromChanged,
 			this, &ElementTextItemGroup::updateXref);
@@ -124,19 +125,19 @@ void ElementTextItemGroup::removeFromGroup(QGraphicsItem *item)
 	if(DynamicElementTextItem *deti = qgraphicsitem_cast<DynamicElementTextItem *>(item))
 	{
 		disconnect(deti, &DynamicElementTextItem::fontChanged,
-			   this, &ElementTextItemGroup::updateAlignment);
+			   this, &ElementTextItemGroup::requestAlignmentUpdate);
 		disconnect(deti, &DynamicElementTextItem::textChanged,
-			   this, &ElementTextItemGroup::updateAlignment);
+			   this, &ElementTextItemGroup::requestAlignmentUpdate);
 		disconnect(deti, &DynamicElementTextItem::textFromChanged,
-			   this, &ElementTextItemGroup::updateAlignment);
+			   this, &ElementTextItemGroup::requestAlignmentUpdate);
 		disconnect(deti, &DynamicElementTextItem::infoNameChanged,
-			   this, &ElementTextItemGroup::updateAlignment);
+			   this, &ElementTextItemGroup::requestAlignmentUpdate);
 		disconnect(deti, &DynamicElementTextItem::compositeTextChanged,
-			   this, &ElementTextItemGroup::updateAlignment);
+			   this, &ElementTextItemGroup::requestAlignmentUpdate);
 		disconnect(deti, &DynamicElementTextItem::plainTextChanged,
-			   this, &ElementTextItemGroup::updateAlignment);
+			   this, &ElementTextItemGroup::requestAlignmentUpdate);
 		disconnect(deti, &DynamicElementTextItem::textWidthChanged,
-			   this, &ElementTextItemGroup::updateAlignment);
+			   this, &ElementTextItemGroup::requestAlignmentUpdate);
 		
 		disconnect(deti, &DynamicElementTextItem::textFromChanged,
 			   this, &ElementTextItemGroup::updateXref);
@@ -156,6 +157,7 @@ void ElementTextItemGroup::removeFromGroup(QGraphicsItem *item)
 void ElementTextItemGroup::blockAlignmentUpdate(bool block)
 {
 	m_block_alignment_update = block;
+	m_bounding_rect_valid = false;
 }
 
 /**
@@ -175,6 +177,36 @@ Qt::Alignment ElementTextItemGroup::alignment() const
 	return m_alignment;
 }
 
+/**
+	@brief ElementTextItemGroup::requestAlignmentUpdate
+	Request an update of the alignment of the texts of this group.
+	The update is done once, when the control return to the event loop,
+	whatever the number of requests done before,
+	so a text which change several properties at once,
+	or several texts of this group which change at once,
+	cost only one update.
+*/
+void ElementTextItemGroup::requestAlignmentUpdate()
+{
+	m_bounding_rect_valid = false;
+	if(m_alignment_update_scheduled)
+		return;
+	
+	m_alignment_update_scheduled = true;
+	QTimer::singleShot(0, this, &ElementTextItemGroup::doScheduledAlignmentUpdate);
+}
+
+/**
+	@brief ElementTextItemGroup::doScheduledAlignmentUpdate
+	Do the update requested by requestAlignmentUpdate,
+	if updateAlignment wasn't called in the meantime.
+*/
+void ElementTextItemGroup::doScheduledAlignmentUpdate()
+{
+	if(m_alignment_update_scheduled)
+		updateAlignment();
+}
+
 /**
 	@brief ElementTextItemGroup::setAlignment
 	Update the alignement of the items in this group, according
@@ -183,6 +215,8 @@ Qt::Alignment ElementTextItemGroup::alignment() const
 */
 void ElementTextItemGroup::updateAlignment()
 {
+	m_alignment_update_scheduled = false;
+	m_bounding_rect_valid = false;
 	if(m_block_alignment_update)
 		return;
 	
@@ -213,13 +247,18 @@ void ElementTextItemGroup::updateAlignment()
 	}
 	else if (texts.size() > 1)
 	{
+			//Read the size of each text once,
+			//the bounding rect of a text isn't cached by the text itself.
+		std::sort(texts.begin(), texts.end(), sorting);
+		QVector<QSizeF> sizes;
+		sizes.reserve(texts.size());
 		qreal width = 0;
 		for(QGraphicsItem *item : texts)
-			if(item->boundingRect().width() > width)
-				width = item->boundingRect().width();
-		
-		prepareGeometryChange();
-		std::sort(texts.begin(), texts.end(), sorting);
+		{
+			const QSizeF size = item->boundingRect().size();
+			width = std::max(width, size.width());
+			sizes.append(size);
+		}
 		
 		qreal y_offset = 0;
 		
@@ -227,32 +266,32 @@ void ElementTextItemGroup::updateAlignment()
 		{
 			QPointF ref = texts.first()->pos();
 				
-			for(QGraphicsItem *item : texts)
+			for(int i = 0 ; i < texts.size() ; ++i)
 			{
-				item->setPos(0, ref.y()+y_offset);
-				y_offset+=item->boundingRect().height() + m_vertical_adjustment;
+				texts.at(i)->setPos(0, ref.y()+y_offset);
+				y_offset+=sizes.at(i).height() + m_vertical_adjustment;
 			}
 		}
 		else if(m_alignment == Qt::AlignVCenter)
 		{
 			QPointF ref(width/2,0);
 			
-			for(QGraphicsItem *item : texts)
+			for(int i = 0 ; i < texts.size() ; ++i)
 			{
-				item->setPos(ref.x() - item->boundingRect().width()/2,
+				texts.at(i)->setPos(ref.x() - sizes.at(i).width()/2,
 							 ref.y() + y_offset);
-				y_offset+=item->boundingRect().height() + m_vertical_adjustment;
+				y_offset+=sizes.at(i).height() + m_vertical_adjustment;
 			}	
 		}
 		else if (m_alignment == Qt::AlignRight)
 		{
 			QPointF ref(width,0);
 			
-			for(QGraphicsItem *item : texts)
+			for(int i = 0 ; i < texts.size() ; ++i)
 			{
-				item->setPos(ref.x() - item->boundingRect().width(),
+				texts.at(i)->setPos(ref.x() - sizes.at(i).width(),
 							 ref.y() + y_offset);
-				y_offset+=item->boundingRect().height() + m_vertical_adjustment;
+				y_offset+=sizes.at(i).height() + m_vertical_adjustment;
 			}
 		}
 	}
@@ -561,13 +600,21 @@ QRectF ElementTextItemGroup::boundingRect() const
 	//When add an item in the group, the bounding rect is good, but
 	//if we move an item already in the group, the bounding rect of the group stay unchanged.
 	//We reimplement this function to avoid this behavior.
+	//The rect is kept until the next update of the alignment.
+	if(m_bounding_rect_valid)
+		return m_bounding_rect;
+	
 	QRectF rect;
 	for(QGraphicsItem *qgi : texts())
-	{		
-		QRectF r(qgi->pos(), QSize(qgi->boundingRect().width(),
-					   qgi->boundingRect().height()));
+	{
+		const QRectF br = qgi->boundingRect();
+		QRectF r(qgi->pos(), QSize(br.width(),
+					   br.height()));
 		rect = rect.united(r);
 	}
+	m_bounding_rect = rect;
+	m_bounding_rect_valid = !m_alignment_update_scheduled
+				&& !m_block_alignment_update;
 	return rect;
 }
 
@@ -800,12 +847,11 @@ void ElementTextItemGroup::updateXref()
 						m_slave_Xref_item = new QGraphicsTextItem(xref_label, this);
 						m_slave_Xref_item->setFont(QETApp::diagramTextsFont(5));
 						
-						m_update_slave_Xref_connection << connect(master_elmt, &Element::xChanged,                       this, &ElementTextItemGroup::updateXref);
-						m_update_slave_Xref_connection << connect(master_elmt, &Element::yChanged,                       this, &ElementTextItemGroup::updateXref);
-						m_update_slave_Xref_connection << connect(master_elmt, &Element::elementInfoChange,              this, &ElementTextItemGroup::updateXref);
-						m_update_slave_Xref_connection << connect(project,     &QETProject::projectDiagramsOrderChanged, this, &ElementTextItemGroup::updateXref);
-						m_update_slave_Xref_connection << connect(project,     &QETProject::diagramRemoved,              this, &ElementTextItemGroup::updateXref);
-						m_update_slave_Xref_connection << connect(project,     &QETProject::XRefPropertiesChanged,       this, &ElementTextItemGroup::updateXref);
+						ProjectChangeBus *bus = project->changeBus();
+						m_update_slave_Xref_subscriptions.subscribe(bus, ProjectChangeBus::ElementPosition,    master_elmt->uuid(), this, &ElementTextItemGroup::updateXref);
+						m_update_slave_Xref_subscriptions.subscribe(bus, ProjectChangeBus::ElementInformation, master_elmt->uuid(), this, &ElementTextItemGroup::updateXref);
+						m_update_slave_Xref_subscriptions.subscribe(bus, ProjectChangeBus::FolioPosition,      master_elmt->diagram()->uuid(), this, &ElementTextItemGroup::updateXref);
+						m_update_slave_Xref_subscriptions.subscribe(bus, ProjectChangeBus::XRefProperties,     QUuid(),             this, &ElementTextItemGroup::updateXref);
 					}
 					else
 						m_slave_Xref_item->setPlainText(xref_label);
@@ -829,7 +875,7 @@ void ElementTextItemGroup::updateXref()
 	{
 		delete m_slave_Xref_item;
 		m_slave_Xref_item = nullptr;
-		m_update_slave_Xref_connection.clear();
+		m_update_slave_Xref_subscriptions.clear();
 	}
 }
 
@@ -18,6 +18,8 @@
 #ifndef ELEMENTTEXTITEMGROUP_H
 #define ELEMENTTEXTITEMGROUP_H
 
+#include "../projectchangebus.h"
+
 #include <QGraphicsItemGroup>
 #include <QObject>
 #include <QDomElement>
@@ -65,6 +67,7 @@ class ElementTextItemGroup : public QObject, public  QGraphicsItemGroup
 		void setAlignment(Qt::Alignment alignement);
 		Qt::Alignment alignment() const;
 		void updateAlignment();
+		void requestAlignmentUpdate();
 		int verticalAdjustment() const {return m_vertical_adjustment;}
 		void setVerticalAdjustment(int v);
 		void setName(QString name);
@@ -102,6 +105,7 @@ class ElementTextItemGroup : public QObject, public  QGraphicsItemGroup
 		
 	private:
 		void updateXref();
+		void doScheduledAlignmentUpdate();
 		void adjustSlaveXrefPos();
 		void autoPos();
 
@@ -111,12 +115,15 @@ class ElementTextItemGroup : public QObject, public  QGraphicsItemGroup
 		bool m_first_move = true,
 		m_hold_to_bottom_of_page = false,
 		m_block_alignment_update = false,
-		m_frame = false;
+		m_frame = false,
+		m_alignment_update_scheduled = false;
+		mutable bool m_bounding_rect_valid = false;
+		mutable QRectF m_bounding_rect;
 		QPointF m_initial_position;
 		int m_vertical_adjustment = 0;
 		CrossRefItem *m_Xref_item = nullptr;
 		Element *m_parent_element = nullptr;
-		QList<QMetaObject::Connection> m_update_slave_Xref_connection;
+		ProjectChangeBus::Subscriptions m_update_slave_Xref_subscriptions;
 		QGraphicsTextItem *m_slave_Xref_item = nullptr;
 		QMetaObject::Connection m_XrefChanged_timer,
 		m_linked_changed_timer;
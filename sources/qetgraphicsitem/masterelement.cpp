@@ -29,12 +29,14 @@
 	@param location : location of xml definition
 	@param qgi : parent QGraphicItem
 	@param state : int used to know if the creation of element have error
+	@param prototype : if not null, the element is cloned from this prototype
 */
 MasterElement::MasterElement(
 		const ElementsLocation &location,
 		QGraphicsItem *qgi,
-		int *state) :
-	Element(location, qgi, state, Element::Master)
+		int *state,
+		const ElementPrototype *prototype) :
+	Element(location, qgi, state, Element::Master, prototype)
 {}
 
 /**
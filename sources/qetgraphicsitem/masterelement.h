@@ -36,7 +36,8 @@ class MasterElement : public Element
 		explicit MasterElement(
 			const ElementsLocation &,
 			QGraphicsItem * = nullptr,
-			int * = nullptr);
+			int * = nullptr,
+			const ElementPrototype * = nullptr);
 		~MasterElement() override;
 
 		void linkToElement     (Element *elmt) override;
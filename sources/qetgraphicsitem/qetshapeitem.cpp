@@ -51,8 +51,8 @@ QetShapeItem::QetShapeItem(QPointF p1, QPointF p2, ShapeType type, QGraphicsItem
 		//ensure handlers are always above this item
 	connect(this, &QetShapeItem::zChanged, [this]()
 	{
-		for(QetGraphicsHandlerItem *qghi : m_handler_vector)
-			qghi->setZValue(this->zValue()+1);
+		if (m_handler_layer)
+			m_handler_layer->setZValue(this->zValue()+1);
 	});
 
 	m_insert_point = new QAction(tr("Ajouter un point"), this);
@@ -66,8 +66,7 @@ QetShapeItem::QetShapeItem(QPointF p1, QPointF p2, ShapeType type, QGraphicsItem
 
 QetShapeItem::~QetShapeItem()
 {
-	if(!m_handler_vector.isEmpty())
-		qDeleteAll(m_handler_vector);
+	delete m_handler_layer;
 }
 
 /**
@@ -389,11 +388,8 @@ QVariant QetShapeItem::itemChange(QGraphicsItem::GraphicsItemChange change,
 		}
 		else //Else this is deselected, we remove handlers
 		{
-			if(!m_handler_vector.isEmpty())
-			{
-				qDeleteAll(m_handler_vector);
-				m_handler_vector.clear();
-			}
+			delete m_handler_layer;
+			m_handler_layer = nullptr;
 			m_resize_mode = 1;
 		}
 	}
@@ -419,31 +415,32 @@ QVariant QetShapeItem::itemChange(QGraphicsItem::GraphicsItemChange change,
 */
 bool QetShapeItem::sceneEventFilter(QGraphicsItem *watched, QEvent *event)
 {
-		//Watched must be an handler
-	if(watched->type() == QetGraphicsHandlerItem::Type)
+		//Watched must be the layer of the handlers
+	if(watched == m_handler_layer)
 	{
-		QetGraphicsHandlerItem *qghi = qgraphicsitem_cast<QetGraphicsHandlerItem *>(watched);
-
-		if(m_handler_vector.contains(qghi)) //Handler must be in m_vector_index, then we can start resize
+		if(event->type() == QEvent::GraphicsSceneMousePress) //Click
 		{
-			m_vector_index = m_handler_vector.indexOf(qghi);
+			auto mouse_event = static_cast<QGraphicsSceneMouseEvent *>(event);
+				//The handler used until the release
+			m_vector_index = m_handler_layer->handlerAt(mouse_event->scenePos(), mouse_event->widget());
 			if (m_vector_index != -1)
 			{
-				if(event->type() == QEvent::GraphicsSceneMousePress) //Click
-				{
-					handlerMousePressEvent();
-					return true;
-				}
-				else if(event->type() == QEvent::GraphicsSceneMouseMove) //Move
-				{
-					handlerMouseMoveEvent(static_cast<QGraphicsSceneMouseEvent *>(event));
-					return true;
-				}
-				else if (event->type() == QEvent::GraphicsSceneMouseRelease) //Release
-				{
-					handlerMouseReleaseEvent();
-					return true;
-				}
+				handlerMousePressEvent();
+				return true;
+			}
+		}
+		else if (m_vector_index != -1)
+		{
+			if(event->type() == QEvent::GraphicsSceneMouseMove) //Move
+			{
+				handlerMouseMoveEvent(static_cast<QGraphicsSceneMouseEvent *>(event));
+				return true;
+			}
+			else if (event->type() == QEvent::GraphicsSceneMouseRelease) //Release
+			{
+				handlerMouseReleaseEvent();
+				m_vector_index = -1;
+				return true;
 			}
 		}
 	}
@@ -485,16 +482,11 @@ void QetShapeItem::contextMenuEvent(QGraphicsSceneContextMenuEvent *event)
 					QScopedPointer<QMenu> menu(new QMenu());
 					menu.data()->addAction(m_insert_point);
 
-					if (m_handler_vector.count() > 2)
+					if (m_handler_layer &&
+						m_handler_layer->count() > 2 &&
+						m_handler_layer->handlerAt(event->scenePos(), event->widget()) != -1)
 					{
-						for (QetGraphicsHandlerItem *qghi : m_handler_vector)
-						{
-							if (qghi->contains(qghi->mapFromScene(event->scenePos())))
-							{
-								menu.data()->addAction(m_remove_point);
-								break;
-							}
-						}
+						menu.data()->addAction(m_remove_point);
 					}
 
 					menu.data()->addSeparator();
@@ -520,15 +512,15 @@ void QetShapeItem::switchResizeMode()
 		if (m_resize_mode == 1)
 		{
 			m_resize_mode = 2;
-			for (QetGraphicsHandlerItem *qghi : m_handler_vector) {
-				qghi->setColor(Qt::darkGreen);
+			if (m_handler_layer) {
+				m_handler_layer->setColor(Qt::darkGreen);
 			}
 		}
 		else
 		{
 			m_resize_mode = 1;
-			for (QetGraphicsHandlerItem *qghi : m_handler_vector) {
-				qghi->setColor(Qt::blue);
+			if (m_handler_layer) {
+				m_handler_layer->setColor(Qt::blue);
 			}
 		}
 	}
@@ -537,27 +529,23 @@ void QetShapeItem::switchResizeMode()
 		if (m_resize_mode == 1)
 		{
 			m_resize_mode = 2;
-			for (QetGraphicsHandlerItem *qghi : m_handler_vector)
-				qghi->setColor(Qt::darkGreen);
+			if (m_handler_layer)
+				m_handler_layer->setColor(Qt::darkGreen);
 		}
 		else if (m_resize_mode == 2)
 		{
 			m_resize_mode = 3;
-			qDeleteAll(m_handler_vector);
-			m_handler_vector.clear();
-			addHandler();
-			for (QetGraphicsHandlerItem *qghi : m_handler_vector) {
-				qghi->setColor(Qt::magenta);
+			adjustHandlerPos();
+			if (m_handler_layer) {
+				m_handler_layer->setColor(Qt::magenta);
 			}
 		}
 		else if (m_resize_mode == 3)
 		{
 			m_resize_mode = 1;
-			qDeleteAll(m_handler_vector);
-			m_handler_vector.clear();
-			addHandler();
-			for (QetGraphicsHandlerItem *qghi : m_handler_vector) {
-				qghi->setColor(Qt::blue);
+			adjustHandlerPos();
+			if (m_handler_layer) {
+				m_handler_layer->setColor(Qt::blue);
 			}
 
 		}
@@ -566,52 +554,24 @@ void QetShapeItem::switchResizeMode()
 
 void QetShapeItem::addHandler()
 {
-	if (m_handler_vector.isEmpty())
+	if (!m_handler_layer && scene())
 	{
-		QVector <QPointF> points_vector;
-		switch (m_shapeType)
-		{
-			case Line:
-				points_vector << m_P1 << m_P2;
-				break;
-			case Rectangle:
-				if (m_resize_mode == 3) {
-					points_vector = QetGraphicsHandlerUtility::pointForRadiusRect(QRectF(m_P1, m_P2), m_xRadius, m_yRadius);
-				}
-				else {
-					points_vector = QetGraphicsHandlerUtility::pointsForRect(QRectF(m_P1, m_P2));
-				}
-				break;
-			case Ellipse:
-				points_vector = QetGraphicsHandlerUtility::pointsForRect(QRectF(m_P1, m_P2));
-				break;
-			case Polygon:
-				points_vector = m_polygon;
-				break;
-		}
-
-		if(!points_vector.isEmpty() && scene())
-		{
-			m_handler_vector = QetGraphicsHandlerItem::handlerForPoint(mapToScene(points_vector), QETUtils::graphicsHandlerSize(this));
-
-			for(const auto handler : qAsConst(m_handler_vector))
-			{
-				handler->setZValue(this->zValue()+1);
-				handler->setColor(Qt::blue);
-				scene()->addItem(handler);
-				handler->installSceneEventFilter(this);
-			}
-		}
+		m_handler_layer = new QetGraphicsHandlerLayer(QETUtils::graphicsHandlerSize(this));
+		m_handler_layer->setZValue(this->zValue()+1);
+		m_handler_layer->setColor(Qt::blue);
+		scene()->addItem(m_handler_layer);
+		m_handler_layer->installSceneEventFilter(this);
+		adjustHandlerPos();
 	}
 }
 
 /**
 	@brief QetShapeItem::adjustHandlerPos
-	Adjust the position of the handler item
+	Adjust the position of the handlers
 */
 void QetShapeItem::adjustHandlerPos()
 {
-	if (m_handler_vector.isEmpty()) {
+	if (!m_handler_layer) {
 		return;
 	}
 
@@ -641,18 +601,7 @@ void QetShapeItem::adjustHandlerPos()
 		}
 	}
 
-	if (m_handler_vector.size() == points_vector.size())
-	{
-		points_vector = mapToScene(points_vector);
-		for (int i = 0 ; i < points_vector.size() ; ++i)
-			m_handler_vector.at(i)->setPos(points_vector.at(i));
-	}
-	else
-	{
-		qDeleteAll(m_handler_vector);
-		m_handler_vector.clear();
-		addHandler();
-	}
+	m_handler_layer->setPoints(mapToScene(points_vector));
 }
 
 void QetShapeItem::insertPoint()
@@ -677,22 +626,12 @@ void QetShapeItem::removePoint()
 		return;
 	}
 
-	if (m_handler_vector.size() == 2) {
+	if (!m_handler_layer || m_handler_layer->count() == 2) {
 		return;
 	}
 
-	QPointF point = mapToScene(m_context_menu_pos);
-	int index = -1;
-	for (int i=0 ; i<m_handler_vector.size() ; i++)
-	{
-		QetGraphicsHandlerItem *qghi = m_handler_vector.at(i);
-		if (qghi->contains(qghi->mapFromScene(point)))
-		{
-			index = i;
-			break;
-		}
-	}
-	if (index > -1 && index<m_handler_vector.count())
+	const int index = m_handler_layer->handlerAt(mapToScene(m_context_menu_pos));
+	if (index > -1 && index<m_handler_layer->count())
 	{
 		QPolygonF polygon = this->polygon();
 		polygon.removeAt(index);
@@ -777,7 +716,10 @@ void QetShapeItem::handlerMouseMoveEvent(QGraphicsSceneMouseEvent *event)
 		case Polygon:
 			prepareGeometryChange();
 			m_polygon.replace(m_vector_index, new_pos);
-			adjustHandlerPos();
+				//Only the dragged handler moved
+			if (m_handler_layer) {
+				m_handler_layer->setPoint(m_vector_index, mapToScene(new_pos));
+			}
 			break;
 	}	//End switch
 }
@@ -18,14 +18,13 @@
 #ifndef QETSHAPEITEM_H
 #define QETSHAPEITEM_H
 
-#include "../QetGraphicsItemModeler/qetgraphicshandleritem.h"
+#include "../QetGraphicsItemModeler/qetgraphicshandlerlayer.h"
 #include "qetgraphicsitem.h"
 
 #include <QPen>
 
 class QDomElement;
 class QDomDocument;
-class QetGraphicsHandlerItem;
 class QAction;
 
 /**
@@ -150,11 +149,11 @@ class QetShapeItem : public QetGraphicsItem
 				 m_context_menu_pos;
 		QPolygonF	 m_polygon, m_old_polygon;
 		bool		 m_hovered;
-		int		 m_vector_index;
+		int		 m_vector_index = -1;
 		bool		 m_closed = false,
 				 m_modifie_radius_equaly = false;
 		int		 m_resize_mode = 1;
-		QVector<QetGraphicsHandlerItem *> m_handler_vector;
+		QetGraphicsHandlerLayer *m_handler_layer = nullptr;
 		QAction		 *m_insert_point,
 				 *m_remove_point;
 		qreal		 m_xRadius = 0,
@@ -24,9 +24,10 @@
 #include "../qetproject.h"
 #include "dynamicelementtextitem.h"
 
-ReportElement::ReportElement(const ElementsLocation &location, const QString& link_type,QGraphicsItem *qgi, int *state) :
+ReportElement::ReportElement(const ElementsLocation &location, const QString& link_type,QGraphicsItem *qgi, int *state, const ElementPrototype *prototype) :
 	Element(location, qgi, state,
-			link_type == "next_report"? Element::NextReport : Element::PreviousReport),
+			link_type == "next_report"? Element::NextReport : Element::PreviousReport,
+			prototype),
 	m_inverse_report(link_type == "next_report"? Element::PreviousReport : Element::NextReport)
 {}
 
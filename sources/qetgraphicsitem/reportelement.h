@@ -34,7 +34,8 @@ class ReportElement : public Element
 			const ElementsLocation &,
 			const QString& link_type,
 			QGraphicsItem * = nullptr,
-			int * = nullptr);
+			int * = nullptr,
+			const ElementPrototype * = nullptr);
 		~ReportElement() override;
 		void linkToElement(Element *) override;
 		void unlinkAllElements() override;
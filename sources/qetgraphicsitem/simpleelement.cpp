@@ -24,12 +24,14 @@
 	@param location
 	@param qgi
 	@param state
+	@param prototype
 */
 SimpleElement::SimpleElement(
 		const ElementsLocation &location,
 		QGraphicsItem *qgi,
-		int *state) :
-	Element(location, qgi, state, Element::Simple)
+		int *state,
+		const ElementPrototype *prototype) :
+	Element(location, qgi, state, Element::Simple, prototype)
 {}
 
 /**
@@ -34,7 +34,8 @@ class SimpleElement : public Element {
 		explicit SimpleElement(
 			const ElementsLocation &,
 			QGraphicsItem * = nullptr,
-			int * = nullptr);
+			int * = nullptr,
+			const ElementPrototype * = nullptr);
 		~SimpleElement() override;
 
 		void initLink(QETProject *project) override;
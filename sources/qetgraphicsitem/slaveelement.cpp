@@ -26,11 +26,13 @@
 	@param location location of xml definition
 	@param qgi parent QGraphicItem
 	@param state int used to know if the creation of element have error
+	@param prototype if not null, the element is cloned from this prototype
 */
 SlaveElement::SlaveElement(const ElementsLocation &location,
 			   QGraphicsItem *qgi,
-			   int *state) :
-	Element(location, qgi, state, Element::Slave)
+			   int *state,
+			   const ElementPrototype *prototype) :
+	Element(location, qgi, state, Element::Slave, prototype)
 {}
 
 /**
@@ -27,7 +27,8 @@ class SlaveElement : public Element
 		explicit SlaveElement (
 			const ElementsLocation &,
 			QGraphicsItem * = nullptr,
-			int * = nullptr);
+			int * = nullptr,
+			const ElementPrototype * = nullptr);
 		~SlaveElement() override;
 		void linkToElement(Element *elmt) override;
 		void unlinkAllElements() override;
@@ -24,6 +24,7 @@
 #include "../qetgraphicsitem/conductor.h"
 #include "../qetgraphicsitem/element.h"
 #include "conductortextitem.h"
+#include "../utils/qetlevelofdetail.h"
 
 #include <utility>
 
@@ -143,6 +144,7 @@ bool Terminal::addConductor(Conductor *conductor)
 			return false; //They already a conductor linked to this and other_terminal
 
 	m_conductors_list.append(conductor);
+	conductor->invalidateJunctions();
 	emit conductorWasAdded(conductor);
 	return(true);
 }
@@ -156,6 +158,7 @@ void Terminal::removeConductor(Conductor *conductor)
 {
 	int index = m_conductors_list.indexOf(conductor);
 	if (index == -1) return;
+	conductor->invalidateJunctions();
 	m_conductors_list.removeAt(index);
 	emit conductorWasRemoved(conductor);
 }
@@ -173,7 +176,8 @@ void Terminal::paint(
 {
 	// en dessous d'un certain zoom, les bornes ne sont plus dessinees
 	// below a certain zoom level, the terminals are no longer drawn
-	if (options && options->levelOfDetailFromTransform(painter->worldTransform()) < 0.5)
+	const auto detail_ = QetLevelOfDetail::terminalDetail(painter, options);
+	if (detail_ == QetLevelOfDetail::Hidden)
 		return;
 	painter -> save();
 
@@ -191,7 +195,7 @@ void Terminal::paint(
 	QPen t;
 	t.setWidthF(1.0);
 
-	if (options && options->levelOfDetailFromTransform(painter->worldTransform()) < 1.0)
+	if (detail_ == QetLevelOfDetail::Reduced)
 	{
 		t.setCosmetic(true);
 	}
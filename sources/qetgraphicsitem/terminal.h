@@ -34,6 +34,8 @@ class TerminalData;
 */
 class Terminal : public QGraphicsObject
 {
+	friend class Element;
+
 	Q_OBJECT
 
 	signals:
@@ -24,10 +24,12 @@
 	@param location location of xml definition
 	@param qgi parent QGraphicItem
 	@param state int used to know if the creation of element have error
+	@param prototype if not null, the element is cloned from this prototype
 */
 TerminalElement::TerminalElement(const ElementsLocation &location,
-				 QGraphicsItem *qgi, int *state) :
-	Element(location, qgi, state, Element::Terminale)
+				 QGraphicsItem *qgi, int *state,
+				 const ElementPrototype *prototype) :
+	Element(location, qgi, state, Element::Terminale, prototype)
 {
 	auto rt = new RealTerminal(this);
 	m_real_terminal = rt->sharedRef();
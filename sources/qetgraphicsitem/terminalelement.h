@@ -32,7 +32,8 @@ class TerminalElement : public Element
 		Q_OBJECT
 	public:
 		TerminalElement(const ElementsLocation &,
-				QGraphicsItem * = nullptr, int * = nullptr);
+				QGraphicsItem * = nullptr, int * = nullptr,
+				const ElementPrototype * = nullptr);
 		~TerminalElement() override;
 		void initLink(QETProject *project) override;
 
@@ -0,0 +1,358 @@
+/*
+	Copyright 2006-2026 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech. If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "qetmemoryaccounting.h"
+
+#include "ElementsCollection/elementscollectionmodel.h"
+#include "ElementsCollection/elementssearchindex.h"
+#include "ElementsCollection/xmlelementcollection.h"
+#include "dataBase/projectdatabase.h"
+#include "diagram.h"
+#include "factory/elementfactory.h"
+#include "factory/elementpicturefactory.h"
+#include "qetgraphicsitem/conductor.h"
+#include "qetgraphicsitem/diagramimageitem.h"
+#include "qetgraphicsitem/element.h"
+#include "qetgraphicsitem/terminal.h"
+#include "qetproject.h"
+
+#include <QFile>
+#include <QGraphicsTextItem>
+#include <QJsonArray>
+#include <QTextDocument>
+#include <QTextStream>
+#include <QUndoStack>
+
+#ifdef Q_OS_LINUX
+#include <unistd.h>
+#endif
+
+namespace QetMemoryAccounting
+{
+	namespace
+	{
+			///Approximate size of the private data of a QGraphicsItem
+			///(QGraphicsItemPrivate and the entry in the index of the scene)
+		const qint64 GRAPHICS_ITEM_OVERHEAD = 400;
+			///Approximate size of a QTextDocument without text
+			///(private data, layout, format collection)
+		const qint64 TEXT_DOCUMENT_OVERHEAD = 4096;
+			///Approximate ratio between the size of a QDomDocument in memory
+			///and the size of its text
+		const qint64 DOM_RATIO = 4;
+
+		Counter makeCounter(const QString &id, const QString &name,
+							qint64 count, qint64 bytes)
+		{
+			Counter counter;
+			counter.id = id;
+			counter.name = name;
+			counter.count = count;
+			counter.bytes = bytes;
+			return counter;
+		}
+
+			///Estimated size of @a item, without its children
+		qint64 itemBytes(QGraphicsItem *item)
+		{
+			switch (item->type())
+			{
+				case Element::Type:
+					return sizeof(Element) + GRAPHICS_ITEM_OVERHEAD;
+				case Terminal::Type:
+					return sizeof(Terminal) + GRAPHICS_ITEM_OVERHEAD;
+				case Conductor::Type:
+					return sizeof(Conductor) + GRAPHICS_ITEM_OVERHEAD
+							+ static_cast<Conductor *>(item)->path().elementCount()
+							* sizeof(QPainterPath::Element);
+				case DiagramImageItem::Type: {
+					const auto pixmap = static_cast<DiagramImageItem *>(item)->pixmap();
+					return sizeof(DiagramImageItem) + GRAPHICS_ITEM_OVERHEAD
+							+ qint64(pixmap.width()) * pixmap.height() * pixmap.depth() / 8;
+				}
+				default:
+					if (auto text = qobject_cast<QGraphicsTextItem *>(item->toGraphicsObject()))
+					{
+						return sizeof(QGraphicsTextItem) + GRAPHICS_ITEM_OVERHEAD
+								+ TEXT_DOCUMENT_OVERHEAD
+								+ text->document()->characterCount() * sizeof(QChar);
+					}
+					return sizeof(QGraphicsObject) + GRAPHICS_ITEM_OVERHEAD;
+			}
+		}
+
+			///Estimated size of @a item and of all its children
+		qint64 itemTreeBytes(QGraphicsItem *item)
+		{
+			qint64 bytes = itemBytes(item);
+			for (const auto &child : item->childItems()) {
+				bytes += itemTreeBytes(child);
+			}
+			return bytes;
+		}
+
+		QJsonArray countersToJson(const QVector<Counter> &counters)
+		{
+			QJsonArray array;
+			for (const auto &counter : counters)
+			{
+				QJsonObject object;
+				object.insert(QStringLiteral("id"), counter.id);
+				object.insert(QStringLiteral("count"), counter.count);
+				object.insert(QStringLiteral("bytes"), counter.bytes < 0 ? QJsonValue()
+																		 : QJsonValue(counter.bytes));
+				array.append(object);
+			}
+			return array;
+		}
+	}
+
+	/**
+		@brief projectCounters
+		@param project
+		@return the counters of @a project :
+		items of the folios, text documents, images, undo stack,
+		embedded collection and database.
+	*/
+	QVector<Counter> projectCounters(QETProject *project)
+	{
+		QVector<Counter> counters;
+		if (!project) {
+			return counters;
+		}
+
+		qint64 elements = 0, elements_bytes = 0;
+		qint64 terminals = 0, terminals_bytes = 0;
+		qint64 conductors = 0, conductors_bytes = 0;
+		qint64 texts = 0, texts_bytes = 0;
+		qint64 images = 0, images_bytes = 0;
+		qint64 others = 0, others_bytes = 0;
+
+		const auto diagrams = project->diagrams();
+		for (const auto &diagram : diagrams)
+		{
+			for (const auto &item : diagram->items())
+			{
+				const qint64 bytes = itemBytes(item);
+				switch (item->type())
+				{
+					case Element::Type:
+						++elements;
+						elements_bytes += bytes;
+						break;
+					case Terminal::Type:
+						++terminals;
+						terminals_bytes += bytes;
+						break;
+					case Conductor::Type:
+						++conductors;
+						conductors_bytes += bytes;
+						break;
+					case DiagramImageItem::Type:
+						++images;
+						images_bytes += bytes;
+						break;
+					default:
+						if (qobject_cast<QGraphicsTextItem *>(item->toGraphicsObject()))
+						{
+							++texts;
+							texts_bytes += bytes;
+						}
+						else
+						{
+							++others;
+							others_bytes += bytes;
+						}
+						break;
+				}
+			}
+		}
+
+		counters << makeCounter(QStringLiteral("folios.count"), QObject::tr("Folios"),
+								diagrams.size(), -1);
+		counters << makeCounter(QStringLiteral("folios.elements"), QObject::tr("Éléments"),
+								elements, elements_bytes);
+		counters << makeCounter(QStringLiteral("folios.terminals"), QObject::tr("Bornes"),
+								terminals, terminals_bytes);
+		counters << makeCounter(QStringLiteral("folios.conductors"), QObject::tr("Conducteurs"),
+								conductors, conductors_bytes);
+		counters << makeCounter(QStringLiteral("folios.text_documents"), QObject::tr("Documents des textes"),
+								texts, texts_bytes);
+		counters << makeCounter(QStringLiteral("folios.images"), QObject::tr("Images"),
+								images, images_bytes);
+		counters << makeCounter(QStringLiteral("folios.other_items"), QObject::tr("Autres items"),
+								others, others_bytes);
+
+			//The size of the commands can't be known, some of them
+			//own the items removed from the folios.
+		if (auto stack = project->undoStack()) {
+			counters << makeCounter(QStringLiteral("undo.commands"), QObject::tr("Commandes d'annulation"),
+									stack->count(), -1);
+		}
+		counters << makeCounter(QStringLiteral("change_bus.subscriptions"), QObject::tr("Abonnements aux changements"),
+								project->changeBus()->subscriptionsCount(), -1);
+
+		if (auto collection = project->embeddedElementCollection())
+		{
+			const auto root = collection->root();
+			counters << makeCounter(QStringLiteral("collection.dom"), QObject::tr("Collection embarquée (DOM)"),
+									root.elementsByTagName(QStringLiteral("element")).count(),
+									root.ownerDocument().toByteArray(0).size() * DOM_RATIO);
+		}
+
+		if (auto data_base = project->dataBase())
+		{
+			auto page_count = data_base->newQuery(QStringLiteral("PRAGMA page_count"));
+			auto page_size  = data_base->newQuery(QStringLiteral("PRAGMA page_size"));
+			if (page_count.exec() && page_count.next()
+				&& page_size.exec() && page_size.next())
+			{
+				counters << makeCounter(QStringLiteral("database.pages"), QObject::tr("Base de données du projet"),
+										page_count.value(0).toLongLong(),
+										page_count.value(0).toLongLong() * page_size.value(0).toLongLong());
+			}
+		}
+
+		return counters;
+	}
+
+	/**
+		@brief sharedCounters
+		@return the counters of the caches shared by every projects
+	*/
+	QVector<Counter> sharedCounters()
+	{
+		QVector<Counter> counters;
+
+		const auto stats = ElementPictureFactory::instance()->cacheStatistics();
+		counters << makeCounter(QStringLiteral("picture_factory.pictures"), QObject::tr("Dessins des éléments"),
+								stats.pictures, stats.pictures_bytes);
+		counters << makeCounter(QStringLiteral("picture_factory.low_pictures"), QObject::tr("Dessins des éléments (faible zoom)"),
+								stats.low_pictures, stats.low_pictures_bytes);
+		counters << makeCounter(QStringLiteral("picture_factory.pixmaps"), QObject::tr("Vignettes des éléments"),
+								stats.pixmaps, stats.pixmaps_bytes);
+		counters << makeCounter(QStringLiteral("picture_factory.primitives"), QObject::tr("Primitives des éléments"),
+								stats.primitives, stats.primitives_bytes);
+			//A prototype is a complete element, not added to a folio,
+			//with the xml of its dynamic texts
+		const auto prototypes = ElementFactory::Instance()->prototypes();
+		qint64 prototypes_bytes = 0;
+		for (const auto &prototype : prototypes)
+		{
+			prototypes_bytes += itemTreeBytes(const_cast<Element *>(prototype->element()));
+			for (const auto &xml : prototype->dynamicTexts())
+			{
+				QString text;
+				QTextStream stream(&text);
+				xml.save(stream, 0);
+				prototypes_bytes += text.size() * sizeof(QChar) * DOM_RATIO;
+			}
+		}
+		counters << makeCounter(QStringLiteral("element_factory.prototypes"), QObject::tr("Prototypes des éléments"),
+								prototypes.size(), prototypes_bytes);
+
+		const auto locations = ElementsLocation::cacheStatistics();
+		counters << makeCounter(QStringLiteral("elements_location.locations"), QObject::tr("Emplacements des éléments"),
+								locations.locations, locations.locations_bytes);
+		counters << makeCounter(QStringLiteral("elements_location.resolved_paths"), QObject::tr("Chemins résolus des éléments"),
+								locations.resolved_paths, locations.resolved_paths_bytes);
+
+		qint64 indexed = 0, index_bytes = 0;
+		for (const auto &index : ElementsCollectionModel::searchIndexes())
+		{
+			indexed += index->count();
+			index_bytes += index->bytes();
+		}
+		counters << makeCounter(QStringLiteral("search_index.elements"), QObject::tr("Index de recherche des éléments"),
+								indexed, index_bytes);
+
+		return counters;
+	}
+
+	/**
+		@brief totalBytes
+		@param counters
+		@return the sum of the sizes of @a counters,
+		the counters without size are ignored.
+	*/
+	qint64 totalBytes(const QVector<Counter> &counters)
+	{
+		qint64 total = 0;
+		for (const auto &counter : counters) {
+			if (counter.bytes > 0) {
+				total += counter.bytes;
+			}
+		}
+		return total;
+	}
+
+	/**
+		@brief residentBytes
+		@return the resident memory of the process as reported by the system,
+		or -1 if it can't be known on this system.
+	*/
+	qint64 residentBytes()
+	{
+#ifdef Q_OS_LINUX
+		QFile statm(QStringLiteral("/proc/self/statm"));
+		if (statm.open(QIODevice::ReadOnly))
+		{
+			const auto fields = statm.readAll().split(' ');
+			if (fields.size() > 1) {
+				return fields.at(1).toLongLong() * sysconf(_SC_PAGESIZE);
+			}
+		}
+#endif
+		return -1;
+	}
+
+	/**
+		@brief toJson
+		@param projects
+		@return a machine readable report of the memory used by @a projects
+		and by the shared caches.
+	*/
+	QJsonObject toJson(const QList<QETProject *> &projects)
+	{
+		QJsonObject report;
+
+		const auto resident = residentBytes();
+		report.insert(QStringLiteral("resident_bytes"), resident < 0 ? QJsonValue()
+																	 : QJsonValue(resident));
+
+		const auto shared = sharedCounters();
+		QJsonObject shared_object;
+		shared_object.insert(QStringLiteral("total_bytes"), totalBytes(shared));
+		shared_object.insert(QStringLiteral("counters"), countersToJson(shared));
+		report.insert(QStringLiteral("shared"), shared_object);
+
+		QJsonArray projects_array;
+		for (const auto &project : projects)
+		{
+			const auto counters = projectCounters(project);
+			QJsonObject project_object;
+			project_object.insert(QStringLiteral("title"), project->title());
+			project_object.insert(QStringLiteral("file"), project->filePath());
+			project_object.insert(QStringLiteral("total_bytes"), totalBytes(counters));
+			project_object.insert(QStringLiteral("counters"), countersToJson(counters));
+			projects_array.append(project_object);
+		}
+		report.insert(QStringLiteral("projects"), projects_array);
+
+		return report;
+	}
+}
@@ -0,0 +1,60 @@
+/*
+	Copyright 2006-2026 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech. If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef QETMEMORYACCOUNTING_H
+#define QETMEMORYACCOUNTING_H
+
+#include <QJsonObject>
+#include <QList>
+#include <QString>
+#include <QVector>
+
+class QETProject;
+
+/**
+	Estimate the memory used by the projects and by the caches
+	shared by every projects.
+	The sizes are estimations : the size of the data owned by Qt
+	(private classes, memory allocator...) can't be known, so a fixed
+	overhead is added to each object. The estimations are made to
+	compare the projects and find a regression, not to compute
+	the exact memory used by the process.
+
+	Each counter has a stable id (subsystem.name) used by the
+	machine readable report (see toJson() and the command line
+	option --memory-report) and a human readable name used by the gui.
+*/
+namespace QetMemoryAccounting
+{
+	struct Counter
+	{
+		QString id;
+		QString name;
+		qint64 count = 0;
+			///Estimated size in bytes, -1 if the size can't be estimated
+		qint64 bytes = -1;
+	};
+
+	QVector<Counter> projectCounters(QETProject *project);
+	QVector<Counter> sharedCounters();
+	qint64 totalBytes(const QVector<Counter> &counters);
+	qint64 residentBytes();
+
+	QJsonObject toJson(const QList<QETProject *> &projects);
+}
+
+#endif // QETMEMORYACCOUNTING_H
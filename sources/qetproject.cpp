@@ -23,6 +23,7 @@
 #include "autoNum/numerotationcontext.h"
 #include "autoNum/numerotationcontextcommands.h"
 #include "diagram.h"
+#include "factory/elementfactory.h"
 #include "qetapp.h"
 #include "qetmessagebox.h"
 #include "qetresult.h"
@@ -43,6 +44,17 @@
 
 static int BACKUP_INTERVAL = 1200000; //interval in ms of backup = 20min
 
+/**
+	@brief compactProjectFile
+	@return true if the projects are written with the compact serialisation :
+	no indentation and the attributes equal to their default value omitted.
+*/
+static bool compactProjectFile()
+{
+	QSettings settings;
+	return settings.value("diagrameditor/compact-project-file", false).toBool();
+}
+
 /**
 	@brief QETProject::QETProject
 	Create a empty project
@@ -86,6 +98,34 @@ QETProject::QETProject(const QString &path, QObject *parent) :
 	init();
 }
 
+/**
+	@brief QETProject::QETProject
+	Construct a project from the xml of a .qet file already parsed,
+	used to open several files in parallel (see ProjectFileReader).
+	@param path : path of the file
+	@param xml_project : the parsed content of the file
+	@param parent : parent QObject
+*/
+QETProject::QETProject(const QString &path, QDomDocument &xml_project, QObject *parent) :
+	QObject              (parent),
+	m_titleblocks_collection(this),
+	m_data_base(this, this),
+	m_project_properties_handler{this}
+{
+	QFileInfo fi(path);
+	setFilePath(fi.absoluteFilePath());
+
+	readProjectXml(xml_project);
+	if (m_state != ProjectState::Ok) {
+		return;
+	}
+
+	if (!fi.isWritable()) {
+		setReadOnly(true);
+	}
+	init();
+}
+
 #ifdef BUILD_WITHOUT_KF5
 #else
 /**
@@ -130,9 +170,7 @@ QETProject::QETProject(KAutoSaveFile *backup, QObject *parent) :
 */
 QETProject::~QETProject()
 {
-		//We block database signal to avoid hundreds of unnecessary emitted signal
-		//due to deletion (diagram, item, etc...) and as much update made in the not yet deleted things.
-	m_data_base.blockSignals(true);
+	beginTeardown();
 
 		//Each time a diagram is deleted we also remove it from m_diagram_list
 		//because a lot of thing append during the destructor of a diagram class
@@ -149,6 +187,76 @@ QETProject::~QETProject()
 	}
 }
 
+/**
+	@brief QETProject::releaseLater
+	Delete this project in the next turns of the event loop,
+	one folio per turn, so the interface stay responsive
+	while a large project is released.
+	If the application quit before the end, the remaining folios
+	are deleted at once by the destructor.
+	The project must not be used anymore after this call.
+*/
+void QETProject::releaseLater()
+{
+	beginTeardown();
+	connect(QCoreApplication::instance(), &QCoreApplication::aboutToQuit,
+			this, &QObject::deleteLater);
+	QTimer::singleShot(0, this, &QETProject::releaseNextDiagram);
+}
+
+/**
+	@brief QETProject::releaseNextDiagram
+	Delete the last folio of this project, and schedule the deletion
+	of the next one. When every folio is deleted, the project itself
+	is deleted.
+	@see releaseLater()
+*/
+void QETProject::releaseNextDiagram()
+{
+	if (m_diagrams_list.isEmpty()) {
+		deleteLater();
+		return;
+	}
+
+	auto diagram = m_diagrams_list.takeLast();
+	delete diagram;
+	QTimer::singleShot(0, this, &QETProject::releaseNextDiagram);
+}
+
+/**
+	@brief QETProject::beginTeardown
+	Prepare the deletion of this project :
+	the timers are stopped, the database is no longer updated and
+	its signals are blocked, to avoid hundreds of unnecessary emitted signal
+	due to deletion (diagram, item, etc...) and as much update made in
+	the not yet deleted things. Each folio is prepared to release
+	its items at once (see Diagram::beginTeardown) and the change bus
+	drop its subscriptions at once (see ProjectChangeBus::beginTeardown).
+*/
+void QETProject::beginTeardown()
+{
+	if (m_tearing_down) {
+		return;
+	}
+	m_tearing_down = true;
+
+	m_save_backup_timer.stop();
+	m_autosave_timer.stop();
+	m_data_base.blockSignals(true);
+	m_data_base.setIncrementalUpdate(false);
+	m_change_bus.beginTeardown();
+	if (m_undo_stack) {
+		m_undo_stack->clear();
+	}
+
+	for (const auto &diagram : qAsConst(m_diagrams_list)) {
+		diagram->beginTeardown();
+	}
+
+		//The prototypes of the embedded elements refer to this project
+	ElementFactory::Instance()->clearPrototypes(this);
+}
+
 /**
 	@brief QETProject::dataBase
 	@return The data base of this project
@@ -555,17 +663,20 @@ void QETProject::setDefaultReportProperties(const QString &properties)
 	m_default_report_properties = properties;
 
 	emit reportPropertiesChanged(old, properties);
+	m_change_bus.publish(ProjectChangeBus::ReportProperties);
 }
 
 void QETProject::setDefaultXRefProperties(const QString& type, const XRefProperties &properties) {
 	m_default_xref_properties.insert(type, properties);
 	emit XRefPropertiesChanged();
+	m_change_bus.publish(ProjectChangeBus::XRefProperties);
 }
 
 void QETProject::setDefaultXRefProperties(QHash<QString, XRefProperties> hash)
 {
 	m_default_xref_properties.swap(hash);
 	emit XRefPropertiesChanged();
+	m_change_bus.publish(ProjectChangeBus::XRefProperties);
 }
 
 /**
@@ -917,6 +1028,12 @@ void QETProject::autoFolioNumberingSelectedFolios(int from,
 */
 QDomDocument QETProject::toXml()
 {
+		//Labels and xref waiting for a change must be up to date before being saved
+	m_change_bus.flush();
+
+		//The readers fill back the omitted attributes with their default value
+	QETXML::setElideDefaultValues(compactProjectFile());
+
 	// racine du projet
 	QDomDocument xml_doc;
 	QDomElement project_root = xml_doc.createElement("project");
@@ -982,6 +1099,7 @@ QDomDocument QETProject::toXml()
 	// Write the elements collection.
 	project_root.appendChild(m_elements_collection->root().cloneNode(true));
 
+	QETXML::setElideDefaultValues(false);
 	return(xml_doc);
 }
 
@@ -1013,7 +1131,10 @@ QETResult QETProject::write()
 
 	QDomDocument xml_project(toXml());
 	QString error_message;
-	if (!QET::writeXmlFile(xml_project, m_file_path, &error_message))
+	if (!QET::writeXmlFile(xml_project,
+						   m_file_path,
+						   &error_message,
+						   compactProjectFile() ? -1 : 4))
 		return(error_message);
 
 		//title block variables should be updated after file save dialog is confirmed, before file is saved.
@@ -1485,7 +1606,7 @@ void QETProject::readDiagramsXml(QDomDocument &xml_project)
 			m_diagrams_list << diagram;
 
 			connect(&diagram->border_and_titleblock, &BorderTitleBlock::needFolioData,
-					this, &QETProject::updateDiagramsFolioData);
+					this, [this, diagram]() {folioDataNeeded(diagram);});
 			connect(diagram, &Diagram::usedTitleBlockTemplateChanged,
 					this, &QETProject::usedTitleBlockTemplateChanged);
 
@@ -1763,8 +1884,7 @@ void QETProject::addDiagram(Diagram *diagram, int pos)
 
 	connect(&diagram->border_and_titleblock,
 		&BorderTitleBlock::needFolioData,
-		this,
-		&QETProject::updateDiagramsFolioData);
+		this, [this, diagram]() {folioDataNeeded(diagram);});
 	connect(diagram, &Diagram::usedTitleBlockTemplateChanged,
 		this, &QETProject::usedTitleBlockTemplateChanged);
 
@@ -1788,7 +1908,8 @@ void QETProject::writeBackup()
 #	if QT_VERSION < QT_VERSION_CHECK(6, 0, 0) // ### Qt 6: remove
 	QDomDocument xml_project(toXml());
 	QtConcurrent::run(
-				QET::writeToFile,xml_project,&m_backup_file,nullptr);
+				QET::writeToFile,xml_project,&m_backup_file,nullptr,
+				compactProjectFile() ? -1 : 4);
 #	else
 #		if TODO_LIST
 #			pragma message("@TODO remove code for QT 6 or later")
@@ -1909,51 +2030,133 @@ bool QETProject::projectWasModified()
 /**
 	Indique a chaque schema du projet quel est son numero de folio et combien de
 	folio le projet contient.
+
+	Only the folios whose values changed since the last call are updated :
+	the values given to each folio are kept in m_folio_data and compared
+	to the new ones, so adding, moving or removing a folio only re-render
+	the title blocks of the folios which changed.
+	ProjectChangeBus::FolioPosition is published for each folio whose
+	index changed, to update the cross references and the labels
+	which use it.
 */
 void QETProject::updateDiagramsFolioData()
 {
-	int total_folio = m_diagrams_list.count();
+	const int total_folio = m_diagrams_list.count();
 
 	DiagramContext project_wide_properties = m_project_properties;
 	project_wide_properties.addValue("projecttitle", title());
 	project_wide_properties.addValue("projectpath", filePath());
 	project_wide_properties.addValue("projectfilename", QFileInfo(filePath()).baseName());
 
+	const bool properties_changed = project_wide_properties != m_folio_project_properties;
+	m_folio_project_properties = project_wide_properties;
+
+	QHash <Diagram *, FolioData> folio_data;
+	folio_data.reserve(total_folio);
+	QVector<bool> changed(total_folio, false);
+	QVector<bool> position_changed(total_folio, false);
+
+		//Index, total and auto page number
 	for (int i = 0 ; i < total_folio ; ++ i)
 	{
-		QString autopagenum = m_diagrams_list[i]->border_and_titleblock.autoPageNum();
+		Diagram *diagram = m_diagrams_list.at(i);
+		BorderTitleBlock &btb = diagram->border_and_titleblock;
+
+		FolioData data;
+		data.folio = btb.folio();
+		data.index = i + 1;
+		data.total = total_folio;
+
+		QString autopagenum = btb.autoPageNum();
 		NumerotationContext nC = folioAutoNum(autopagenum);
 		NumerotationContextCommands nCC = NumerotationContextCommands(nC);
 
-		if ((m_diagrams_list[i]->border_and_titleblock.folio().contains("%autonum")) &&
-			(!autopagenum.isNull()))
+		if (data.folio.contains("%autonum") && !autopagenum.isNull())
 		{
-			m_diagrams_list[i] -> border_and_titleblock.setFolioData(i + 1, total_folio, nCC.toRepresentedString(), project_wide_properties);
-			m_diagrams_list[i]->project()->addFolioAutoNum(autopagenum,nCC.next());
+			data.autonum = nCC.toRepresentedString();
+			addFolioAutoNum(autopagenum, nCC.next());
 		}
-		else {
-			m_diagrams_list[i] -> border_and_titleblock.setFolioData(i + 1, total_folio, nullptr, project_wide_properties);
+
+		const auto old = m_folio_data.constFind(diagram);
+		const bool is_new = old == m_folio_data.constEnd();
+		if (!is_new)
+		{
+			data.previous = old->previous;
+			data.next = old->next;
 		}
 
-		if (i > 0)
+		position_changed[i] = is_new ||
+							  old->index != data.index ||
+							  old->total != data.total;
+
+		if (properties_changed ||
+			position_changed[i] ||
+			old->folio != data.folio ||
+			old->autonum != data.autonum)
 		{
-			m_diagrams_list.at(i)->border_and_titleblock.setPreviousFolioNum(m_diagrams_list.at(i-1)->border_and_titleblock.finalfolio());
-			m_diagrams_list.at(i-1)->border_and_titleblock.setNextFolioNum(m_diagrams_list.at(i)->border_and_titleblock.finalfolio());
+			btb.setFolioData(data.index, data.total, data.autonum, project_wide_properties);
+				//%autonum is replaced in the folio field by setFolioData
+			data.folio = btb.folio();
+			changed[i] = true;
+		}
 
-			if (i == total_folio-1) {
-				m_diagrams_list.at(i)->border_and_titleblock.setNextFolioNum(QString());
-			}
+		folio_data.insert(diagram, data);
+	}
+
+		//Previous and next folio, which depend of the final folio of the neighbours
+	for (int i = 0 ; i < total_folio ; ++ i)
+	{
+		Diagram *diagram = m_diagrams_list.at(i);
+		FolioData &data = folio_data[diagram];
+
+		const QString previous = i > 0
+								 ? m_diagrams_list.at(i-1)->border_and_titleblock.finalfolio()
+								 : QString();
+		const QString next = i < total_folio - 1
+							 ? m_diagrams_list.at(i+1)->border_and_titleblock.finalfolio()
+							 : QString();
+
+		if (data.previous != previous)
+		{
+			diagram->border_and_titleblock.setPreviousFolioNum(previous);
+			data.previous = previous;
+			changed[i] = true;
 		}
-		else {
-			m_diagrams_list.at(i)->border_and_titleblock.setPreviousFolioNum(QString());
+		if (data.next != next)
+		{
+			diagram->border_and_titleblock.setNextFolioNum(next);
+			data.next = next;
+			changed[i] = true;
 		}
 	}
 
-	for (const auto &diagram_ : qAsConst(m_diagrams_list)) {
-		diagram_->update();
+	m_folio_data = folio_data;
+
+	for (int i = 0 ; i < total_folio ; ++ i)
+	{
+		Diagram *diagram = m_diagrams_list.at(i);
+		if (changed.at(i)) {
+			diagram->update(diagram->border_and_titleblock.titleBlockRect());
+		}
+		if (position_changed.at(i)) {
+			m_change_bus.publish(ProjectChangeBus::FolioPosition, diagram->uuid());
+		}
 	}
 }
 
+/**
+	@brief QETProject::folioDataNeeded
+	The title block of @a diagram was modified and need its folio data :
+	forget the folio data given to @a diagram and update the folio data
+	of the project.
+	@param diagram
+*/
+void QETProject::folioDataNeeded(Diagram *diagram)
+{
+	m_folio_data.remove(diagram);
+	updateDiagramsFolioData();
+}
+
 /**
 	Inform each diagram that the \a template_name title block changed.
 	@param collection Title block templates collection
@@ -24,6 +24,7 @@
 #include "borderproperties.h"
 #include "conductorproperties.h"
 #include "dataBase/projectdatabase.h"
+#include "projectchangebus.h"
 #include "properties/reportproperties.h"
 #include "properties/xrefproperties.h"
 #include "titleblock/templatescollection.h"
@@ -78,6 +79,7 @@ class QETProject : public QObject
 	public:
 		QETProject (QObject *parent = nullptr);
 		QETProject (const QString &path, QObject * = nullptr);
+		QETProject (const QString &path, QDomDocument &xml_project, QObject *parent = nullptr);
 #ifdef BUILD_WITHOUT_KF5
 #else
 		QETProject (KAutoSaveFile *backup, QObject *parent=nullptr);
@@ -167,6 +169,7 @@ class QETProject : public QObject
 
 		QDomDocument toXml();
 		bool close();
+		void releaseLater();
 		QETResult write();
 		bool isReadOnly() const;
 		void setReadOnly(bool);
@@ -181,6 +184,7 @@ class QETProject : public QObject
 		DiagramContext projectProperties();
 		void setProjectProperties(const DiagramContext &);
 		QUndoStack* undoStack() {return m_undo_stack;}
+		ProjectChangeBus *changeBus() {return &m_change_bus;}
 
 		QVector<TerminalStrip *> terminalStrip() const;
 		TerminalStrip * newTerminalStrip(QString installation = QString(), QString location = QString(), QString name = QString());
@@ -222,6 +226,7 @@ class QETProject : public QObject
 		void removeDiagramsTitleBlockTemplate(TitleBlockTemplatesCollection *, const QString &);
 		void usedTitleBlockTemplateChanged(const QString &);
 		void undoStackChanged (bool a) {if (!a) setModified(true);}
+		void releaseNextDiagram();
 
 	private:
 		void readProjectXml(QDomDocument &xml_project);
@@ -238,6 +243,24 @@ class QETProject : public QObject
 		void init();
 		ProjectState openFile(QFile *file);
 		void refresh();
+		void folioDataNeeded(Diagram *diagram);
+		void beginTeardown();
+
+		/**
+			@brief The FolioData struct
+			The values given to the title block of a folio by
+			updateDiagramsFolioData, kept to update only the folios
+			whose values changed.
+		*/
+		struct FolioData
+		{
+			QString folio;
+			int index = 0;
+			int total = 0;
+			QString autonum;
+			QString previous;
+			QString next;
+		};
 
 	// attributes
 	private:
@@ -272,7 +295,12 @@ class QETProject : public QObject
 			/// project-wide variables that will be made available to child diagrams
 		DiagramContext m_project_properties;
 			/// undo stack for this project
-		QUndoStack *m_undo_stack;
+		QUndoStack *m_undo_stack = nullptr;
+			/// changes delivered to the items of the folios
+		ProjectChangeBus m_change_bus;
+			/// Folio data given to each folio, see updateDiagramsFolioData
+		QHash <Diagram *, FolioData> m_folio_data;
+		DiagramContext m_folio_project_properties;
 			/// Conductor auto numerotation
 		QHash <QString, NumerotationContext> m_conductor_autonum;//Title and NumContext hash
 		QString m_current_conductor_autonum;
@@ -287,6 +315,8 @@ class QETProject : public QObject
 		bool m_freeze_new_conductors = false;
 		QTimer m_save_backup_timer,
 			   m_autosave_timer;
+			/// The project is being deleted, see beginTeardown()
+		bool m_tearing_down = false;
 #ifdef BUILD_WITHOUT_KF5
 #else
 		KAutoSaveFile m_backup_file;
@@ -585,6 +585,124 @@ QVector<QDomElement> QETXML::findInDomElement(const QDomElement &dom_elmt, const
 
 namespace QETXML {
 
+	/// True when the attributes equal to their default value are not written
+	/// by the current thread, see setElideDefaultValues
+static thread_local bool s_elide_default_values = false;
+
+/**
+ * @brief setElideDefaultValues
+ * Set if the toXml functions of the current thread omit the attributes
+ * equal to the default value used by the matching fromXml functions
+ * (compact serialisation of the projects).
+ * Must be reset to false when the document is built, because the xml of
+ * the items is also used for the clipboard and the undo commands.
+ * @param elide
+ */
+void setElideDefaultValues(bool elide)
+{
+	s_elide_default_values = elide;
+}
+
+/**
+ * @brief elideDefaultValues
+ * @return true if the attributes equal to their default value
+ * must not be written, see setElideDefaultValues
+ */
+bool elideDefaultValues()
+{
+	return s_elide_default_values;
+}
+
+/**
+ * @brief elidedDefaults
+ * The attributes which are not written by the compact serialisation
+ * when they are equal to their default value, and this value.
+ * This is the only list of these defaults : it is used by the toXml functions
+ * (see setElidableAttribute) and by the comparison of the projects
+ * (see ProjectDiff) to consider an omitted attribute equal to its default.
+ * @param tag_name : tag name of the xml element of the item
+ * ("conductor", "element" or "dynamic_elmt_text")
+ * @return the attribute name -> default value of \p tag_name,
+ * an empty hash if this tag has no elided attribute
+ */
+const QHash<QString, QString> &elidedDefaults(const QString &tag_name)
+{
+	static const QHash<QString, QHash<QString, QString>> defaults {
+		{QStringLiteral("conductor"), {
+			 {QStringLiteral("x"),                    QStringLiteral("0")},
+			 {QStringLiteral("y"),                    QStringLiteral("0")},
+			 {QStringLiteral("freezeLabel"),          QStringLiteral("false")},
+			 {QStringLiteral("type"),                 QStringLiteral("multi")},
+			 {QStringLiteral("bicolor"),              QStringLiteral("false")},
+			 {QStringLiteral("color2"),               QStringLiteral("#000000")},
+			 {QStringLiteral("dash-size"),            QStringLiteral("1")},
+			 {QStringLiteral("num"),                  QString()},
+			 {QStringLiteral("text_color"),           QStringLiteral("#000000")},
+			 {QStringLiteral("formula"),              QString()},
+			 {QStringLiteral("cable"),                QString()},
+			 {QStringLiteral("bus"),                  QString()},
+			 {QStringLiteral("function"),             QString()},
+			 {QStringLiteral("tension_protocol"),     QString()},
+			 {QStringLiteral("conductor_color"),      QString()},
+			 {QStringLiteral("conductor_section"),    QString()},
+			 {QStringLiteral("numsize"),              QStringLiteral("9")},
+			 {QStringLiteral("condsize"),             QStringLiteral("1")},
+			 {QStringLiteral("displaytext"),          QStringLiteral("1")},
+			 {QStringLiteral("onetextperfolio"),      QStringLiteral("0")},
+			 {QStringLiteral("vertirotatetext"),      QStringLiteral("0")},
+			 {QStringLiteral("horizrotatetext"),      QStringLiteral("0")},
+			 {QStringLiteral("horizontal-alignment"), QStringLiteral("AlignBottom")},
+			 {QStringLiteral("vertical-alignment"),   QStringLiteral("AlignRight")},
+			 {QStringLiteral("ground"),               QStringLiteral("false")},
+			 {QStringLiteral("neutral"),              QStringLiteral("false")},
+			 {QStringLiteral("phase"),                QStringLiteral("0")}}},
+		{QStringLiteral("element"), {
+			 {QStringLiteral("prefix"),               QString()},
+			 {QStringLiteral("freezeLabel"),          QStringLiteral("false")},
+			 {QStringLiteral("orientation"),          QStringLiteral("0")}}},
+		{QStringLiteral("dynamic_elmt_text"), {
+			 {QStringLiteral("x"),                    QStringLiteral("0")},
+			 {QStringLiteral("y"),                    QStringLiteral("0")},
+			 {QStringLiteral("rotation"),             QStringLiteral("0")},
+			 {QStringLiteral("frame"),                QStringLiteral("false")},
+			 {QStringLiteral("text_width"),           QStringLiteral("-1")},
+			 {QStringLiteral("keep_visual_rotation"), QStringLiteral("true")}}}
+	};
+	static const QHash<QString, QString> empty;
+
+	const auto it = defaults.constFind(tag_name);
+	return it == defaults.constEnd() ? empty : it.value();
+}
+
+/**
+ * @brief setElidableAttribute
+ * Set the attribute \p name of \p element to \p value,
+ * unless the compact serialisation is enabled (see setElideDefaultValues)
+ * and \p value is the default value of this attribute (see elidedDefaults).
+ * @param element
+ * @param tag_name : the table of elidedDefaults to use, the tag name of
+ * the item, which can differ from the tag name of \p element
+ * (the default conductor properties of a project for example)
+ * @param name : must be an attribute of the table \p tag_name
+ * @param value
+ */
+void setElidableAttribute(QDomElement &element,
+						  const QString &tag_name,
+						  const QString &name,
+						  const QString &value)
+{
+	if (s_elide_default_values)
+	{
+		const auto &defaults = elidedDefaults(tag_name);
+		Q_ASSERT(defaults.contains(name));
+		const auto it = defaults.constFind(name);
+		if (it != defaults.constEnd() && it.value() == value) {
+			return;
+		}
+	}
+	element.setAttribute(name, value);
+}
+
 /**
  * @brief boolToString
  * @param value
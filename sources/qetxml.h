@@ -19,6 +19,7 @@
 #define QETXML_H
 
 #include <QDomElement>
+#include <QHash>
 #include <QPen>
 
 class QDomDocument;
@@ -105,6 +106,14 @@ namespace QETXML
 					 bool default_value = true,
 					 bool *conv_ok = nullptr);
 
+	void setElideDefaultValues(bool elide);
+	bool elideDefaultValues();
+	const QHash<QString, QString> &elidedDefaults(const QString &tag_name);
+	void setElidableAttribute(QDomElement &element,
+							  const QString &tag_name,
+							  const QString &name,
+							  const QString &value);
+
 	const QString integerS = "int";
 	const QString doubleS = "double";
 	const QString boolS = "bool";
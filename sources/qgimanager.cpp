@@ -41,7 +41,7 @@ QGIManager::~QGIManager()
 {
 	if (!destroy_qgi_on_delete) return;
 	foreach(QGraphicsItem *qgi, qgi_manager.keys()) {
-		if (!scene -> items().contains(qgi)) delete qgi;
+		if (qgi -> scene() != scene) delete qgi;
 	}
 }
 
@@ -64,7 +64,7 @@ void QGIManager::manage(QGraphicsItem *qgi) {
 void QGIManager::release(QGraphicsItem *qgi) {
 	if (!qgi_manager.contains(qgi)) return;
 	-- qgi_manager[qgi];
-	if (qgi_manager[qgi] <= 0 && !(scene -> items().contains(qgi))) {
+	if (qgi_manager[qgi] <= 0 && qgi -> scene() != scene) {
 		delete qgi;
 		qgi_manager.remove(qgi);
 	}
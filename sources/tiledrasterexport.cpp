@@ -0,0 +1,476 @@
+/*
+	Copyright 2006-2026 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech. If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "tiledrasterexport.h"
+
+#include "diagram.h"
+
+#include <QFuture>
+#include <QIODevice>
+#include <QImage>
+#include <QPainter>
+#include <QtConcurrentRun>
+#include <QtEndian>
+
+#include <memory>
+#include <zlib.h>
+
+namespace
+{
+		/**
+			Base class of the encoders, the rows are given
+			from the top to the bottom of the image.
+		*/
+	class StreamEncoder
+	{
+		public:
+			StreamEncoder(QIODevice *device, int width, int height) :
+				m_device(device),
+				m_width(width),
+				m_height(height)
+			{}
+			virtual ~StreamEncoder() {}
+
+			virtual bool begin() = 0;
+			virtual bool writeRows(const QImage &band, int rows) = 0;
+			virtual bool finish() = 0;
+
+		protected:
+			bool writeData(const char *data, qint64 size) {
+				return m_device->write(data, size) == size;
+			}
+
+		protected:
+			QIODevice *m_device;
+			int m_width;
+			int m_height;
+	};
+
+		/**
+			Write a PNG (8 bits RGB, no interlace).
+			Each row is filtered with the "Sub" filter, efficient
+			for the large flat areas of a diagram, then deflated by zlib
+			and written in IDAT chunks as soon as the output buffer is full.
+		*/
+	class PngEncoder : public StreamEncoder
+	{
+		public:
+			PngEncoder(QIODevice *device, int width, int height) :
+				StreamEncoder(device, width, height),
+				m_row(1 + 3 * width, 0),
+				m_out(64 * 1024, 0)
+			{}
+
+			~PngEncoder() override {
+				if (m_stream_init) {
+					deflateEnd(&m_stream);
+				}
+			}
+
+			bool begin() override
+			{
+				static const char signature[] = {'\x89', 'P', 'N', 'G', '\r', '\n', '\x1a', '\n'};
+				if (!writeData(signature, sizeof(signature))) {
+					return false;
+				}
+
+				QByteArray ihdr(13, 0);
+				qToBigEndian<quint32>(m_width, ihdr.data());
+				qToBigEndian<quint32>(m_height, ihdr.data() + 4);
+				ihdr[8] = 8;  //bit depth
+				ihdr[9] = 2;  //color type : RGB
+				ihdr[10] = 0; //compression
+				ihdr[11] = 0; //filter
+				ihdr[12] = 0; //interlace
+				if (!writeChunk("IHDR", ihdr.constData(), ihdr.size())) {
+					return false;
+				}
+
+				m_stream.zalloc = Z_NULL;
+				m_stream.zfree = Z_NULL;
+				m_stream.opaque = Z_NULL;
+				m_stream_init = deflateInit(&m_stream, Z_DEFAULT_COMPRESSION) == Z_OK;
+				m_stream.next_out = reinterpret_cast<Bytef *>(m_out.data());
+				m_stream.avail_out = m_out.size();
+				return m_stream_init;
+			}
+
+			bool writeRows(const QImage &band, int rows) override
+			{
+				uchar *row = reinterpret_cast<uchar *>(m_row.data());
+				for (int y = 0 ; y < rows ; ++y)
+				{
+					const QRgb *line = reinterpret_cast<const QRgb *>(band.constScanLine(y));
+					row[0] = 1; //filter Sub
+					uchar previous[3] = {0, 0, 0};
+					for (int x = 0 ; x < m_width ; ++x)
+					{
+						const uchar rgb[3] = {uchar(qRed(line[x])),
+											  uchar(qGreen(line[x])),
+											  uchar(qBlue(line[x]))};
+						for (int c = 0 ; c < 3 ; ++c) {
+							row[1 + 3 * x + c] = uchar(rgb[c] - previous[c]);
+							previous[c] = rgb[c];
+						}
+					}
+					if (!deflateData(row, m_row.size(), Z_NO_FLUSH)) {
+						return false;
+					}
+				}
+				return true;
+			}
+
+			bool finish() override
+			{
+				return deflateData(nullptr, 0, Z_FINISH)
+						&& writeChunk("IEND", nullptr, 0);
+			}
+
+		private:
+			bool writeChunk(const char *type, const char *data, int size)
+			{
+				char length[4];
+				qToBigEndian<quint32>(size, length);
+				uLong crc = crc32(0L, Z_NULL, 0);
+				crc = crc32(crc, reinterpret_cast<const Bytef *>(type), 4);
+				if (size) {
+					crc = crc32(crc, reinterpret_cast<const Bytef *>(data), size);
+				}
+				char crc_data[4];
+				qToBigEndian<quint32>(quint32(crc), crc_data);
+
+				return writeData(length, 4)
+						&& writeData(type, 4)
+						&& (!size || writeData(data, size))
+						&& writeData(crc_data, 4);
+			}
+
+			bool deflateData(const uchar *data, int size, int flush)
+			{
+				m_stream.next_in = const_cast<Bytef *>(data);
+				m_stream.avail_in = size;
+				do
+				{
+					const int ret = deflate(&m_stream, flush);
+					if (ret == Z_STREAM_ERROR) {
+						return false;
+					}
+
+						//Output buffer is full or stream is finished : write an IDAT chunk
+					if (m_stream.avail_out == 0 || (flush == Z_FINISH && ret == Z_STREAM_END))
+					{
+						const int out_size = m_out.size() - m_stream.avail_out;
+						if (out_size && !writeChunk("IDAT", m_out.constData(), out_size)) {
+							return false;
+						}
+						m_stream.next_out = reinterpret_cast<Bytef *>(m_out.data());
+						m_stream.avail_out = m_out.size();
+						if (ret == Z_STREAM_END) {
+							return true;
+						}
+					}
+				} while (m_stream.avail_in > 0 || flush == Z_FINISH);
+
+				return true;
+			}
+
+		private:
+			z_stream m_stream;
+			bool m_stream_init = false;
+			QByteArray m_row;
+			QByteArray m_out;
+	};
+
+		/**
+			Write a 24 bits BMP, the rows are stored from the top
+			to the bottom (negative height) so they can be written
+			in the order they are rendered.
+		*/
+	class BmpEncoder : public StreamEncoder
+	{
+		public:
+			BmpEncoder(QIODevice *device, int width, int height) :
+				StreamEncoder(device, width, height),
+				m_row(((3 * width + 3) / 4) * 4, 0)
+			{}
+
+			bool begin() override
+			{
+				const qint64 file_size = 54 + qint64(m_row.size()) * m_height;
+				if (file_size > 0xFFFFFFFFLL) {
+					return false;
+				}
+
+				QByteArray header(54, 0);
+				char *h = header.data();
+				h[0] = 'B'; h[1] = 'M';
+				qToLittleEndian<quint32>(quint32(file_size), h + 2);
+				qToLittleEndian<quint32>(54, h + 10);                     //offset of the pixels
+				qToLittleEndian<quint32>(40, h + 14);                     //size of the info header
+				qToLittleEndian<qint32>(m_width, h + 18);
+				qToLittleEndian<qint32>(-m_height, h + 22);               //top-down
+				qToLittleEndian<quint16>(1, h + 26);                      //planes
+				qToLittleEndian<quint16>(24, h + 28);                     //bits per pixel
+				qToLittleEndian<quint32>(quint32(file_size - 54), h + 34); //size of the pixels
+				qToLittleEndian<qint32>(2835, h + 38);                    //72 dpi
+				qToLittleEndian<qint32>(2835, h + 42);
+				return writeData(header.constData(), header.size());
+			}
+
+			bool writeRows(const QImage &band, int rows) override
+			{
+				uchar *row = reinterpret_cast<uchar *>(m_row.data());
+				for (int y = 0 ; y < rows ; ++y)
+				{
+					const QRgb *line = reinterpret_cast<const QRgb *>(band.constScanLine(y));
+					for (int x = 0 ; x < m_width ; ++x)
+					{
+						row[3 * x]     = uchar(qBlue(line[x]));
+						row[3 * x + 1] = uchar(qGreen(line[x]));
+						row[3 * x + 2] = uchar(qRed(line[x]));
+					}
+					if (!writeData(m_row.constData(), m_row.size())) {
+						return false;
+					}
+				}
+				return true;
+			}
+
+			bool finish() override {
+				return true;
+			}
+
+		private:
+			QByteArray m_row;
+	};
+}
+
+/**
+	@brief TiledRasterExport::TiledRasterExport
+	@param diagram : diagram to export
+	@param width : width of the exported image
+	@param height : height of the exported image
+	@param mode : how the diagram is fitted in the image,
+	same as Diagram::toPaintDevice
+*/
+TiledRasterExport::TiledRasterExport(Diagram *diagram,
+									 int width,
+									 int height,
+									 Qt::AspectRatioMode mode) :
+	m_diagram(diagram),
+	m_width(width),
+	m_height(height)
+{
+	if (!m_diagram) {
+		return;
+	}
+
+	m_source = m_diagram->paintSourceArea();
+
+		//Same placement as QGraphicsScene::render : the source area
+		//is scaled according to mode and centered in the image.
+	const QSizeF target_size = m_source.size().scaled(QSizeF(width, height), mode);
+	m_target = QRectF(QPointF((width - target_size.width()) / 2.0,
+							  (height - target_size.height()) / 2.0),
+					  target_size);
+}
+
+/**
+	@brief TiledRasterExport::supportsFormat
+	@param format : the acronym of the format (PNG, JPG, BMP...)
+	@return true if @a format can be exported by band
+*/
+bool TiledRasterExport::supportsFormat(const QString &format)
+{
+	return format.compare(QLatin1String("PNG"), Qt::CaseInsensitive) == 0
+			|| format.compare(QLatin1String("BMP"), Qt::CaseInsensitive) == 0;
+}
+
+/**
+	@brief TiledRasterExport::setTileHeight
+	Set the height in pixel of the rendered bands,
+	the memory used by the export is about width * rows * 4 bytes
+	(twice in concurrent mode).
+	@param rows
+*/
+void TiledRasterExport::setTileHeight(int rows) {
+	m_tile_height = qMax(1, rows);
+}
+
+/**
+	@brief TiledRasterExport::tileHeight
+	@return the height in pixel of the rendered bands
+*/
+int TiledRasterExport::tileHeight() const {
+	return m_tile_height;
+}
+
+/**
+	@brief TiledRasterExport::setConcurrent
+	@param concurrent : true to encode a band in a worker thread
+	while the next band is rendered.
+*/
+void TiledRasterExport::setConcurrent(bool concurrent) {
+	m_concurrent = concurrent;
+}
+
+/**
+	@brief TiledRasterExport::isConcurrent
+	@return true if the bands are encoded in a worker thread
+*/
+bool TiledRasterExport::isConcurrent() const {
+	return m_concurrent;
+}
+
+/**
+	@brief TiledRasterExport::write
+	Render the diagram and write it in @a device.
+	@param device : device where the image is written,
+	opened in write only mode if not already open.
+	@param format : acronym of the format, see supportsFormat()
+	@return true on success, else see errorString()
+*/
+bool TiledRasterExport::write(QIODevice *device, const QString &format)
+{
+	m_error.clear();
+	if (!m_diagram || !device || m_width <= 0 || m_height <= 0) {
+		m_error = QObject::tr("Rien à exporter");
+		return false;
+	}
+	if (!supportsFormat(format)) {
+		m_error = QObject::tr("Le format %1 ne peut pas être exporté par bandes").arg(format);
+		return false;
+	}
+	if (!device->isOpen() && !device->open(QIODevice::WriteOnly)) {
+		m_error = device->errorString();
+		return false;
+	}
+
+	std::unique_ptr<StreamEncoder> encoder;
+	if (format.compare(QLatin1String("PNG"), Qt::CaseInsensitive) == 0) {
+		encoder.reset(new PngEncoder(device, m_width, m_height));
+	} else {
+		encoder.reset(new BmpEncoder(device, m_width, m_height));
+	}
+
+	if (!encoder->begin()) {
+		m_error = QObject::tr("Impossible d'écrire l'en-tête de l'image");
+		return false;
+	}
+
+		//deselect all elements, like Diagram::toPaintDevice
+	const QList<QGraphicsItem *> selected_items = m_diagram->selectedItems();
+	for (const auto &qgi : selected_items) {
+		qgi->setSelected(false);
+	}
+
+	const int tile_height = qMin(m_tile_height, m_height);
+	QImage bands[2] = {QImage(m_width, tile_height, QImage::Format_RGB32),
+					   m_concurrent ? QImage(m_width, tile_height, QImage::Format_RGB32)
+									: QImage()};
+	QFuture<bool> encoding;
+	bool encoding_started = false;
+	bool ok = !bands[0].isNull() && (!m_concurrent || !bands[1].isNull());
+	if (!ok) {
+		m_error = QObject::tr("Mémoire insuffisante pour une bande de l'image");
+	}
+
+	int current = 0;
+	for (int y = 0 ; ok && y < m_height ; y += tile_height)
+	{
+		QImage &band = bands[current];
+		const int rows = qMin(tile_height, m_height - y);
+		renderBand(band, y);
+
+		if (m_concurrent)
+		{
+				//The encoder write the bands in order :
+				//wait for the previous band before encode this one.
+			if (encoding_started && !encoding.result()) {
+				ok = false;
+				break;
+			}
+			StreamEncoder *e = encoder.get();
+			encoding = QtConcurrent::run([e, &band, rows]() {
+				return e->writeRows(band, rows);
+			});
+			encoding_started = true;
+			current = 1 - current;
+		}
+		else {
+			ok = encoder->writeRows(band, rows);
+		}
+	}
+
+	if (encoding_started && !encoding.result()) {
+		ok = false;
+	}
+
+	for (const auto &qgi : selected_items) {
+		qgi->setSelected(true);
+	}
+
+	if (ok) {
+		ok = encoder->finish();
+	}
+	if (!ok && m_error.isEmpty()) {
+		m_error = device->errorString().isEmpty() ? QObject::tr("Erreur lors de l'écriture de l'image")
+												  : device->errorString();
+	}
+	return ok;
+}
+
+/**
+	@brief TiledRasterExport::errorString
+	@return the error of the last call of write()
+*/
+QString TiledRasterExport::errorString() const {
+	return m_error;
+}
+
+/**
+	@brief TiledRasterExport::renderBand
+	Render in @a band the rows of the image starting at @a y.
+	Only the part of the scene visible in the band is rendered,
+	so the items outside the band are not painted.
+	@param band
+	@param y
+*/
+void TiledRasterExport::renderBand(QImage &band, int y) const
+{
+	band.fill(Qt::white);
+
+	const QRectF band_rect(0, y, m_width, band.height());
+	const QRectF target = band_rect.intersected(m_target);
+	if (target.isEmpty()) {
+		return;
+	}
+
+	const qreal sx = m_source.width() / m_target.width();
+	const qreal sy = m_source.height() / m_target.height();
+	const QRectF source(m_source.x() + (target.x() - m_target.x()) * sx,
+						m_source.y() + (target.y() - m_target.y()) * sy,
+						target.width() * sx,
+						target.height() * sy);
+
+	QPainter painter(&band);
+	painter.setRenderHint(QPainter::Antialiasing, true);
+	painter.setRenderHint(QPainter::TextAntialiasing, true);
+	painter.setRenderHint(QPainter::SmoothPixmapTransform, true);
+	painter.translate(0, -y);
+	m_diagram->render(&painter, target, source, Qt::IgnoreAspectRatio);
+}
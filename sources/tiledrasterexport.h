@@ -0,0 +1,78 @@
+/*
+	Copyright 2006-2026 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech. If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef TILEDRASTEREXPORT_H
+#define TILEDRASTEREXPORT_H
+
+#include <QPointer>
+#include <QRectF>
+#include <QString>
+
+class Diagram;
+class QIODevice;
+class QImage;
+
+/**
+	@brief The TiledRasterExport class
+	Export a diagram to a raster image without allocating an image
+	of the size of the export.
+	The diagram is rendered band after band (a band is a tile as wide
+	as the image) and each band is written straight into the encoder,
+	so the memory used is bounded by the size of a band, whatever
+	the size of the exported image.
+	When the export is concurrent, a band is encoded by a worker thread
+	while the next band is rendered (the scene can only be rendered
+	in the gui thread), two bands are then in memory.
+
+	Only the formats which can be written line by line are supported
+	(PNG and BMP), see supportsFormat().
+	The export properties (grid, border...) must be applied to the
+	diagram by the caller.
+*/
+class TiledRasterExport
+{
+	public:
+		TiledRasterExport(Diagram *diagram,
+						  int width,
+						  int height,
+						  Qt::AspectRatioMode mode = Qt::KeepAspectRatio);
+
+		static bool supportsFormat(const QString &format);
+
+		void setTileHeight(int rows);
+		int tileHeight() const;
+		void setConcurrent(bool concurrent);
+		bool isConcurrent() const;
+
+		bool write(QIODevice *device, const QString &format);
+		QString errorString() const;
+
+	private:
+		void renderBand(QImage &band, int y) const;
+
+	private:
+		QPointer<Diagram> m_diagram;
+		int m_width = 0;
+		int m_height = 0;
+		int m_tile_height = 256;
+		bool m_concurrent = true;
+		QRectF m_source;
+		QRectF m_target;
+		QString m_error;
+};
+
+#endif // TILEDRASTEREXPORT_H
@@ -27,6 +27,8 @@ class Element;
 /**
 	@brief The AbstractElementPropertiesEditorWidget class
 	This class provide common method for all widget used to edit some properties of an element
+	setElement(nullptr) release the edited element, the widget doesn't edit
+	anything until the next call of setElement.
 */
 class AbstractElementPropertiesEditorWidget : public PropertiesEditorWidget
 {
@@ -34,6 +36,7 @@ class AbstractElementPropertiesEditorWidget : public PropertiesEditorWidget
 	public:
 		explicit AbstractElementPropertiesEditorWidget(QWidget *parent = nullptr);
 		virtual void setElement(Element *element) =0;
+		void releaseEditedItems() override {setElement(nullptr);}
 
 	protected:
 		QPointer <Element> m_element;
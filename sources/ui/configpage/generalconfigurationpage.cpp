@@ -21,6 +21,7 @@
 #include "../../qeticons.h"
 #include "ui_generalconfigurationpage.h"
 #include "../../utils/qetsettings.h"
+#include "../../utils/qetlevelofdetail.h"
 #include "../../qetmessagebox.h"
 
 #include <QFileDialog>
@@ -240,6 +241,7 @@ void GeneralConfigurationPage::applyConf()
 	settings.setValue("diagrameditor/key_fine_Ygrid", ui->DiagramEditor_yKeyGridFine_sb->value());
 	settings.setValue("diagrameditor/grid_pointsize_min", ui->DiagramEditor_Grid_PointSize_min_sb->value());
 	settings.setValue("diagrameditor/grid_pointsize_max", ui->DiagramEditor_Grid_PointSize_max_sb->value());
+	QetLevelOfDetail::reloadSettings();
 		//Dynamic text item
 	settings.setValue("diagrameditor/dynamic_text_rotation", ui->m_dyn_text_rotation_sb->value());
 	settings.setValue("diagrameditor/dynamic_text_width", ui->m_dyn_text_width_sb->value());
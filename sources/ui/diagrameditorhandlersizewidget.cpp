@@ -23,6 +23,7 @@
 #include "../diagramview.h"
 #include "../diagram.h"
 #include "../../QetGraphicsItemModeler/qetgraphicshandleritem.h"
+#include "../../QetGraphicsItemModeler/qetgraphicshandlerlayer.h"
 
 DiagramEditorHandlerSizeWidget::DiagramEditorHandlerSizeWidget(QWidget *parent) :
 	QWidget(parent),
@@ -64,6 +65,11 @@ void DiagramEditorHandlerSizeWidget::on_comboBox_currentIndexChanged(int index)
 							auto handler = qgraphicsitem_cast<QetGraphicsHandlerItem *>(item);
 							handler->setSize((index+1) * 10);
 						}
+						else if (item->type() == QetGraphicsHandlerLayer::Type)
+						{
+							auto layer = qgraphicsitem_cast<QetGraphicsHandlerLayer *>(item);
+							layer->setSize((index+1) * 10);
+						}
 					}
 				}
 			}
@@ -21,6 +21,8 @@
 #include "../diagram.h"
 #include "../factory/propertieseditorfactory.h"
 
+#include <QTimer>
+
 /**
 	@brief DiagramPropertiesEditorDockWidget::DiagramPropertiesEditorDockWidget
 	Constructor
@@ -32,6 +34,36 @@ DiagramPropertiesEditorDockWidget::DiagramPropertiesEditorDockWidget(QWidget *pa
 	m_edited_qgi_type (-1)
 {}
 
+/**
+	@brief DiagramPropertiesEditorDockWidget::~DiagramPropertiesEditorDockWidget
+	Destructor
+*/
+DiagramPropertiesEditorDockWidget::~DiagramPropertiesEditorDockWidget()
+{
+	qDeleteAll(m_recyclable_editors);
+}
+
+/**
+	@brief DiagramPropertiesEditorDockWidget::clear
+	Remove all editor present in this dock and delete it,
+	also delete the editors kept to be reused.
+*/
+void DiagramPropertiesEditorDockWidget::clear()
+{
+	PropertiesEditorDockWidget::clear();
+	clearRecyclableEditors();
+}
+
+/**
+	@brief DiagramPropertiesEditorDockWidget::clearRecyclableEditors
+	Delete the editors kept to be reused
+*/
+void DiagramPropertiesEditorDockWidget::clearRecyclableEditors()
+{
+	qDeleteAll(m_recyclable_editors);
+	m_recyclable_editors.clear();
+}
+
 /**
 	@brief DiagramPropertiesEditorDockWidget::setDiagram
 	Set the diagram to edit the selection.
@@ -49,6 +81,11 @@ void DiagramPropertiesEditorDockWidget::setDiagram(Diagram *diagram)
 			   this, SLOT(selectionChanged()));
 		disconnect(m_diagram, SIGNAL(destroyed()),
 			   this, SLOT(diagramWasDeleted()));
+
+			//The editors kept to be reused belong to the previous project
+		if (!diagram || diagram->project() != m_diagram->project()) {
+			clearRecyclableEditors();
+		}
 	}
 
 	if (diagram)
@@ -71,33 +108,73 @@ void DiagramPropertiesEditorDockWidget::setDiagram(Diagram *diagram)
 /**
 	@brief DiagramPropertiesEditorDockWidget::selectionChanged
 	The current selection of diagram was changed.
-	We fill the dock with the appropriate ElementPropertiesWidget of the current selection.
+	The editor is updated once when the control return to the event loop,
+	whatever the number of selection changes before,
+	for example when a rubber band select many items.
 */
 void DiagramPropertiesEditorDockWidget::selectionChanged()
 {
+	if (m_update_scheduled) {
+		return;
+	}
+	m_update_scheduled = true;
+	QTimer::singleShot(0, this, &DiagramPropertiesEditorDockWidget::updateEditor);
+}
+
+/**
+	@brief DiagramPropertiesEditorDockWidget::updateEditor
+	We fill the dock with the appropriate ElementPropertiesWidget of the current selection.
+	The editors which are no longer used are kept hidden,
+	to be reused when an item of the same type is selected.
+*/
+void DiagramPropertiesEditorDockWidget::updateEditor()
+{
+	m_update_scheduled = false;
 	if (!m_diagram) {
 		return;
 	}
 
 	auto editor_ = PropertiesEditorFactory::propertiesEditor(
 				m_diagram->selectedItems(),
-				editors().count() ? editors().first() : nullptr,
+				editors() + m_recyclable_editors,
 				this);
 	if (!editor_) {
-		clear();
+		recycleEditors();
 		return;
 	}
 	if (editors().count() &&
 		editors().first() != editor_) {
-		clear();
+		recycleEditors();
 	}
 
+	m_recyclable_editors.removeOne(editor_);
 	addEditor(editor_);
+	editor_->show();
 	for (PropertiesEditorWidget *pew : editors()) {
 		pew->setLiveEdit(true);
 	}
 }
 
+/**
+	@brief DiagramPropertiesEditorDockWidget::recycleEditors
+	Remove the current editors from the dock,
+	and keep them to be reused by updateEditor.
+	The editors release their edited items, because these items
+	can be removed from the diagram (and kept alive by the undo stack)
+	before the editor is reused.
+*/
+void DiagramPropertiesEditorDockWidget::recycleEditors()
+{
+	for (PropertiesEditorWidget *pew : editors())
+	{
+		removeEditor(pew);
+		pew->setLiveEdit(false);
+		pew->releaseEditedItems();
+		pew->hide();
+		m_recyclable_editors.append(pew);
+	}
+}
+
 /**
 	@brief DiagramPropertiesEditorDockWidget::diagramWasDeleted
 	Remove current editor and set m_diagram to nullptr.
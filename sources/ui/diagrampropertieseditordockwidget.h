@@ -28,6 +28,7 @@ class DiagramPropertiesEditorDockWidget : public PropertiesEditorDockWidget
 
 	public:
 		DiagramPropertiesEditorDockWidget(QWidget *parent = nullptr);
+		~DiagramPropertiesEditorDockWidget() override;
 
 		void setDiagram(Diagram *diagram);
 
@@ -37,13 +38,22 @@ class DiagramPropertiesEditorDockWidget : public PropertiesEditorDockWidget
 		bool removeEditor(PropertiesEditorWidget *editor)
 		{ return PropertiesEditorDockWidget::removeEditor(editor); }
 
+		void clear() override;
+
 	private slots:
 		void selectionChanged();
+		void updateEditor();
 		void diagramWasDeleted();
 
+	private:
+		void recycleEditors();
+		void clearRecyclableEditors();
+
 	private:
 		Diagram *m_diagram;
 		int m_edited_qgi_type;
+		bool m_update_scheduled = false;
+		QList<PropertiesEditorWidget *> m_recyclable_editors;
 };
 
 #endif // DIAGRAMPROPERTIESEDITORDOCKWIDGET_H
@@ -48,6 +48,12 @@ DynamicElementTextItemEditor::~DynamicElementTextItemEditor()
 	delete ui;
 }
 
+/**
+	@brief DynamicElementTextItemEditor::setElement
+	Set element to be the edited element
+	@param element : the element to edit,
+	or nullptr to release the element currently edited
+*/
 void DynamicElementTextItemEditor::setElement(Element *element)
 {
 	if (m_element == element)
@@ -56,8 +62,14 @@ void DynamicElementTextItemEditor::setElement(Element *element)
 	m_element = element;
 
 	DynamicElementTextModel *old_model = m_model;
-	m_model = new DynamicElementTextModel(element, ui->m_tree_view);
-	connect(m_model, &DynamicElementTextModel::dataChanged, this, &DynamicElementTextItemEditor::dataEdited);
+	if (m_element)
+	{
+		m_model = new DynamicElementTextModel(element, ui->m_tree_view);
+		connect(m_model, &DynamicElementTextModel::dataChanged, this, &DynamicElementTextItemEditor::dataEdited);
+	}
+	else {
+		m_model = nullptr;
+	}
 	ui->m_tree_view->setModel(m_model);
 
 	if(old_model)
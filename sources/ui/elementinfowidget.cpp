@@ -53,7 +53,8 @@ ElementInfoWidget::~ElementInfoWidget()
 /**
 	@brief ElementInfoWidget::setElement
 	Set element to be the edited element
-	@param element
+	@param element : the element to edit,
+	or nullptr to release the element currently edited
 */
 void ElementInfoWidget::setElement(Element *element)
 {
@@ -63,6 +64,11 @@ void ElementInfoWidget::setElement(Element *element)
 		disconnect(m_element.data(), &Element::elementInfoChange, this, &ElementInfoWidget::elementInfoChange);
 
 	m_element = element;
+	if (!m_element)
+	{
+		disconnect(m_formula_connection);
+		return;
+	}
 	updateUi();
 
 	const auto formula_info_widget = infoPartWidgetForKey(QETInformation::ELMT_FORMULA);
@@ -75,7 +81,8 @@ void ElementInfoWidget::setElement(Element *element)
 		else
 			label_info_widget->setDisabled(true);
 
-		connect(formula_info_widget, &ElementInfoPartWidget::textChanged, this, [label_info_widget](const QString text)
+		disconnect(m_formula_connection);
+		m_formula_connection = connect(formula_info_widget, &ElementInfoPartWidget::textChanged, this, [label_info_widget](const QString text)
 		{
 			label_info_widget->setEnabled(text.isEmpty()? true : false);
 		});
@@ -174,18 +181,20 @@ void ElementInfoWidget::disableLiveEdit()
 
 /**
 	@brief ElementInfoWidget::buildInterface
-	Build the widget
+	Build the widget, with a line for each key of @a keys.
+	The lines of the previous keys, if any, are deleted.
+	@param keys
 */
-void ElementInfoWidget::buildInterface()
+void ElementInfoWidget::buildInterface(const QStringList &keys)
 {
-	QStringList keys;
-	if (m_element.data()->elementData().m_type == ElementData::Terminal) {
-		keys = QETInformation::terminalElementInfoKeys();
-	 } else {
-		keys = QETInformation::elementInfoKeys();
+	qDeleteAll(m_eipw_list);
+	m_eipw_list.clear();
+		//Only the stretch remain in the layout
+	while (QLayoutItem *item = ui->scroll_vlayout->takeAt(0)) {
+		delete item;
 	}
 
-	for (auto str : keys)
+	for (const auto &str : keys)
 	{
 		ElementInfoPartWidget *eipw = new ElementInfoPartWidget(str, QETInformation::translatedInfoKey(str), this);
 		ui->scroll_vlayout->addWidget(eipw);
@@ -193,6 +202,20 @@ void ElementInfoWidget::buildInterface()
 	}
 
 	ui->scroll_vlayout->addStretch();
+	m_keys = keys;
+}
+
+/**
+	@brief ElementInfoWidget::infoKeys
+	@return the information keys of the edited element
+*/
+QStringList ElementInfoWidget::infoKeys() const
+{
+	if (m_element.data()->elementData().m_type == ElementData::Terminal) {
+		return QETInformation::terminalElementInfoKeys();
+	} else {
+		return QETInformation::elementInfoKeys();
+	}
 }
 
 /**
@@ -219,13 +242,16 @@ ElementInfoPartWidget *ElementInfoWidget::infoPartWidgetForKey(const QString &ke
 */
 void ElementInfoWidget::updateUi()
 {
-	if (!m_ui_builded) {
-		buildInterface();
-		m_ui_builded = true;
-	}
 		//We disable live edit to avoid wrong undo when we fill the line edit with new text
 	if (m_live_edit) disableLiveEdit();
 
+		//The lines are kept from an element to another,
+		//they are only built again if the keys are not the same
+	const auto keys = infoKeys();
+	if (keys != m_keys) {
+		buildInterface(keys);
+	}
+
 	const auto element_info{m_element->elementInformations()};
 	
 	for (ElementInfoPartWidget *eipw : m_eipw_list) {
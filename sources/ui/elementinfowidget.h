@@ -60,7 +60,8 @@ class ElementInfoWidget : public AbstractElementPropertiesEditorWidget
 		void disableLiveEdit() override;
 
 	private:
-		void buildInterface();
+		void buildInterface(const QStringList &keys);
+		QStringList infoKeys() const;
 		ElementInfoPartWidget *infoPartWidgetForKey(const QString &key) const;
 
 	private slots:
@@ -72,7 +73,8 @@ class ElementInfoWidget : public AbstractElementPropertiesEditorWidget
 		Ui::ElementInfoWidget           *ui;
 		QList <ElementInfoPartWidget *>  m_eipw_list;
 		bool m_first_activation;
-		bool m_ui_builded = false;
+		QStringList m_keys;
+		QMetaObject::Connection m_formula_connection;
 };
 
 #endif // ELEMENTINFOWIDGET_H
@@ -102,7 +102,8 @@ ElementPropertiesWidget::ElementPropertiesWidget(ElementTextItemGroup *group,
 /**
 	@brief ElementPropertiesWidget::setElement
 	Set element to be the edited element
-	@param element
+	@param element : the element to edit,
+	or nullptr to release the element edited by each editor
 */
 void ElementPropertiesWidget::setElement(Element *element)
 {
@@ -110,16 +111,26 @@ void ElementPropertiesWidget::setElement(Element *element)
 	Element *previous_element = m_element;
 	m_element = element;
 
+		//Null element, release the element edited by each editor,
+		//the editors are reused at the next setElement
+	if (!m_element)
+	{
+		m_diagram = nullptr;
+		for (AbstractElementPropertiesEditorWidget *aepew : qAsConst(m_list_editor))
+			aepew->setElement(nullptr);
+		return;
+	}
+
+	m_diagram = element->diagram();
+
 	if (previous_element)
 	{
 			//If previous element is same type as new element we just call setElement for each editor
 		if(previous_element->linkType() == m_element->linkType())
 		{
 			foreach (AbstractElementPropertiesEditorWidget *aepew, m_list_editor)
-			{
 				aepew->setElement(m_element);
-				addGeneralWidget();
-			}
+			updateGeneralWidget();
 			return;
 		}
 	}
@@ -264,6 +275,29 @@ void ElementPropertiesWidget::buildGui()
 	setLayout(main_layout);
 }
 
+/**
+	@brief ElementPropertiesWidget::recycledEditor
+	@param recyclable : editors no longer used
+	@return an editor of class T for the edited element,
+	taken from @a recyclable if there is one of this class,
+	else a new one.
+*/
+template<typename T>
+T *ElementPropertiesWidget::recycledEditor(
+		QList<AbstractElementPropertiesEditorWidget *> &recyclable)
+{
+	for (int i = 0 ; i < recyclable.size() ; ++i)
+	{
+		if (auto editor = qobject_cast<T *>(recyclable.at(i)))
+		{
+			recyclable.removeAt(i);
+			editor->setElement(m_element);
+			return editor;
+		}
+	}
+	return new T(m_element, this);
+}
+
 /**
 	@brief ElementPropertiesWidget::updateUi
 	Update the content of this widget
@@ -275,43 +309,41 @@ void ElementPropertiesWidget::updateUi()
 	QString tab_text;
 	tab_text = m_tab->tabText(m_tab->currentIndex());
 
-		//Purge the tab widget and delete all widget
+		//Purge the tab widget, the editors are kept to be reused
+		//if the new element need an editor of the same class
 	m_tab->clear();
-	qDeleteAll(m_list_editor);
+	QList <AbstractElementPropertiesEditorWidget *> recyclable = m_list_editor;
 	m_list_editor.clear();
-	if(m_general_widget) {
-		delete m_general_widget;
-		m_general_widget = nullptr;
-	}
 
 		//Create editor according to the type of element
 	switch (m_element -> linkType())	{
 		case Element::Simple:
-			m_list_editor << new ElementInfoWidget(m_element, this);
+			m_list_editor << recycledEditor<ElementInfoWidget>(recyclable);
 			break;
 		case Element::Thumbnail:
-			m_list_editor << new ElementInfoWidget(m_element, this);
+			m_list_editor << recycledEditor<ElementInfoWidget>(recyclable);
 			break;
 		case Element::NextReport:
-			m_list_editor << new LinkSingleElementWidget(m_element, this);
+			m_list_editor << recycledEditor<LinkSingleElementWidget>(recyclable);
 			break;
 		case Element::PreviousReport:
-			m_list_editor << new LinkSingleElementWidget(m_element, this);
+			m_list_editor << recycledEditor<LinkSingleElementWidget>(recyclable);
 			break;
 		case Element::Master:
-			m_list_editor << new MasterPropertiesWidget(m_element, this);
-			m_list_editor << new ElementInfoWidget(m_element, this);
+			m_list_editor << recycledEditor<MasterPropertiesWidget>(recyclable);
+			m_list_editor << recycledEditor<ElementInfoWidget>(recyclable);
 			break;
 		case Element::Slave:
-			m_list_editor << new LinkSingleElementWidget(m_element, this);
+			m_list_editor << recycledEditor<LinkSingleElementWidget>(recyclable);
 			break;
 		case Element::Terminale:
-			m_list_editor << new ElementInfoWidget(m_element, this);
+			m_list_editor << recycledEditor<ElementInfoWidget>(recyclable);
 			break;
 		default:
 			break;
 	}
-	m_list_editor << new DynamicElementTextItemEditor(m_element, this);
+	m_list_editor << recycledEditor<DynamicElementTextItemEditor>(recyclable);
+	qDeleteAll(recyclable);
 
 		//Add each editors in tab widget
 	for (AbstractElementPropertiesEditorWidget *aepew : m_list_editor)
@@ -342,52 +374,37 @@ void ElementPropertiesWidget::updateUi()
 void ElementPropertiesWidget::addGeneralWidget()
 {
 	int index = m_tab->currentIndex();
-	if (m_general_widget)
-	{
-		m_tab->removeTab(m_tab->indexOf(m_general_widget));
-		delete m_general_widget;
+	if (!m_general_widget) {
+		m_general_widget = generalWidget();
 	}
-	m_general_widget = generalWidget();
-	m_tab -> addTab(m_general_widget, tr("Général"));
+	if (m_tab->indexOf(m_general_widget) == -1) {
+		m_tab -> addTab(m_general_widget, tr("Général"));
+	}
+	updateGeneralWidget();
 	m_tab->setCurrentIndex(index);
 }
 
 /**
 	@brief ElementPropertiesWidget::generalWidget
-	@return build and return the "general" widget
+	@return build and return the "general" widget,
+	the content is set by updateGeneralWidget()
 */
 QWidget *ElementPropertiesWidget::generalWidget()
 {
-	QString description_string(tr("Élement\n"));
-
-		// some element characteristic
-	description_string += QString(tr("Nom : %1\n")).arg(m_element -> name());
-	int folio_index = m_diagram -> folioIndex();
-	if (folio_index != -1) {
-		description_string += QString(tr("Folio : %1\n")).arg(folio_index + 1);
-	}
-	description_string += QString(tr("Type : %1\n")).arg(m_element->elementData().typeToString());
-	description_string += QString(tr("Sous-type : %1\n")).arg(m_element ->kindInformations()["type"].toString());
-	description_string += QString(tr("Position : %1\n")).arg(m_diagram -> convertPosition(m_element -> scenePos()).toString());
-	description_string += QString(tr("Rotation : %1°\n")).arg(m_element.data()->rotation());
-	description_string += QString(tr("Dimensions : %1*%2\n")).arg(m_element -> size().width()).arg(m_element -> size().height());
-	description_string += QString(tr("Bornes : %1\n")).arg(m_element -> terminals().count());
-	description_string += QString(tr("Emplacement : %1\n")).arg(m_element.data()->location().toString());
-
 		// widget himself
 	QWidget *general_widget = new QWidget (m_tab);
 	QVBoxLayout *vlayout_ = new QVBoxLayout (general_widget);
 	general_widget -> setLayout(vlayout_);
 
 		//widget for the text
-	QLabel *label = new QLabel (description_string, general_widget);
-	label->setWordWrap(true);
-	label->setTextInteractionFlags(Qt::TextEditorInteraction);
-	vlayout_->addWidget(label);
+	m_general_label = new QLabel (general_widget);
+	m_general_label->setWordWrap(true);
+	m_general_label->setTextInteractionFlags(Qt::TextEditorInteraction);
+	vlayout_->addWidget(m_general_label);
 
 		//widget for the pixmap
-	QLabel *pix = new QLabel(general_widget);
-	vlayout_->addWidget(pix, 0, Qt::AlignHCenter);
+	m_general_pixmap = new QLabel(general_widget);
+	vlayout_->addWidget(m_general_pixmap, 0, Qt::AlignHCenter);
 	vlayout_ -> addStretch();
 
 		//button widget
@@ -400,17 +417,46 @@ QWidget *ElementPropertiesWidget::generalWidget()
 	hlayout_->addWidget(edit_element);
 	vlayout_->addLayout(hlayout_);
 
+	return general_widget;
+}
+
+/**
+	@brief ElementPropertiesWidget::updateGeneralWidget
+	Fill the "general" widget with the edited element
+*/
+void ElementPropertiesWidget::updateGeneralWidget()
+{
+	if (!m_general_widget) {
+		return;
+	}
+
+	QString description_string(tr("Élement\n"));
+
+		// some element characteristic
+	description_string += QString(tr("Nom : %1\n")).arg(m_element -> name());
+	int folio_index = m_diagram -> folioIndex();
+	if (folio_index != -1) {
+		description_string += QString(tr("Folio : %1\n")).arg(folio_index + 1);
+	}
+	description_string += QString(tr("Type : %1\n")).arg(m_element->elementData().typeToString());
+	description_string += QString(tr("Sous-type : %1\n")).arg(m_element ->kindInformations()["type"].toString());
+	description_string += QString(tr("Position : %1\n")).arg(m_diagram -> convertPosition(m_element -> scenePos()).toString());
+	description_string += QString(tr("Rotation : %1°\n")).arg(m_element.data()->rotation());
+	description_string += QString(tr("Dimensions : %1*%2\n")).arg(m_element -> size().width()).arg(m_element -> size().height());
+	description_string += QString(tr("Bornes : %1\n")).arg(m_element -> terminals().count());
+	description_string += QString(tr("Emplacement : %1\n")).arg(m_element.data()->location().toString());
+	m_general_label->setText(description_string);
+
 		//Set the maximum size of the pixmap to the minimum size of the layout
+	QLayout *vlayout_ = m_general_widget->layout();
 	QPixmap pixmap = m_element->pixmap();
 	int margin = vlayout_->contentsMargins().left() + vlayout_->contentsMargins().right();
 	int width_ = vlayout_->minimumSize().width()-margin;
 
 	if (pixmap.size().width() > width_ || pixmap.size().height() > width_) {
-		pix->setPixmap(m_element->pixmap().scaled (width_, width_, Qt::KeepAspectRatio, Qt::SmoothTransformation));
+		m_general_pixmap->setPixmap(pixmap.scaled (width_, width_, Qt::KeepAspectRatio, Qt::SmoothTransformation));
 	}
 	else {
-		pix->setPixmap(pixmap);
+		m_general_pixmap->setPixmap(pixmap);
 	}
-
-	return general_widget;
 }
@@ -22,6 +22,7 @@
 
 class Element;
 class Diagram;
+class QLabel;
 class QTabWidget;
 class ElementsLocation;
 class DynamicElementTextItem;
@@ -52,6 +53,9 @@ class ElementPropertiesWidget : public AbstractElementPropertiesEditorWidget
 		void updateUi() override;
 		void addGeneralWidget();
 		QWidget *generalWidget();
+		void updateGeneralWidget();
+		template<typename T>
+		T *recycledEditor(QList<AbstractElementPropertiesEditorWidget *> &recyclable);
 
 	signals:
 		void findEditClicked();
@@ -61,6 +65,8 @@ class ElementPropertiesWidget : public AbstractElementPropertiesEditorWidget
 		QTabWidget *m_tab;
 		QList <AbstractElementPropertiesEditorWidget *> m_list_editor;
 		QWidget *m_general_widget;
+		QLabel *m_general_label = nullptr,
+		*m_general_pixmap = nullptr;
 };
 
 #endif // ELEMENTPROPERTIESWIDGET_H
@@ -67,6 +67,18 @@ void ImagePropertiesWidget::setImageItem(DiagramImageItem *image)
 	updateUi();
 }
 
+/**
+	@brief ImagePropertiesWidget::releaseEditedItems
+	Release the edited image, this widget doesn't edit anything
+	until the next call of setImageItem.
+*/
+void ImagePropertiesWidget::releaseEditedItems()
+{
+	if (m_image)
+		disconnect(m_image, &QGraphicsObject::scaleChanged, this, &ImagePropertiesWidget::updateUi);
+	m_image = nullptr;
+}
+
 /**
 	@brief ImagePropertiesWidget::apply
 	Apply the change
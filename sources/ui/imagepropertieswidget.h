@@ -20,6 +20,8 @@
 
 #include "../PropertiesEditor/propertieseditorwidget.h"
 
+#include <QPointer>
+
 class DiagramImageItem;
 
 namespace Ui {
@@ -38,6 +40,7 @@ class ImagePropertiesWidget : public PropertiesEditorWidget
 		explicit ImagePropertiesWidget(DiagramImageItem *image = nullptr, QWidget *parent = nullptr);
 		~ImagePropertiesWidget() override;
 		void setImageItem (DiagramImageItem *image);
+		void releaseEditedItems() override;
 
 		void apply() override;
 		void reset() override;
@@ -53,7 +56,7 @@ class ImagePropertiesWidget : public PropertiesEditorWidget
 
 	private:
 		Ui::ImagePropertiesWidget *ui;
-		DiagramImageItem *m_image;
+		QPointer<DiagramImageItem> m_image;
 		bool m_movable;
 		qreal m_scale;
 };
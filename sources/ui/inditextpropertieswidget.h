@@ -41,6 +41,7 @@ class IndiTextPropertiesWidget : public PropertiesEditorWidget
 		~IndiTextPropertiesWidget() override;
 		void setText (IndependentTextItem *text);
 		void setText (QList<IndependentTextItem *> text_list);
+		void releaseEditedItems() override {setText(QList<IndependentTextItem *>());}
 		
 		void apply() override;
 		bool setLiveEdit(bool live_edit) override;
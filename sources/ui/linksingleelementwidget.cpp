@@ -111,20 +111,21 @@ LinkSingleElementWidget::~LinkSingleElementWidget()
 /**
 	@brief LinkSingleElementWidget::setElement
 	Set element to be the edited element.
-	@param element
+	@param element : the element to edit,
+	or nullptr to release the element currently edited
 */
 void LinkSingleElementWidget::setElement(Element *element)
 {
 	if (m_element == element)
 		return;
 
-		//Remove connection of previous edited element
+		//Remove connection of previous edited element.
+		//The previous element can be removed from its diagram
+		//(and still alive in the undo stack), so the project
+		//is disconnected through the connection handle.
 	if (m_element)
 	{
-		disconnect(m_element->diagram()->project(),
-			   &QETProject::diagramRemoved,
-			   this,
-			   &LinkSingleElementWidget::diagramWasRemovedFromProject);
+		disconnect(m_project_connection);
 		disconnect(m_element.data(),
 			   &Element::linkedElementChanged,
 			   this,
@@ -143,6 +144,13 @@ void LinkSingleElementWidget::setElement(Element *element)
 		//Setup the new element, connection and ui
 	m_element = element;
 
+		//Null element, this widget doesn't edit anything until the next setElement
+	if (!m_element)
+	{
+		clearTreeWidget();
+		return;
+	}
+
 	const auto elmt_type{m_element->elementData().m_type};
 	if (elmt_type == ElementData::Slave)
 		m_filter = ElementData::Master;
@@ -153,8 +161,11 @@ void LinkSingleElementWidget::setElement(Element *element)
 	else
 		m_filter = ElementData::Simple;
 
-	connect(m_element->diagram()->project(), &QETProject::diagramRemoved,
-		this, &LinkSingleElementWidget::diagramWasRemovedFromProject);
+	if (m_element->diagram() && m_element->diagram()->project())
+		m_project_connection = connect(m_element->diagram()->project(),
+					       &QETProject::diagramRemoved,
+					       this,
+					       &LinkSingleElementWidget::diagramWasRemovedFromProject);
 	connect(m_element.data(), &Element::linkedElementChanged,
 		this, &LinkSingleElementWidget::updateUi, Qt::QueuedConnection);
 
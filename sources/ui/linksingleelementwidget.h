@@ -101,6 +101,8 @@ class LinkSingleElementWidget : public AbstractElementPropertiesEditorWidget
 	Element *m_showed_element = nullptr,
 			*m_element_to_link = nullptr;
 
+	QMetaObject::Connection m_project_connection;
+
 	QMenu *m_context_menu{nullptr};
 	QAction *m_link_action{nullptr},
 			*m_show_qtwi{nullptr},
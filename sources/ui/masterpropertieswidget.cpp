@@ -123,7 +123,8 @@ MasterPropertiesWidget::~MasterPropertiesWidget()
 /**
 	@brief MasterPropertiesWidget::setElement
 	Set the element to be edited
-	@param element
+	@param element : the element to edit,
+	or nullptr to release the element currently edited
 */
 void MasterPropertiesWidget::setElement(Element *element)
 {
@@ -142,6 +143,22 @@ void MasterPropertiesWidget::setElement(Element *element)
 		disconnect(m_project, SIGNAL(diagramRemoved(QETProject*,Diagram*)),
 			   this, SLOT(diagramWasdeletedFromProject()));
 
+		//Keep up to date this widget when the linked elements of m_element change
+	if (m_element)
+		disconnect(m_element.data(), &Element::linkedElementChanged,
+			   this, &MasterPropertiesWidget::updateUi);
+
+		//Null element, this widget doesn't edit anything until the next setElement
+	if (!element)
+	{
+		m_project = nullptr;
+		m_element = nullptr;
+		ui->m_free_tree_widget->clear();
+		ui->m_link_tree_widget->clear();
+		m_qtwi_hash.clear();
+		return;
+	}
+
 	if(Q_LIKELY(element->diagram() && element->diagram()->project()))
 	{
 		m_project = element->diagram()->project();
@@ -151,11 +168,6 @@ void MasterPropertiesWidget::setElement(Element *element)
 	else
 		m_project = nullptr;
 
-	//Keep up to date this widget when the linked elements of m_element change
-	if (m_element)
-		disconnect(m_element.data(), &Element::linkedElementChanged,
-			   this, &MasterPropertiesWidget::updateUi);
-	
 	m_element = element;
 	connect(m_element.data(), &Element::linkedElementChanged,
 		this, &MasterPropertiesWidget::updateUi);
@@ -79,7 +79,7 @@ class MasterPropertiesWidget : public AbstractElementPropertiesEditorWidget
 	QHash <QTreeWidgetItem *, Element *> m_qtwi_hash;
 	QTreeWidgetItem *m_qtwi_at_context_menu = nullptr;
 	QPointer <Element> m_showed_element;
-	QETProject *m_project;
+	QPointer <QETProject> m_project;
 	QMenu *m_context_menu;
 	QAction *m_link_action,
 			*m_unlink_action,
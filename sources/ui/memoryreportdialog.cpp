@@ -0,0 +1,155 @@
+/*
+	Copyright 2006-2026 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech. If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "memoryreportdialog.h"
+
+#include "../qetapp.h"
+#include "../qetmessagebox.h"
+#include "../qetproject.h"
+
+#include <QDialogButtonBox>
+#include <QFile>
+#include <QFileDialog>
+#include <QHeaderView>
+#include <QJsonDocument>
+#include <QLabel>
+#include <QLocale>
+#include <QPushButton>
+#include <QTreeWidget>
+#include <QVBoxLayout>
+
+namespace
+{
+	QString formatBytes(qint64 bytes)
+	{
+		if (bytes < 0) {
+			return QStringLiteral("?");
+		}
+		return QLocale().formattedDataSize(bytes);
+	}
+}
+
+/**
+	@brief MemoryReportDialog::MemoryReportDialog
+	@param parent : parent widget
+*/
+MemoryReportDialog::MemoryReportDialog(QWidget *parent) :
+	QDialog(parent)
+{
+	setWindowTitle(tr("Utilisation de la mémoire", "window title"));
+	resize(600, 450);
+
+	m_tree = new QTreeWidget(this);
+	m_tree->setColumnCount(3);
+	m_tree->setHeaderLabels({tr("Nom"), tr("Nombre"), tr("Mémoire estimée")});
+	m_tree->header()->setSectionResizeMode(0, QHeaderView::Stretch);
+
+	m_summary = new QLabel(this);
+
+	auto button_box = new QDialogButtonBox(QDialogButtonBox::Close, this);
+	auto refresh_button = button_box->addButton(tr("Actualiser"), QDialogButtonBox::ActionRole);
+	auto save_button = button_box->addButton(tr("Enregistrer le rapport..."), QDialogButtonBox::ActionRole);
+	connect(refresh_button, &QPushButton::clicked, this, &MemoryReportDialog::refresh);
+	connect(save_button, &QPushButton::clicked, this, &MemoryReportDialog::saveReport);
+	connect(button_box, &QDialogButtonBox::rejected, this, &QDialog::reject);
+
+	auto layout_ = new QVBoxLayout(this);
+	layout_->addWidget(m_tree);
+	layout_->addWidget(m_summary);
+	layout_->addWidget(button_box);
+
+	refresh();
+}
+
+/**
+	@brief MemoryReportDialog::refresh
+	Compute again the counters and fill the tree
+*/
+void MemoryReportDialog::refresh()
+{
+	m_tree->clear();
+
+	addGroup(tr("Caches partagés"), QetMemoryAccounting::sharedCounters());
+	for (const auto &project : QETApp::registeredProjects()) {
+		addGroup(project->title(), QetMemoryAccounting::projectCounters(project));
+	}
+	m_tree->expandAll();
+	m_tree->resizeColumnToContents(1);
+	m_tree->resizeColumnToContents(2);
+
+	m_summary->setText(tr("Mémoire résidente du processus : %1")
+					   .arg(formatBytes(QetMemoryAccounting::residentBytes())));
+}
+
+/**
+	@brief MemoryReportDialog::saveReport
+	Save the report in a json file
+*/
+void MemoryReportDialog::saveReport()
+{
+	const QString filepath = QFileDialog::getSaveFileName(
+				this,
+				tr("Enregistrer le rapport"),
+				QString(),
+				tr("Fichiers JSON (*.json)"));
+	if (filepath.isEmpty()) {
+		return;
+	}
+
+	QFile file(filepath);
+	if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+	{
+		QET::QetMessageBox::warning(this,
+									tr("Erreur"),
+									tr("Impossible d'écrire le fichier %1").arg(filepath));
+		return;
+	}
+	file.write(QJsonDocument(QetMemoryAccounting::toJson(QETApp::registeredProjects().values()))
+			   .toJson());
+}
+
+/**
+	@brief MemoryReportDialog::addGroup
+	Add a top level item named @a name with a child for each counter of @a counters
+	@param name
+	@param counters
+	@return the new top level item
+*/
+QTreeWidgetItem *MemoryReportDialog::addGroup(const QString &name,
+											  const QVector<QetMemoryAccounting::Counter> &counters)
+{
+	auto group = new QTreeWidgetItem(m_tree);
+	group->setText(0, name);
+	group->setText(2, formatBytes(QetMemoryAccounting::totalBytes(counters)));
+	QFont font_ = group->font(0);
+	font_.setBold(true);
+	group->setFont(0, font_);
+	group->setFont(2, font_);
+
+	for (const auto &counter : counters)
+	{
+		auto item = new QTreeWidgetItem(group);
+		item->setText(0, counter.name);
+		item->setToolTip(0, counter.id);
+		item->setText(1, QString::number(counter.count));
+		item->setText(2, formatBytes(counter.bytes));
+		item->setTextAlignment(1, Qt::AlignRight | Qt::AlignVCenter);
+		item->setTextAlignment(2, Qt::AlignRight | Qt::AlignVCenter);
+	}
+
+	return group;
+}
@@ -0,0 +1,55 @@
+/*
+	Copyright 2006-2026 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech. If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef MEMORYREPORTDIALOG_H
+#define MEMORYREPORTDIALOG_H
+
+#include <QDialog>
+
+#include "../qetmemoryaccounting.h"
+
+class QTreeWidget;
+class QTreeWidgetItem;
+class QLabel;
+
+/**
+	@brief The MemoryReportDialog class
+	Display the estimated memory used by each opened project
+	and by the shared caches, see QetMemoryAccounting.
+	The report can be saved in json.
+*/
+class MemoryReportDialog : public QDialog
+{
+	Q_OBJECT
+
+	public:
+		MemoryReportDialog(QWidget *parent = nullptr);
+
+	private slots:
+		void refresh();
+		void saveReport();
+
+	private:
+		QTreeWidgetItem *addGroup(const QString &name,
+								  const QVector<QetMemoryAccounting::Counter> &counters);
+
+	private:
+		QTreeWidget *m_tree = nullptr;
+		QLabel *m_summary = nullptr;
+};
+
+#endif // MEMORYREPORTDIALOG_H
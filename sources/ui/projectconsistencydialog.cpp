@@ -0,0 +1,118 @@
+/*
+	Copyright 2006-2026 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech. If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "projectconsistencydialog.h"
+
+#include "../diagram.h"
+#include "../qetproject.h"
+
+#include <QDialogButtonBox>
+#include <QElapsedTimer>
+#include <QHeaderView>
+#include <QLabel>
+#include <QPushButton>
+#include <QStyle>
+#include <QTreeWidget>
+#include <QVBoxLayout>
+
+/**
+	@brief ProjectConsistencyDialog::ProjectConsistencyDialog
+	@param project : project to check
+	@param parent : parent widget
+*/
+ProjectConsistencyDialog::ProjectConsistencyDialog(QETProject *project, QWidget *parent) :
+	QDialog(parent),
+	m_project(project)
+{
+	setWindowTitle(tr("Vérifier la cohérence du projet", "window title"));
+	resize(700, 450);
+
+	m_tree = new QTreeWidget(this);
+	m_tree->setColumnCount(3);
+	m_tree->setHeaderLabels({tr("Vérification"), tr("Folio"), tr("Description")});
+	m_tree->setRootIsDecorated(false);
+	m_tree->setSortingEnabled(true);
+	m_tree->header()->setSectionResizeMode(2, QHeaderView::Stretch);
+	connect(m_tree, &QTreeWidget::itemActivated, this, &ProjectConsistencyDialog::itemActivated);
+
+	m_summary = new QLabel(this);
+
+	auto button_box = new QDialogButtonBox(QDialogButtonBox::Close, this);
+	auto refresh_button = button_box->addButton(tr("Vérifier à nouveau"), QDialogButtonBox::ActionRole);
+	connect(refresh_button, &QPushButton::clicked, this, &ProjectConsistencyDialog::runCheck);
+	connect(button_box, &QDialogButtonBox::rejected, this, &QDialog::reject);
+
+	auto layout_ = new QVBoxLayout(this);
+	layout_->addWidget(m_tree);
+	layout_->addWidget(m_summary);
+	layout_->addWidget(button_box);
+
+	runCheck();
+}
+
+/**
+	@brief ProjectConsistencyDialog::runCheck
+	Check the project and fill the tree with the found issues
+*/
+void ProjectConsistencyDialog::runCheck()
+{
+	m_tree->clear();
+	m_issues.clear();
+	if (!m_project) {
+		return;
+	}
+
+	QElapsedTimer timer;
+	timer.start();
+	m_issues = ProjectConsistencyChecker(m_project).check();
+
+	m_tree->setSortingEnabled(false);
+	for (int i = 0 ; i < m_issues.size() ; ++i)
+	{
+		const auto &issue = m_issues.at(i);
+		auto item = new QTreeWidgetItem(m_tree);
+		item->setText(0, ProjectConsistencyChecker::checkName(issue.check));
+		item->setIcon(0, style()->standardIcon(issue.severity == ProjectConsistencyChecker::Error
+											   ? QStyle::SP_MessageBoxCritical
+											   : QStyle::SP_MessageBoxWarning));
+		if (issue.diagram) {
+			item->setData(1, Qt::DisplayRole, issue.diagram->folioIndex() + 1);
+		}
+		item->setText(2, issue.message);
+		item->setToolTip(2, issue.message);
+		item->setData(0, Qt::UserRole, i);
+	}
+	m_tree->setSortingEnabled(true);
+	m_tree->sortByColumn(1, Qt::AscendingOrder);
+	m_tree->resizeColumnToContents(0);
+
+	m_summary->setText(tr("%n problème(s) trouvé(s) en %1 ms", "", m_issues.size())
+					   .arg(timer.elapsed()));
+}
+
+/**
+	@brief ProjectConsistencyDialog::itemActivated
+	Show the item related to the issue of @a item
+	@param item
+*/
+void ProjectConsistencyDialog::itemActivated(QTreeWidgetItem *item)
+{
+	const int index = item->data(0, Qt::UserRole).toInt();
+	if (index >= 0 && index < m_issues.size()) {
+		ProjectConsistencyChecker::showIssue(m_issues.at(index));
+	}
+}
@@ -0,0 +1,54 @@
+/*
+	Copyright 2006-2026 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech. If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef PROJECTCONSISTENCYDIALOG_H
+#define PROJECTCONSISTENCYDIALOG_H
+
+#include <QDialog>
+#include <QPointer>
+
+#include "../projectconsistencychecker.h"
+
+class QETProject;
+class QTreeWidget;
+class QTreeWidgetItem;
+class QLabel;
+
+/**
+	@brief The ProjectConsistencyDialog class
+	Display the issues found by ProjectConsistencyChecker.
+	A double click on an issue show the related item in the folio.
+*/
+class ProjectConsistencyDialog : public QDialog
+{
+	Q_OBJECT
+
+	public:
+		ProjectConsistencyDialog(QETProject *project, QWidget *parent = nullptr);
+
+	private slots:
+		void runCheck();
+		void itemActivated(QTreeWidgetItem *item);
+
+	private:
+		QPointer<QETProject> m_project;
+		QVector<ProjectConsistencyChecker::Issue> m_issues;
+		QTreeWidget *m_tree = nullptr;
+		QLabel *m_summary = nullptr;
+};
+
+#endif // PROJECTCONSISTENCYDIALOG_H
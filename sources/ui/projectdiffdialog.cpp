@@ -0,0 +1,208 @@
+/*
+	Copyright 2006-2026 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech. If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "projectdiffdialog.h"
+
+#include "../diagram.h"
+#include "../qetgraphicsitem/element.h"
+#include "../qetgraphicsitem/qetgraphicsitem.h"
+#include "../qetproject.h"
+
+#include <QDialogButtonBox>
+#include <QDomDocument>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QGraphicsView>
+#include <QHeaderView>
+#include <QLabel>
+#include <QPushButton>
+#include <QTreeWidget>
+#include <QVBoxLayout>
+
+/**
+	@brief ProjectDiffDialog::ProjectDiffDialog
+	@param project : the new revision
+	@param reference_file : path of the file of the old revision
+	@param parent : parent widget
+*/
+ProjectDiffDialog::ProjectDiffDialog(QETProject *project,
+									 const QString &reference_file,
+									 QWidget *parent) :
+	QDialog(parent),
+	m_project(project),
+	m_reference_file(reference_file)
+{
+	setWindowTitle(tr("Comparer avec %1", "window title")
+				   .arg(QFileInfo(reference_file).fileName()));
+	resize(750, 500);
+
+	m_tree = new QTreeWidget(this);
+	m_tree->setColumnCount(4);
+	m_tree->setHeaderLabels({tr("Modification"), tr("Type"), tr("Folio"), tr("Description")});
+	m_tree->setRootIsDecorated(false);
+	m_tree->setSortingEnabled(true);
+	m_tree->header()->setSectionResizeMode(3, QHeaderView::Stretch);
+	connect(m_tree, &QTreeWidget::itemActivated, this, &ProjectDiffDialog::itemActivated);
+
+	m_summary = new QLabel(this);
+
+	auto button_box = new QDialogButtonBox(QDialogButtonBox::Close, this);
+	auto refresh_button = button_box->addButton(tr("Comparer à nouveau"), QDialogButtonBox::ActionRole);
+	connect(refresh_button, &QPushButton::clicked, this, &ProjectDiffDialog::runCompare);
+	connect(button_box, &QDialogButtonBox::rejected, this, &QDialog::reject);
+
+	auto layout_ = new QVBoxLayout(this);
+	layout_->addWidget(m_tree);
+	layout_->addWidget(m_summary);
+	layout_->addWidget(button_box);
+
+	runCompare();
+}
+
+/**
+	@brief ProjectDiffDialog::~ProjectDiffDialog
+*/
+ProjectDiffDialog::~ProjectDiffDialog()
+{
+	clearHighlight();
+}
+
+/**
+	@brief ProjectDiffDialog::runCompare
+	Compare the reference file with the project
+	and fill the tree with the differences
+*/
+void ProjectDiffDialog::runCompare()
+{
+	clearHighlight();
+	m_tree->clear();
+	m_changes.clear();
+	if (!m_project) {
+		return;
+	}
+
+	QFile file(m_reference_file);
+	QDomDocument reference;
+	if (!file.open(QIODevice::ReadOnly | QIODevice::Text)
+		|| !reference.setContent(&file))
+	{
+		m_summary->setText(tr("Impossible de lire le fichier %1").arg(m_reference_file));
+		return;
+	}
+	file.close();
+
+	QElapsedTimer timer;
+	timer.start();
+	m_changes = ProjectDiff::compare(reference, m_project->toXml());
+
+	m_tree->setSortingEnabled(false);
+	for (int i = 0 ; i < m_changes.size() ; ++i)
+	{
+		const auto &change = m_changes.at(i);
+		auto item = new QTreeWidgetItem(m_tree);
+		item->setText(0, ProjectDiff::changeTypeName(change.type));
+		switch (change.type) {
+			case ProjectDiff::Added:
+				item->setForeground(0, QColor(Qt::darkGreen));
+				break;
+			case ProjectDiff::Removed:
+				item->setForeground(0, QColor(Qt::red));
+				break;
+			case ProjectDiff::Modified:
+				item->setForeground(0, QColor(Qt::blue));
+				break;
+		}
+		item->setText(1, ProjectDiff::itemKindName(change.kind));
+		const int folio = change.new_folio >= 0 ? change.new_folio : change.old_folio;
+		item->setData(2, Qt::DisplayRole, folio + 1);
+		item->setToolTip(2, change.folio_title);
+		item->setText(3, change.description);
+		item->setToolTip(3, change.description);
+		item->setData(0, Qt::UserRole, i);
+	}
+	m_tree->setSortingEnabled(true);
+	m_tree->sortByColumn(2, Qt::AscendingOrder);
+	m_tree->resizeColumnToContents(0);
+	m_tree->resizeColumnToContents(1);
+
+	m_summary->setText(tr("%n différence(s) trouvée(s) en %1 ms", "", m_changes.size())
+					   .arg(timer.elapsed()));
+}
+
+/**
+	@brief ProjectDiffDialog::itemActivated
+	Show the folio and highlight the item related to the change of @a item
+	@param item
+*/
+void ProjectDiffDialog::itemActivated(QTreeWidgetItem *item)
+{
+	const int index = item->data(0, Qt::UserRole).toInt();
+	if (!m_project || index < 0 || index >= m_changes.size()) {
+		return;
+	}
+
+	const auto &change = m_changes.at(index);
+	const auto diagrams = m_project->diagrams();
+	if (change.new_folio < 0 || change.new_folio >= diagrams.size()) {
+		return;
+	}
+
+	clearHighlight();
+	const auto diagram = diagrams.at(change.new_folio);
+	const auto graphics_item = ProjectDiff::findItem(diagram, change);
+	if (!graphics_item) {
+		diagram->showMe();
+		return;
+	}
+
+	if (auto element = qobject_cast<Element *>(graphics_item)) {
+		element->setHighlighted(true);
+		m_highlighted.append(element);
+	}
+
+	if (auto qgi = qobject_cast<QetGraphicsItem *>(graphics_item)) {
+		QetGraphicsItem::showItem(qgi);
+	}
+	else
+	{
+		diagram->showMe();
+		diagram->clearSelection();
+		graphics_item->setSelected(true);
+
+		for (const auto &view : diagram->views())
+		{
+			QRectF fit = graphics_item->sceneBoundingRect();
+			fit.adjust(-200, -200, 200, 200);
+			view->fitInView(fit, Qt::KeepAspectRatioByExpanding);
+		}
+	}
+}
+
+/**
+	@brief ProjectDiffDialog::clearHighlight
+	Remove the highlight of the items highlighted by this dialog
+*/
+void ProjectDiffDialog::clearHighlight()
+{
+	for (const auto &element : qAsConst(m_highlighted)) {
+		if (element) {
+			element->setHighlighted(false);
+		}
+	}
+	m_highlighted.clear();
+}
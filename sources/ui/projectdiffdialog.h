@@ -0,0 +1,65 @@
+/*
+	Copyright 2006-2026 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech. If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef PROJECTDIFFDIALOG_H
+#define PROJECTDIFFDIALOG_H
+
+#include <QDialog>
+#include <QPointer>
+
+#include "../projectdiff.h"
+
+class QETProject;
+class Element;
+class QTreeWidget;
+class QTreeWidgetItem;
+class QLabel;
+
+/**
+	@brief The ProjectDiffDialog class
+	Display the differences between a project file (the old revision)
+	and the opened project (the new revision).
+	A double click on a difference show and highlight the related item
+	in the folio, the highlight is removed when the dialog is closed.
+*/
+class ProjectDiffDialog : public QDialog
+{
+	Q_OBJECT
+
+	public:
+		ProjectDiffDialog(QETProject *project,
+						  const QString &reference_file,
+						  QWidget *parent = nullptr);
+		~ProjectDiffDialog() override;
+
+	private slots:
+		void runCompare();
+		void itemActivated(QTreeWidgetItem *item);
+
+	private:
+		void clearHighlight();
+
+	private:
+		QPointer<QETProject> m_project;
+		QString m_reference_file;
+		QVector<ProjectDiff::Change> m_changes;
+		QVector<QPointer<Element>> m_highlighted;
+		QTreeWidget *m_tree = nullptr;
+		QLabel *m_summary = nullptr;
+};
+
+#endif // PROJECTDIFFDIALOG_H
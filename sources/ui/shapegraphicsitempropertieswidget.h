@@ -41,6 +41,7 @@ class ShapeGraphicsItemPropertiesWidget : public PropertiesEditorWidget
 
 		void setItem(QetShapeItem *shape);
 		void setItems(QList<QetShapeItem *> shapes_list);
+		void releaseEditedItems() override {setItems(QList<QetShapeItem *>());}
 
 	public slots:
 		void apply() override;
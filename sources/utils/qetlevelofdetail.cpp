@@ -0,0 +1,241 @@
+/*
+	Copyright 2006-2026 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech. If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "qetlevelofdetail.h"
+
+#include <QFont>
+#include <QPainter>
+#include <QSet>
+#include <QSettings>
+#include <QStyleOptionGraphicsItem>
+
+namespace QetLevelOfDetail
+{
+	namespace
+	{
+		bool s_loaded = false;
+		Thresholds s_thresholds;
+		QSet<const QPaintDevice *> s_draft_devices;
+
+		const Thresholds &cachedThresholds()
+		{
+			if (!s_loaded) {
+				reloadSettings();
+			}
+			return s_thresholds;
+		}
+	}
+
+	/**
+		@brief thresholds
+		@return the thresholds currently used by the level of detail policy
+	*/
+	Thresholds thresholds() {
+		return cachedThresholds();
+	}
+
+	/**
+		@brief setThresholds
+		Write @a thresholds in the settings and use it from now.
+		The items already drawn are not updated, it's up to the caller
+		to update the views.
+		@param thresholds
+	*/
+	void setThresholds(const Thresholds &thresholds)
+	{
+		QSettings settings;
+		settings.setValue("diagrameditor/lod-text-min-pixel-size",  thresholds.text_min_pixel_size);
+		settings.setValue("diagrameditor/lod-element-reduced",      thresholds.element_reduced);
+		settings.setValue("diagrameditor/lod-element-outline",      thresholds.element_outline);
+		settings.setValue("diagrameditor/lod-terminal-hidden",      thresholds.terminal_hidden);
+		settings.setValue("diagrameditor/lod-conductor-reduced",    thresholds.conductor_reduced);
+
+		s_thresholds = thresholds;
+		s_loaded = true;
+	}
+
+	/**
+		@brief reloadSettings
+		Read again the thresholds from the settings
+	*/
+	void reloadSettings()
+	{
+		QSettings settings;
+		const Thresholds default_;
+
+		s_thresholds.text_min_pixel_size = settings.value("diagrameditor/lod-text-min-pixel-size", default_.text_min_pixel_size).toReal();
+		s_thresholds.element_reduced     = settings.value("diagrameditor/lod-element-reduced",     default_.element_reduced).toReal();
+		s_thresholds.element_outline     = settings.value("diagrameditor/lod-element-outline",     default_.element_outline).toReal();
+		s_thresholds.terminal_hidden     = settings.value("diagrameditor/lod-terminal-hidden",     default_.terminal_hidden).toReal();
+		s_thresholds.conductor_reduced   = settings.value("diagrameditor/lod-conductor-reduced",   default_.conductor_reduced).toReal();
+		s_loaded = true;
+	}
+
+	/**
+		@brief setDraft
+		Set @a device in draft mode or not, see isDraft().
+		@param device
+		@param draft
+	*/
+	void setDraft(const QPaintDevice *device, bool draft)
+	{
+		if (draft) {
+			s_draft_devices.insert(device);
+		} else {
+			s_draft_devices.remove(device);
+		}
+	}
+
+	/**
+		@brief isDraft
+		@param device
+		@return true if the items painted to @a device
+		must be drawn with less detail, because the device is
+		painted again and again (scroll, zoom)
+	*/
+	bool isDraft(const QPaintDevice *device)
+	{
+		return !s_draft_devices.isEmpty() &&
+				s_draft_devices.contains(device);
+	}
+
+	/**
+		@brief levelOfDetail
+		@param painter
+		@param option
+		@return the level of detail of the current painting,
+		divided by DRAFT_FACTOR if the device of @a painter is in draft mode,
+		1.0 if it can't be determined
+	*/
+	qreal levelOfDetail(const QPainter *painter,
+						const QStyleOptionGraphicsItem *option)
+	{
+		if (!painter || !option) {
+			return 1.0;
+		}
+		const auto lod_ = option->levelOfDetailFromTransform(painter->worldTransform());
+		return isDraft(painter->device()) ? lod_ / DRAFT_FACTOR
+										  : lod_;
+	}
+
+	/**
+		@brief elementDetail
+		@param painter
+		@param option
+		@param widget : the widget painted, nullptr when the scene is
+		rendered to an export or a printer, in this case an element is
+		never drawn as an outline.
+		@return the detail to use for draw an element
+	*/
+	Detail elementDetail(const QPainter *painter,
+						 const QStyleOptionGraphicsItem *option,
+						 const QWidget *widget)
+	{
+		const auto &t_ = cachedThresholds();
+		const auto lod_ = levelOfDetail(painter, option);
+
+		if (widget && lod_ < t_.element_outline) {
+			return Outline;
+		} else if (lod_ < t_.element_reduced) {
+			return Reduced;
+		}
+		return Full;
+	}
+
+	/**
+		@brief terminalDetail
+		@param painter
+		@param option
+		@return the detail to use for draw a terminal, Full, Reduced or Hidden
+	*/
+	Detail terminalDetail(const QPainter *painter,
+						  const QStyleOptionGraphicsItem *option)
+	{
+		const auto lod_ = levelOfDetail(painter, option);
+
+		if (lod_ < cachedThresholds().terminal_hidden) {
+			return Hidden;
+		} else if (lod_ < 1.0) {
+			return Reduced;
+		}
+		return Full;
+	}
+
+	/**
+		@brief conductorDetail
+		@param painter
+		@param option
+		@param widget : the widget painted, nullptr when the scene is
+		rendered to an export or a printer, in this case a conductor is
+		always drawn with its full detail.
+		@return the detail to use for draw a conductor, Full or Reduced
+	*/
+	Detail conductorDetail(const QPainter *painter,
+						   const QStyleOptionGraphicsItem *option,
+						   const QWidget *widget)
+	{
+		if (widget &&
+			levelOfDetail(painter, option) < cachedThresholds().conductor_reduced) {
+			return Reduced;
+		}
+		return Full;
+	}
+
+	/**
+		@brief textIsReadable
+		@param painter
+		@param option
+		@param widget : the widget painted, nullptr when the scene is
+		rendered to an export or a printer, in this case the text is
+		always readable.
+		@param font : the font used to draw the text
+		@return true if a text drawn with @a font is big enough to be
+		read at the current zoom.
+	*/
+	bool textIsReadable(const QPainter *painter,
+						const QStyleOptionGraphicsItem *option,
+						const QWidget *widget,
+						const QFont &font)
+	{
+		return textIsReadable(painter, option, widget,
+							  font.pixelSize() > 0 ? font.pixelSize()
+												   : font.pointSizeF());
+	}
+
+	/**
+		@brief textIsReadable
+		Overload function
+		@param painter
+		@param option
+		@param widget
+		@param text_size : the size of the text in scene unit
+		@return true if a text of size @a text_size is big enough to be
+		read at the current zoom.
+	*/
+	bool textIsReadable(const QPainter *painter,
+						const QStyleOptionGraphicsItem *option,
+						const QWidget *widget,
+						qreal text_size)
+	{
+		if (!widget) {
+			return true;
+		}
+
+		return text_size * levelOfDetail(painter, option)
+				>= cachedThresholds().text_min_pixel_size;
+	}
+}
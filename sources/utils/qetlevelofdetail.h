@@ -0,0 +1,100 @@
+/*
+	Copyright 2006-2026 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech. If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef QETLEVELOFDETAIL_H
+#define QETLEVELOFDETAIL_H
+
+#include <QtGlobal>
+
+class QPainter;
+class QPaintDevice;
+class QStyleOptionGraphicsItem;
+class QWidget;
+class QFont;
+
+/**
+	Central level of detail policy used by every item of a diagram
+	to choose how much detail must be drawn at the current zoom.
+	The thresholds are read from the settings (group diagrameditor)
+	and cached, call reloadSettings() when they are modified.
+
+	The policy only reduces the detail when the item is painted
+	to a view (widget is not null), export and print are always
+	drawn with the full detail, except for the simplifications
+	historically made by the items themselves (cosmetic pen,
+	low zoom picture...).
+
+	A paint device can be set in draft mode with setDraft(),
+	used by the views while they are scrolled or zoomed :
+	the items painted to this device are drawn as if the zoom was
+	DRAFT_FACTOR times smaller, so with less detail.
+*/
+namespace QetLevelOfDetail
+{
+	enum Detail {
+		Full,    ///Draw everything
+		Reduced, ///Draw a simplified version (low zoom picture, cosmetic pen, no decoration)
+		Outline, ///Draw only the outline of the item
+		Hidden   ///Draw nothing
+	};
+
+	struct Thresholds
+	{
+			///Minimal height in pixel of a text to be drawn
+		qreal text_min_pixel_size = 4.0;
+			///Below this level of detail elements use their low zoom picture
+		qreal element_reduced = 0.5;
+			///Below this level of detail elements are drawn as an outline
+		qreal element_outline = 0.15;
+			///Below this level of detail terminals are not drawn
+		qreal terminal_hidden = 0.5;
+			///Below this level of detail conductors are simplified
+		qreal conductor_reduced = 0.5;
+	};
+
+		///Zoom divider used to choose the detail of a device in draft mode
+	const qreal DRAFT_FACTOR = 2.0;
+
+	Thresholds thresholds();
+	void setThresholds(const Thresholds &thresholds);
+	void reloadSettings();
+
+	void setDraft(const QPaintDevice *device, bool draft);
+	bool isDraft(const QPaintDevice *device);
+
+	qreal levelOfDetail(const QPainter *painter,
+						const QStyleOptionGraphicsItem *option);
+
+	Detail elementDetail(const QPainter *painter,
+						 const QStyleOptionGraphicsItem *option,
+						 const QWidget *widget);
+	Detail terminalDetail(const QPainter *painter,
+						  const QStyleOptionGraphicsItem *option);
+	Detail conductorDetail(const QPainter *painter,
+						   const QStyleOptionGraphicsItem *option,
+						   const QWidget *widget);
+	bool textIsReadable(const QPainter *painter,
+						const QStyleOptionGraphicsItem *option,
+						const QWidget *widget,
+						const QFont &font);
+	bool textIsReadable(const QPainter *painter,
+						const QStyleOptionGraphicsItem *option,
+						const QWidget *widget,
+						qreal text_size);
+}
+
+#endif // QETLEVELOFDETAIL_H
@@ -0,0 +1,157 @@
+/*
+	Copyright 2006-2026 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech. If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "startupscheduler.h"
+
+#include <QTimer>
+
+/**
+	@brief StartupScheduler::StartupScheduler
+	The times are measured from the construction of the scheduler.
+	@param parent
+*/
+StartupScheduler::StartupScheduler(QObject *parent) :
+	QObject(parent)
+{
+	m_timer.start();
+}
+
+/**
+	@brief StartupScheduler::run
+	Run the phase @a name now and record its duration.
+	@param name
+	@param task
+*/
+void StartupScheduler::run(const QString &name, const std::function<void()> &task)
+{
+	Phase phase;
+	phase.name = name;
+	phase.start_ms = m_timer.elapsed();
+	task();
+	phase.duration_ms = m_timer.elapsed() - phase.start_ms;
+	m_phases.append(phase);
+}
+
+/**
+	@brief StartupScheduler::defer
+	Add the phase @a name to the phases to run when the application
+	is interactive. The deferred phases are run in the order they are added.
+	If the application is already interactive, the phase is run from
+	the event loop after the phases already deferred.
+	@param name
+	@param task
+*/
+void StartupScheduler::defer(const QString &name, const std::function<void()> &task)
+{
+	m_deferred.append(qMakePair(name, task));
+	if (m_interactive_ms >= 0 && !m_running_deferred)
+	{
+		m_running_deferred = true;
+		QTimer::singleShot(0, this, &StartupScheduler::runNextDeferred);
+	}
+}
+
+/**
+	@brief StartupScheduler::setInteractive
+	Record the time to interactive and start to run the deferred phases.
+	Call it when the first window is displayed.
+*/
+void StartupScheduler::setInteractive()
+{
+	if (m_interactive_ms >= 0) {
+		return;
+	}
+	m_interactive_ms = m_timer.elapsed();
+
+	if (m_deferred.isEmpty()) {
+		emit finished();
+		return;
+	}
+	m_running_deferred = true;
+	QTimer::singleShot(0, this, &StartupScheduler::runNextDeferred);
+}
+
+/**
+	@brief StartupScheduler::isFinished
+	@return true if the application is interactive and every deferred
+	phase is done
+*/
+bool StartupScheduler::isFinished() const {
+	return m_interactive_ms >= 0 && !m_running_deferred && m_deferred.isEmpty();
+}
+
+/**
+	@brief StartupScheduler::timeToInteractive
+	@return the time in ms between the construction of the scheduler
+	and the call of setInteractive, -1 if not yet interactive
+*/
+qint64 StartupScheduler::timeToInteractive() const {
+	return m_interactive_ms;
+}
+
+/**
+	@brief StartupScheduler::phases
+	@return the phases already run, in the order they were run
+*/
+QVector<StartupScheduler::Phase> StartupScheduler::phases() const {
+	return m_phases;
+}
+
+/**
+	@brief StartupScheduler::report
+	@return the duration of each phase and the time to interactive,
+	as a text to print on the standard output
+*/
+QString StartupScheduler::report() const
+{
+	QString report;
+	for (const auto &phase : m_phases)
+	{
+		report += QStringLiteral("%1 %2 ms (start %3 ms)%4\n")
+				  .arg(phase.name, -32)
+				  .arg(phase.duration_ms, 6)
+				  .arg(phase.start_ms, 6)
+				  .arg(phase.deferred ? QStringLiteral(" [deferred]")
+									  : QString());
+	}
+	report += QStringLiteral("%1 %2 ms\n")
+			  .arg(QStringLiteral("time to interactive"), -32)
+			  .arg(m_interactive_ms, 6);
+	return report;
+}
+
+/**
+	@brief StartupScheduler::runNextDeferred
+	Run the first deferred phase, then give the hand back to the event loop
+	before running the next one, so the user events are not delayed
+	by more than one phase.
+*/
+void StartupScheduler::runNextDeferred()
+{
+	if (m_deferred.isEmpty())
+	{
+		m_running_deferred = false;
+		emit finished();
+		return;
+	}
+
+	const auto deferred = m_deferred.takeFirst();
+	run(deferred.first, deferred.second);
+	m_phases.last().deferred = true;
+
+	QTimer::singleShot(0, this, &StartupScheduler::runNextDeferred);
+}
@@ -0,0 +1,76 @@
+/*
+	Copyright 2006-2026 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech. If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef STARTUPSCHEDULER_H
+#define STARTUPSCHEDULER_H
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QVector>
+
+#include <functional>
+
+/**
+	@brief The StartupScheduler class
+	Run the phases of the startup of the application and measure them.
+	A phase is either run at once, because the first window needs it
+	(critical path), or deferred : the deferred phases are run one by one
+	from the event loop once the application is interactive,
+	so the first window is displayed and usable as soon as possible.
+
+	The duration of each phase and the time to interactive are recorded,
+	see report().
+*/
+class StartupScheduler : public QObject
+{
+	Q_OBJECT
+
+	public:
+		struct Phase
+		{
+			QString name;
+			qint64 start_ms = 0;
+			qint64 duration_ms = 0;
+			bool deferred = false;
+		};
+
+		StartupScheduler(QObject *parent = nullptr);
+
+		void run(const QString &name, const std::function<void()> &task);
+		void defer(const QString &name, const std::function<void()> &task);
+		void setInteractive();
+
+		bool isFinished() const;
+		qint64 timeToInteractive() const;
+		QVector<Phase> phases() const;
+		QString report() const;
+
+	signals:
+		void finished();
+
+	private:
+		void runNextDeferred();
+
+	private:
+		QElapsedTimer m_timer;
+		QVector<Phase> m_phases;
+		QVector<QPair<QString, std::function<void()>>> m_deferred;
+		qint64 m_interactive_ms = -1;
+		bool m_running_deferred = false;
+};
+
+#endif // STARTUPSCHEDULER_H